@@ -0,0 +1,254 @@
+#pragma once
+
+/**
+ * @file IncrementalEvaluation.h
+ * This file contains carl::IncrementalConstraintEvaluation, which evaluates constraints under an assignment that changes one variable at a time.
+ */
+
+#include "BasicConstraint.h"
+#include <carl-arith/core/Variables.h>
+#include <carl-arith/poly/typetraits.h>
+#include <carl-arith/ran/ran.h>
+
+#include <boost/logic/tribool.hpp>
+
+#include <algorithm>
+#include <map>
+#include <optional>
+#include <vector>
+
+namespace carl {
+
+/**
+ * Evaluates a set of constraints under an assignment that is extended and shrunk one variable at a time, as in a search that assigns variables and backtracks.
+ *
+ * Instead of evaluating all constraints after every assignment, every constraint that is not evaluable yet watches one of its unassigned variables,
+ * similar to watched literals in SAT solvers. Assigning a variable only visits the constraints watching it: such a constraint either watches another
+ * unassigned variable afterwards, or it has become evaluable and is evaluated. pop() restores the watches together with the left-hand sides.
+ *
+ * When a constraint is visited, the numeric values of the assigned variables are substituted into its left-hand side, and the partially substituted
+ * polynomial is kept for later visits. Thus, constraints may become evaluable before all their variables are assigned, for example x*y > 0 with x = 0.
+ * Polynomials that need a context (i.e. LPPolynomial) are not substituted, as libpoly evaluates constraints on an incremental assignment by itself.
+ *
+ * push() returns the constraints whose truth value changed, i.e. constraints that became evaluable and,
+ * if push() changes the value of a variable that is already assigned, evaluable constraints whose truth value flipped.
+ * pop() reverts the last push() including the partial substitutions.
+ */
+template<typename Poly>
+class IncrementalConstraintEvaluation {
+public:
+	using RAN = typename Poly::RootType;
+
+private:
+	struct Entry {
+		BasicConstraint<Poly> constraint;
+		/// Partially substituted left-hand sides, the last one is the current one.
+		std::vector<Poly> lhs;
+		/// The truth value, indeterminate if the constraint is not evaluable.
+		boost::tribool value = boost::indeterminate;
+		/// If the constraint is not evaluable, an unassigned variable of the current left-hand side.
+		Variable watch = Variable::NO_VARIABLE;
+	};
+	/// The state of an entry before it was visited, restored by pop().
+	struct Change {
+		std::size_t constraint;
+		bool substituted;
+		boost::tribool value;
+		Variable watch;
+	};
+	struct Level {
+		Variable variable;
+		std::optional<RAN> previous;
+		/// Size of the trail before the push().
+		std::size_t trail;
+	};
+
+	std::vector<Entry> mEntries;
+	/// The constraints that mention a variable.
+	std::map<Variable, std::vector<std::size_t>> mOccurrences;
+	/**
+	 * The constraints that watch a variable. May contain constraints that watch another variable by now.
+	 * These are not removed, as pop() may restore their watch. Duplicates are removed whenever the variable is assigned.
+	 */
+	std::map<Variable, std::vector<std::size_t>> mWatches;
+	Assignment<RAN> mAssignment;
+	std::vector<Change> mTrail;
+	std::vector<Level> mLevels;
+	std::vector<std::size_t> mChanged;
+
+	static bool same(boost::tribool lhs, boost::tribool rhs) {
+		if (boost::indeterminate(lhs) || boost::indeterminate(rhs)) {
+			return boost::indeterminate(lhs) && boost::indeterminate(rhs);
+		}
+		return bool(lhs) == bool(rhs);
+	}
+
+	/**
+	 * Substitutes the numeric values of assigned variables into the current left-hand side of the constraint,
+	 * or into the original one if fromOriginal is set.
+	 * @return Whether a left-hand side has been pushed.
+	 */
+	bool substitute(Entry& e, bool fromOriginal) {
+		if constexpr (needs_context_type<Poly>::value) {
+			return false;
+		} else {
+			Poly p = fromOriginal ? e.constraint.lhs() : e.lhs.back();
+			bool changed = fromOriginal;
+			for (auto v: carl::variables(p)) {
+				auto it = mAssignment.find(v);
+				if (it == mAssignment.end() || !it->second.is_numeric()) continue;
+				substitute_inplace(p, v, Poly(it->second.value()));
+				changed = true;
+			}
+			if (changed) {
+				e.lhs.emplace_back(std::move(p));
+			}
+			return changed;
+		}
+	}
+
+	/// Evaluates the constraint if possible, otherwise makes it watch an unassigned variable.
+	void update(std::size_t id) {
+		Entry& e = mEntries[id];
+		const Poly& p = e.lhs.back();
+		if (is_constant(p)) {
+			e.value = carl::evaluate(p.constant_part(), e.constraint.relation());
+			return;
+		}
+		auto vars = carl::variables(p);
+		if (vars.has(e.watch) && mAssignment.find(e.watch) == mAssignment.end()) {
+			e.value = boost::indeterminate;
+			return;
+		}
+		for (auto v: vars) {
+			if (mAssignment.find(v) != mAssignment.end()) continue;
+			e.watch = v;
+			mWatches[v].push_back(id);
+			e.value = boost::indeterminate;
+			return;
+		}
+		e.value = carl::evaluate(BasicConstraint<Poly>(p, e.constraint.relation()), mAssignment);
+		assert(!boost::indeterminate(e.value));
+	}
+
+	void visit(std::size_t id, bool fromOriginal) {
+		boost::tribool before = mEntries[id].value;
+		Variable watch = mEntries[id].watch;
+		bool substituted = substitute(mEntries[id], fromOriginal);
+		mTrail.push_back(Change{ id, substituted, before, watch });
+		update(id);
+		if (!same(before, mEntries[id].value)) {
+			mChanged.push_back(id);
+		}
+	}
+
+public:
+	/**
+	 * Adds a constraint and evaluates it on the current assignment.
+	 * Constraints can only be added if all push() have been reverted, as pop() could not revert their evaluation.
+	 * @return The index of the constraint.
+	 */
+	std::size_t add(const BasicConstraint<Poly>& c) {
+		assert(mLevels.empty());
+		std::size_t id = mEntries.size();
+		mEntries.push_back(Entry{ c, { c.lhs() } });
+		for (auto v: carl::variables(c.lhs())) {
+			mOccurrences[v].push_back(id);
+		}
+		visit(id, false);
+		mTrail.clear();
+		mChanged.clear();
+		return id;
+	}
+
+	/**
+	 * Assigns value to v, remembering the previous value of v.
+	 * @return The indices of the constraints whose truth value changed, valid until the next call of push().
+	 */
+	const std::vector<std::size_t>& push(Variable v, const RAN& value) {
+		mChanged.clear();
+		auto it = mAssignment.find(v);
+		if (it != mAssignment.end()) {
+			mLevels.push_back(Level{ v, it->second, mTrail.size() });
+			it->second = value;
+			// Values of v may have been substituted, hence start from the original constraints.
+			auto oit = mOccurrences.find(v);
+			if (oit != mOccurrences.end()) {
+				for (auto id: oit->second) {
+					visit(id, true);
+				}
+			}
+			return mChanged;
+		}
+		mLevels.push_back(Level{ v, std::nullopt, mTrail.size() });
+		mAssignment.emplace(v, value);
+		auto wit = mWatches.find(v);
+		if (wit == mWatches.end()) return mChanged;
+		// Visiting does not add to the list of v, as v is assigned now.
+		auto& watching = wit->second;
+		std::sort(watching.begin(), watching.end());
+		watching.erase(std::unique(watching.begin(), watching.end()), watching.end());
+		for (auto id: watching) {
+			// Evaluable constraints do not depend on the unassigned v.
+			if (mEntries[id].watch == v && boost::indeterminate(mEntries[id].value)) {
+				visit(id, false);
+			}
+		}
+		return mChanged;
+	}
+
+	/**
+	 * Reverts the last push().
+	 */
+	void pop() {
+		assert(!mLevels.empty());
+		const Level& level = mLevels.back();
+		while (mTrail.size() > level.trail) {
+			const Change& c = mTrail.back();
+			Entry& e = mEntries[c.constraint];
+			if (c.substituted) {
+				e.lhs.pop_back();
+			}
+			e.value = c.value;
+			e.watch = c.watch;
+			mTrail.pop_back();
+		}
+		if (level.previous) {
+			mAssignment[level.variable] = *level.previous;
+		} else {
+			mAssignment.erase(level.variable);
+		}
+		mLevels.pop_back();
+	}
+
+	/// Returns the number of push() that have not been reverted.
+	std::size_t depth() const {
+		return mLevels.size();
+	}
+
+	/// Returns the number of constraints.
+	std::size_t size() const {
+		return mEntries.size();
+	}
+
+	/// Returns the current assignment.
+	const Assignment<RAN>& assignment() const {
+		return mAssignment;
+	}
+
+	const BasicConstraint<Poly>& constraint(std::size_t id) const {
+		return mEntries[id].constraint;
+	}
+
+	/// Returns the left-hand side of the constraint with the numeric values substituted that were known when it was visited last.
+	const Poly& lhs(std::size_t id) const {
+		return mEntries[id].lhs.back();
+	}
+
+	/// Returns the truth value of the constraint, or indeterminate if it is not evaluable yet.
+	boost::tribool value(std::size_t id) const {
+		return mEntries[id].value;
+	}
+};
+
+}
@@ -269,7 +269,7 @@ private:
 			{
 				if(j == i) continue;
 
-				divisible = mGb->getGenerator(i).lmon()->divisible(mGb->getGenerator(j).lmon());
+				divisible = Polynomial::Policy::divisible(mGb->getGenerator(i).lmon(), mGb->getGenerator(j).lmon());
 				CARL_LOG_TRACE("carl.gb.gbproc", "" << (divisible ? "" : "not ") << "divisible by " << mGb->getGenerator(j));
 			}
 
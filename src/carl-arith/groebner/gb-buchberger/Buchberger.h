@@ -15,6 +15,7 @@
 #include "../GBUpdateProcedures.h"
 #include "../Ideal.h"
 #include "../Reductor.h"
+#include "BuchbergerStats.h"
 #include "CriticalPairs.h"
 
 #include <list>
@@ -57,6 +58,11 @@ struct DefaultBuchbergerSettings
 /**
  * Gebauer and Moeller style implementation of the Buchberger algorithm. For more information about this Algorithm.
  * More information can be found in the Bachelor Thesis On Groebner Bases in SMT-Compliant Decision Procedures. 
+ *
+ * Whenever a generator is added, the critical pairs are updated as described by Gebauer and Möller @cite GM88:
+ * scheduled pairs are deleted by the criterion B_k, and the new pairs are pruned by the chain criterion and by Buchberger's product criterion.
+ * Every generator carries a sugar degree @cite GMNRT91 which is used to select the next pair.
+ * The number of created, pruned and zero-reduced pairs is reported to BuchbergerStats.
  * @ingroup gb
  */
 template<typename Polynomial, template<typename> class AddingPolicy>
@@ -68,9 +74,11 @@ protected:
 	std::vector<size_t> mGbElementsIndices;
     std::shared_ptr<CritPairs> pCritPairs;
 	UpdateFnct<Buchberger<Polynomial, AddingPolicy>> mUpdateCallBack;
-#ifdef BUCHBERGER_STATISTICS
+	/// The sugar degree of every generator, indexed like the generators of the ideal.
+	std::vector<uint> mSugar;
+	/// The sugar degree of the polynomial that is currently added, zero for input polynomials.
+	uint mCurrentSugar = 0;
 	BuchbergerStats* mStats;
-#endif
 
 
 public:
@@ -78,7 +86,9 @@ public:
 		pGb(),
 		mGbElementsIndices(),
 	    pCritPairs(new CritPairs()),
-		mUpdateCallBack(this)
+		mUpdateCallBack(this),
+		mSugar(),
+		mStats(BuchbergerStats::getInstance())
 	{
 		
 	}
@@ -89,7 +99,10 @@ public:
 		pGb(new Ideal<Polynomial>(*rhs.pGb)),
 		mGbElementsIndices(rhs.mGbElementsIndices),
 		pCritPairs(new CritPairs(*rhs.pCritPairs)),
-		mUpdateCallBack(this)
+		mUpdateCallBack(this),
+		mSugar(rhs.mSugar),
+		mCurrentSugar(rhs.mCurrentSugar),
+		mStats(rhs.mStats)
 	{
 	}
 	
@@ -108,11 +121,24 @@ public:
 	void update(size_t index);
 protected:
 	
-	bool addToGb(const Polynomial& newPol)
+	/**
+	 * Adds a polynomial to the Groebner basis.
+	 * @param newPol The polynomial.
+	 * @param sugar The sugar degree of the polynomial, if it is larger than its total degree.
+	 * @return If the Groebner basis is {1}.
+	 */
+	bool addToGb(const Polynomial& newPol, uint sugar = 0)
 	{
 		 CARL_LOG_DEBUG("carl.gb.buchberger", "Add to gb: " << newPol);
+		 mCurrentSugar = sugar;
 		 return AddingPolicy<Polynomial>::addToGb( newPol, pGb, &mUpdateCallBack);
 	}
+	/// The total degree of a polynomial, i.e. the maximal degree of its terms, which is the sugar degree of an input polynomial.
+	static uint sugarDegree(const Polynomial& p);
+	/// Resets the sugar degrees of all current generators to their total degrees.
+	void initSugar();
+	/// Computes the sugar degree of the S-polynomial of the generators p1 and p2.
+	uint pairSugar(std::size_t p1, std::size_t p2, const Monomial::Arg& lcm) const;
 	void removeBuchbergerTriples(std::unordered_map<size_t, SPolPair>& spairs, std::vector<size_t>& primelist);
 
 	void reduce();
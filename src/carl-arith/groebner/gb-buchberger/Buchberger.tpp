@@ -8,7 +8,11 @@
 #pragma once
 #include "Buchberger.h"
 
+#include <carl-arith/poly/umvpoly/functions/Degree.h>
 #include <carl-arith/poly/umvpoly/functions/SPolynomial.h>
+
+#include <algorithm>
+#include <unordered_set>
 //
 //
 namespace carl
@@ -25,6 +29,7 @@ void Buchberger<Polynomial, AddingPolicy>::calculate(const std::list<Polynomial>
 	{
 		mGbElementsIndices.push_back(i);
 	}
+	initSugar();
 
 	bool foundGB = false;
 	for(const Polynomial& newPol : scheduledForAdding)
@@ -45,6 +50,7 @@ void Buchberger<Polynomial, AddingPolicy>::calculate(const std::list<Polynomial>
 		{
 			// Takes the next pair scheduled
 			SPolPair critPair = pCritPairs->pop();
+			mStats->TreatSPair();
             assert( critPair.mP1 < pGb->getGenerators().size() );
             assert( critPair.mP2 < pGb->getGenerators().size() );
 			CARL_LOG_DEBUG("carl.gb.buchberger", "Calculate SPol for: " << pGb->getGenerators()[critPair.mP1] << ", " << pGb->getGenerators()[critPair.mP2]);
@@ -60,8 +66,13 @@ void Buchberger<Polynomial, AddingPolicy>::calculate(const std::list<Polynomial>
 			Polynomial remainder = reductor.fullReduce();
 			CARL_LOG_DEBUG("carl.gb.buchberger", "Remainder of SPol: " << remainder);
 			// If it is not zero, we should add this one to our GB
-			if(!is_zero(remainder))
+			if(is_zero(remainder))
+			{
+				mStats->ZeroReduction();
+			}
+			else
 			{
+				mStats->NonZeroReduction();
 				// If it is constant, we are done and can return {1} as GB.
 				if(remainder.is_constant())
 				{
@@ -74,7 +85,7 @@ void Buchberger<Polynomial, AddingPolicy>::calculate(const std::list<Polynomial>
 
 					// divide the polynomial through the leading coefficient.
 
-					if(addToGb(remainder.normalize())) break;
+					if(addToGb(remainder.normalize(), critPair.mSugar)) break;
 				}
 			}
 		}
@@ -83,7 +94,38 @@ void Buchberger<Polynomial, AddingPolicy>::calculate(const std::list<Polynomial>
 }
 
 
-//
+template<class Polynomial, template<typename> class AddingPolicy>
+uint Buchberger<Polynomial, AddingPolicy>::sugarDegree(const Polynomial& p)
+{
+	std::size_t res = 0;
+	for(const auto& term : p)
+	{
+		res = std::max(res, carl::total_degree(term));
+	}
+	return uint(res);
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+void Buchberger<Polynomial, AddingPolicy>::initSugar()
+{
+	const std::vector<Polynomial>& generators = pGb->getGenerators();
+	mSugar.resize(generators.size());
+	for(std::size_t i = 0; i < generators.size(); ++i)
+	{
+		mSugar[i] = sugarDegree(generators[i]);
+	}
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+uint Buchberger<Polynomial, AddingPolicy>::pairSugar(std::size_t p1, std::size_t p2, const Monomial::Arg& lcm) const
+{
+	const std::vector<Polynomial>& generators = pGb->getGenerators();
+	// The S-polynomial multiplies p1 by lcm / lmon(p1) and p2 by lcm / lmon(p2), which adds the degrees of these monomials to the sugar degrees.
+	uint d1 = generators[p1].lmon() ? generators[p1].lmon()->tdeg() : 0;
+	uint d2 = generators[p2].lmon() ? generators[p2].lmon()->tdeg() : 0;
+	return std::max(mSugar[p1] + lcm->tdeg() - d1, mSugar[p2] + lcm->tdeg() - d2);
+}
+
 /**
  * Updating the critical pairs based on the added generator.
  * @param index
@@ -95,6 +137,8 @@ void Buchberger<Polynomial, AddingPolicy>::update(const size_t index)
 	std::vector<Polynomial>& generators = pGb->getGenerators();
 	assert(generators.size() > index);
 	assert(!generators[index].is_constant());
+	if(mSugar.size() <= index) mSugar.resize(index + 1);
+	mSugar[index] = std::max(mCurrentSugar, sugarDegree(generators[index]));
 	auto jEnd = mGbElementsIndices.end();
 
 	std::unordered_map<size_t, SPolPair> spairs;
@@ -105,27 +149,21 @@ void Buchberger<Polynomial, AddingPolicy>::update(const size_t index)
 		size_t otherIndex = *jt;
 		assert(generators.size() > otherIndex);
 		uint oideg = generators[otherIndex].lmon() ? generators[otherIndex].lmon()->tdeg() : 0;
-		SPolPair sp(otherIndex, index, Monomial::lcm(generators[index].lmon(), generators[otherIndex].lmon()));
-		if(sp.mLcm->tdeg() == generators[index].lmon()->tdeg() + oideg)
+		Monomial::Arg lcm = Polynomial::Policy::lcm(generators[index].lmon(), generators[otherIndex].lmon());
+		if(lcm->tdeg() == generators[index].lmon()->tdeg() + oideg)
 		{
 			// *generators[index].lmon( ), *generators[otherIndex].lmon( ) are prime.
 			primelist.push_back(otherIndex);
 		}
-		spairs.emplace(otherIndex, sp);
+		uint sugar = pairSugar(otherIndex, index, lcm);
+		spairs.emplace(otherIndex, SPolPair(otherIndex, index, std::move(lcm), sugar));
 	}
+	mStats->PairsCreated(spairs.size());
 
-	
-	pCritPairs->elimMultiples(generators[index].lmon(), spairs);
-//	pCritPairs->elimMultiples(generators[index].lmon(), index, spairs);
+	mStats->PairsDeleted(pCritPairs->elimMultiples(generators[index].lmon(), spairs));
 
 	removeBuchbergerTriples(spairs, primelist);
 
-	// Pairs which are primes don't have to be added according to Buchbergers first criterion
-	for(std::vector<size_t>::const_iterator pt = primelist.begin(); pt != primelist.end(); ++pt)
-	{
-		spairs.erase(*pt);
-	}
-
 	// We add the critical pairs to our tree of pairs
 	std::list<SPolPair> critPairsList;
 
@@ -139,7 +177,7 @@ void Buchberger<Polynomial, AddingPolicy>::update(const size_t index)
 	jEnd = mGbElementsIndices.end();
 	for(auto jt = mGbElementsIndices.begin(); jt != jEnd; ++jt)
 	{
-		if(!generators[*jt].lmon()->divisible(generators[index].lmon()))
+		if(!Polynomial::Policy::divisible(generators[*jt].lmon(), generators[index].lmon()))
 		{
 			tempIndices.push_back(*jt);
 		}
@@ -154,89 +192,55 @@ void Buchberger<Polynomial, AddingPolicy>::update(const size_t index)
 	mGbElementsIndices.push_back(index);
 }
 
+/**
+ * Prunes the new pairs of a generator.
+ * A pair is removed by the chain criterion if the lcm of another new pair properly divides its lcm.
+ * Of several pairs with the same lcm only one is kept, preferring a pair whose leading monomials are coprime.
+ * Finally, all pairs whose leading monomials are coprime are removed by Buchberger's product criterion.
+ * @param spairs The new pairs, indexed by the other generator.
+ * @param primelist The other generators whose leading monomial is coprime to the new one.
+ */
 template<class Polynomial, template<typename> class AddingPolicy>
 void Buchberger<Polynomial, AddingPolicy>::removeBuchbergerTriples(std::unordered_map<size_t, SPolPair>& spairs, std::vector<size_t>& primelist)
 {
-	auto it = spairs.begin();
-
-	if(!primelist.empty())
+	std::unordered_set<size_t> primes(primelist.begin(), primelist.end());
+	// Pairs that come first according to this ordering are kept among pairs with the same lcm.
+	auto preferred = [&primes](const SPolPair& lhs, const SPolPair& rhs)
 	{
-		auto primes = primelist.begin();
-		while(it != spairs.end())
-		{
-			if(it->first == *primes)
-			{
-				++primes;
-				//if there are no primes left, we can stop this check
-				if(primes == primelist.end())
-				{
-					break;
-					++it;
-				}
-			}
-
-			bool elim = false;
-			for(std::unordered_map<size_t, SPolPair>::const_iterator jt = spairs.begin(); jt != it; ++jt)
-			{
-				if(it->second.mLcm->divisible(jt->second.mLcm))
-				{
-					it = spairs.erase(it);
-					elim = true;
-					break;
-				}
-			}
-
-			if(elim) continue;
-
-			std::unordered_map<size_t, SPolPair>::const_iterator jt = it;
-			for(++jt; jt != spairs.end(); ++jt)
-			{
-				if(it->second.mLcm->divisible(jt->second.mLcm))
-				{
-					it = spairs.erase(it);
-					elim = true;
-					break;
-				}
-			}
-
-			if(elim) continue;
-			++it;
-		}
-	}
-	//TODO function
-	// same as above, but now without prime-skipping.
-	while(it != spairs.end())
+		bool lhsPrime = primes.count(lhs.mP1) > 0;
+		bool rhsPrime = primes.count(rhs.mP1) > 0;
+		if(lhsPrime != rhsPrime) return lhsPrime;
+		return lhs.mP1 < rhs.mP1;
+	};
+
+	// The decision is made with respect to all pairs, which is sound as divisibility is transitive.
+	std::vector<size_t> chained;
+	for(const auto& it : spairs)
 	{
-		bool elim = false; //critPair.print(std::cout);
-		for(std::unordered_map<size_t, SPolPair>::const_iterator jt = spairs.begin(); jt != it; ++jt)
+		for(const auto& jt : spairs)
 		{
-			if(it->second.mLcm->divisible(jt->second.mLcm))
+			if(it.first == jt.first) continue;
+			if(!Polynomial::Policy::divisible(it.second.mLcm, jt.second.mLcm)) continue;
+			if(it.second.mLcm != jt.second.mLcm || preferred(jt.second, it.second))
 			{
-				it = spairs.erase(it);
-				elim = true;
+				chained.push_back(it.first);
 				break;
 			}
 		}
-		if(elim) continue;
+	}
+	for(size_t i : chained)
+	{
+		spairs.erase(i);
+	}
+	mStats->PairsPrunedByChainCriterion(chained.size());
 
-		std::unordered_map<size_t, SPolPair>::const_iterator jt = it;
-		for(++jt; jt != spairs.end(); ++jt)
-		{
-			if(it->second.mLcm->divisible(jt->second.mLcm))
-			{
-				it = spairs.erase(it);
-				elim = true;
-				break;
-			}
-		}
-		if(elim)
-		{
-			continue;
-		}
-		else
-		{
-			++it;
-		}
+	// Pairs which are primes don't have to be added according to Buchbergers first criterion
+	std::size_t pruned = 0;
+	for(size_t i : primelist)
+	{
+		pruned += spairs.erase(i);
 	}
+	mStats->PairsPrunedByProductCriterion(pruned);
 }
 }
+
@@ -1,6 +1,3 @@
-
-
-
 /*
  * @file   BuchbergerStats.cpp
  * @author Sebastian Junges
@@ -11,12 +8,24 @@
 
 namespace carl
 {
-BuchbergerStats* BuchbergerStats::instance = nullptr;
-
 BuchbergerStats* BuchbergerStats::getInstance( )
 {
-    if( instance == nullptr )
-        instance = new BuchbergerStats( );
-    return instance;
+    static BuchbergerStats instance;
+    return &instance;
+}
+
+void BuchbergerStats::reset( )
+{
+    mNrOfTSQWithConstant = 0;
+    mNrOfTSQWithoutConstant = 0;
+    mNrOfSingleTermSFP = 0;
+    mNrOfReducibleIdentities = 0;
+    mNrOfReductions = 0;
+    mNrOfNonZeroReductions = 0;
+    mNrOfZeroReductions = 0;
+    mNrOfPairsCreated = 0;
+    mNrOfPairsPrunedByProduct = 0;
+    mNrOfPairsPrunedByChain = 0;
+    mNrOfPairsDeleted = 0;
 }
 }
@@ -1,6 +1,3 @@
-
-
-
 /**
  * @file   BuchbergerStats.h
  * @author Sebastian Junges
@@ -9,11 +6,18 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstddef>
+
 namespace carl
 {
 
 /**
  * A little class for gathering statistics about the Buchberger algorithm calls.
+ *
+ * Besides the adding policies, the pair management of Buchberger reports how many critical pairs are created,
+ * how many of them are pruned by the criteria of Gebauer and Möller and how many of the remaining pairs reduce to zero.
+ * The counters are atomic, hence they may be updated from several threads.
  */
 class BuchbergerStats
 {
@@ -64,44 +68,127 @@ public:
         mNrOfNonZeroReductions++;
     }
 
-    unsigned getNrTSQWithConstant( ) const
+    /**
+     * Count that an S-Pair reduced to zero
+     */
+    void ZeroReduction( )
+    {
+        mNrOfZeroReductions++;
+    }
+
+    /**
+     * Count the pairs of a new generator with all other generators
+     */
+    void PairsCreated( std::size_t n )
+    {
+        mNrOfPairsCreated += n;
+    }
+
+    /**
+     * Count new pairs that are removed because their leading monomials are coprime (Buchberger's first criterion)
+     */
+    void PairsPrunedByProductCriterion( std::size_t n )
+    {
+        mNrOfPairsPrunedByProduct += n;
+    }
+
+    /**
+     * Count new pairs that are removed because another new pair has an lcm dividing theirs (chain criterion)
+     */
+    void PairsPrunedByChainCriterion( std::size_t n )
+    {
+        mNrOfPairsPrunedByChain += n;
+    }
+
+    /**
+     * Count scheduled pairs that are removed due to a new generator
+     */
+    void PairsDeleted( std::size_t n )
+    {
+        mNrOfPairsDeleted += n;
+    }
+
+    std::size_t getNrTSQWithConstant( ) const
     {
         return mNrOfTSQWithConstant;
     }
 
-    unsigned getNrTSQWithoutConstant( ) const
+    std::size_t getNrTSQWithoutConstant( ) const
     {
         return mNrOfTSQWithoutConstant;
     }
 
-    unsigned getSingleTermSFP( ) const
+    std::size_t getSingleTermSFP( ) const
     {
         return mNrOfSingleTermSFP;
     }
     
-    unsigned getNrReducibleIdentities( ) const
+    std::size_t getNrReducibleIdentities( ) const
     {
         return mNrOfReducibleIdentities;
     }
-protected:
 
-    BuchbergerStats( ) :
-    mNrOfTSQWithConstant( 0 ),
-    mNrOfTSQWithoutConstant( 0 ),
-    mNrOfSingleTermSFP( 0 ),
-    mNrOfReducibleIdentities( 0 ),
-    mNrOfReductions( 0 ),
-    mNrOfNonZeroReductions( 0 )
+    std::size_t getNrReductions( ) const
+    {
+        return mNrOfReductions;
+    }
+
+    std::size_t getNrNonZeroReductions( ) const
     {
+        return mNrOfNonZeroReductions;
     }
-    unsigned mNrOfTSQWithConstant;
-    unsigned mNrOfTSQWithoutConstant;
-    unsigned mNrOfSingleTermSFP;
-    unsigned mNrOfReducibleIdentities;
-    unsigned mNrOfReductions;
-    unsigned mNrOfNonZeroReductions;
 
-private:
-    static BuchbergerStats* instance;
+    std::size_t getNrZeroReductions( ) const
+    {
+        return mNrOfZeroReductions;
+    }
+
+    std::size_t getNrPairsCreated( ) const
+    {
+        return mNrOfPairsCreated;
+    }
+
+    std::size_t getNrPairsPrunedByProductCriterion( ) const
+    {
+        return mNrOfPairsPrunedByProduct;
+    }
+
+    std::size_t getNrPairsPrunedByChainCriterion( ) const
+    {
+        return mNrOfPairsPrunedByChain;
+    }
+
+    std::size_t getNrPairsDeleted( ) const
+    {
+        return mNrOfPairsDeleted;
+    }
+
+    /**
+     * The number of pairs that were never reduced because of some criterion.
+     */
+    std::size_t getNrPairsPruned( ) const
+    {
+        return getNrPairsPrunedByProductCriterion( ) + getNrPairsPrunedByChainCriterion( ) + getNrPairsDeleted( );
+    }
+
+    /**
+     * Sets all counters to zero.
+     */
+    void reset( );
+
+protected:
+
+    BuchbergerStats( ) = default;
+    std::atomic<std::size_t> mNrOfTSQWithConstant = 0;
+    std::atomic<std::size_t> mNrOfTSQWithoutConstant = 0;
+    std::atomic<std::size_t> mNrOfSingleTermSFP = 0;
+    std::atomic<std::size_t> mNrOfReducibleIdentities = 0;
+    std::atomic<std::size_t> mNrOfReductions = 0;
+    std::atomic<std::size_t> mNrOfNonZeroReductions = 0;
+    std::atomic<std::size_t> mNrOfZeroReductions = 0;
+    std::atomic<std::size_t> mNrOfPairsCreated = 0;
+    std::atomic<std::size_t> mNrOfPairsPrunedByProduct = 0;
+    std::atomic<std::size_t> mNrOfPairsPrunedByChain = 0;
+    std::atomic<std::size_t> mNrOfPairsDeleted = 0;
 };
-}
\ No newline at end of file
+}
@@ -14,6 +14,7 @@
 #include "CriticalPairsEntry.h"
 
 #include <unordered_map>
+#include <vector>
 
 namespace carl
 {
@@ -25,9 +26,15 @@ public:
     using Entry = CriticalPairsEntry<Compare>*;
     using CompareResult = carl::CompareResult;
 
+    /**
+     * Compares the first pairs of two entries by their sugar degree first and by their lcm second.
+     */
     static CompareResult compare( Entry e1, Entry e2 )
     {
-        return Compare::compare( e1->getSortedFirstLCM( ), e2->getSortedFirstLCM( ) );
+        const SPolPair& p1 = e1->getFirst( );
+        const SPolPair& p2 = e2->getFirst( );
+        if( p1.mSugar != p2.mSugar ) return p1.mSugar < p2.mSugar ? CompareResult::LESS : CompareResult::GREATER;
+        return Compare::compare( p1.mLcm, p2.mLcm );
     }
 
     static bool cmpLessThan( CompareResult res )
@@ -48,6 +55,7 @@ public:
 
 /**
  * A data structure to store all the SPolynomial pairs which have to be checked.
+ * Pairs are selected by the sugar strategy @cite GMNRT91, i.e. the pair with the smallest sugar degree comes first.
  */
 template<template <class> class Datastructure, class Configuration>
 class CriticalPairs
@@ -74,12 +82,25 @@ public:
      * @return 
      */
     SPolPair pop( );
+
+	/**
+	 * Gets the first SPol from the data structure without removing it.
+     * @return 
+     */
+    const SPolPair& top( ) const
+    {
+        return mDatastruct.top( )->getFirst( );
+    }
+
 	/**
 	 * Eliminate multiples of the given monomial.
-     * @param lm
-     * @param newpairs
+	 * A pair (i,j) is removed if lm divides its lcm and the lcms of (i,k) and (j,k) both differ from it,
+	 * where k is the new generator with leading monomial lm (criterion B_k of Gebauer and Möller @cite GM88).
+     * @param lm The leading monomial of the new generator.
+     * @param newpairs The pairs of the new generator, indexed by the other generator.
+     * @return The number of removed pairs.
      */
-    void elimMultiples( const Monomial::Arg& lm, const std::unordered_map<size_t, SPolPair>& newpairs );
+    std::size_t elimMultiples( const Monomial::Arg& lm, const std::unordered_map<size_t, SPolPair>& newpairs );
     
 	/**
 	 * Checks whether there are any pairs in the data structure.
@@ -28,30 +28,25 @@ namespace carl
         return ret;
     }
     
-    /**
-     * 
-     * @param lm
-     * @param newpairs
-     */
     template<template <class> class Datastructure, class Configuration>
-    void CriticalPairs<Datastructure, Configuration>::elimMultiples( const Monomial::Arg& lm, const std::unordered_map<size_t, SPolPair>& newpairs )
+    std::size_t CriticalPairs<Datastructure, Configuration>::elimMultiples( const Monomial::Arg& lm, const std::unordered_map<size_t, SPolPair>& newpairs )
     {
-        typename Datastructure<Configuration>::const_iterator it( mDatastruct.begin( ) );
-        while( it != mDatastruct.end( ) )
+        // Removing the first pair of an entry changes its position in the data structure, hence all entries are taken out and pushed again.
+        std::vector<typename Configuration::Entry> entries;
+        entries.reserve( mDatastruct.size( ) );
+        while( !mDatastruct.empty( ) )
         {
-            auto ps = it.get( )->getPairsBegin( );
+            entries.push_back( mDatastruct.pop( ) );
+        }
 
-            for( ++ps; ps != it.get( )->getPairsEnd( ); )
+        std::size_t removed = 0;
+        for( typename Configuration::Entry entry : entries )
+        {
+            for( auto ps = entry->getPairsBegin( ); ps != entry->getPairsEnd( ); )
             {
                 auto spp1 = newpairs.find(ps->mP1);
                 auto spp2 = newpairs.find(ps->mP2);
-
-                if( spp1 == newpairs.end( ) )
-                {
-                    ++ps;
-                    continue;
-                }
-                if( spp2 == newpairs.end( ) )
+                if( spp1 == newpairs.end( ) || spp2 == newpairs.end( ) )
                 {
                     ++ps;
                     continue;
@@ -60,21 +55,24 @@ namespace carl
                 const Monomial::Arg & psLcm = ps->mLcm;
                 if( psLcm->divisible( lm ) && psLcm != spp1->second.mLcm && psLcm != spp2->second.mLcm )
                 {
-                    ps = it.get( )->erase( ps );
+                    ps = entry->erase( ps );
+                    ++removed;
                 }
                 else
                 {
                     ++ps;
                 }
             }
-            if( it.get( )->getPairsBegin( ) == it.get( )->getPairsEnd( ) )
+            if( entry->getPairsBegin( ) == entry->getPairsEnd( ) )
             {
-                mDatastruct.popPosition( it );
+                delete entry;
             }
             else
             {
-                it.next( );
+                mDatastruct.push( entry );
             }
         }
+        return removed;
     }
 }
+
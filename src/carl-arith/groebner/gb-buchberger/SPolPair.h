@@ -11,31 +11,36 @@ namespace carl
 {
     /**
      * Basic spol-pair. Optimizations could be deducing p2 from the structure where it is saved, and not saving the lcm.
-     * Also sugar might be added.
      * @param p1 index of polynomial p1
      * @param p2 index of polynomial p2
      * @param lcm the lcm(lt(p1), lt(p2))
+     * @param sugar the sugar degree of the S-polynomial, see @cite GMNRT91
      */
     struct SPolPair
     {
-        SPolPair( std::size_t p1, std::size_t p2, Monomial::Arg lcm ) : mP1(p1), mP2(p2), mLcm(std::move(lcm))
+        SPolPair( std::size_t p1, std::size_t p2, Monomial::Arg lcm, uint sugar = 0 ) : mP1(p1), mP2(p2), mLcm(std::move(lcm)), mSugar(sugar)
         {}
 
         const std::size_t mP1;
         const std::size_t mP2;
         const Monomial::Arg mLcm;
+        const uint mSugar;
 
         void print(std::ostream& os = std::cout) const
         {
-            os << "(" << mP1 << "," << mP2 << "): " << mLcm;
+            os << "(" << mP1 << "," << mP2 << "): " << mLcm << " [sugar " << mSugar << "]";
         }
     };
 
+    /**
+     * Orders pairs by their sugar degree first and by their lcm (according to Compare) second.
+     */
     template <class Compare>
     struct SPolPairCompare
     {
         bool operator( )(const SPolPair& s1, const SPolPair & s2 )
         {
+            if( s1.mSugar != s2.mSugar ) return s1.mSugar < s2.mSugar;
             return Compare::less( s1.mLcm, s2.mLcm );
         }
     };
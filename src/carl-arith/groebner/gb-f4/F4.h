@@ -0,0 +1,97 @@
+/**
+ * @file   F4.h
+ * @ingroup gb
+ *
+ */
+
+#pragma once
+
+#include "../gb-buchberger/Buchberger.h"
+#include "MacaulayMatrix.h"
+
+#include <carl-arith/numbers/PrimeField.h>
+
+#include <list>
+#include <optional>
+#include <vector>
+
+namespace carl
+{
+
+/**
+ * Groebner basis computation following the F4 algorithm by Faugère @cite Fau99.
+ *
+ * Instead of reducing one S-polynomial at a time, all critical pairs with the smallest lcm degree are selected at once (normal strategy).
+ * As the new polynomials are added without a sugar degree, the sugar degree of a pair is the degree of its lcm and the sugar strategy of Buchberger selects the same pairs.
+ * Both halves of every pair (the generators multiplied up to the lcm) form the rows of a sparse Macaulay matrix,
+ * which is completed by the symbolic preprocessing with multiples of generators for every monomial that can be reduced.
+ * The rows whose leading monomials are not divisible by any generator after the row reduction are added to the Groebner basis.
+ *
+ * The management of the critical pairs (including the criteria) and the adding policies are shared with Buchberger,
+ * hence F4 can be used as a drop-in replacement for Buchberger in GBProcedure.
+ *
+ * For rational coefficients, every matrix is reduced modulo a word-sized prime first.
+ * Rows that vanish modulo this prime are not reduced over the rationals, as they almost certainly vanish there as well.
+ * The critical pairs of such rows are checked by an exact reduction once all other pairs have been processed, which keeps the result exact.
+ * Only these pairs are counted as reductions in BuchbergerStats.
+ * @ingroup gb
+ */
+template<typename Polynomial, template<typename> class AddingPolicy>
+class F4 : public Buchberger<Polynomial, AddingPolicy>
+{
+	using Super = Buchberger<Polynomial, AddingPolicy>;
+	using Coeff = typename Polynomial::CoeffType;
+
+	/// A row of the matrix before its construction: a generator multiplied by a monomial.
+	struct RowSource
+	{
+		std::size_t generator;
+		Monomial::Arg factor;
+	};
+
+public:
+	F4() = default;
+	F4(const F4& rhs) = default;
+	~F4() override = default;
+
+	void calculate(const std::list<Polynomial>& scheduledForAdding);
+
+protected:
+	/**
+	 * Removes all critical pairs with the smallest degree of their lcm.
+	 * @return The selected pairs.
+	 */
+	std::vector<SPolPair> selectPairs();
+
+	/**
+	 * Reduces the given pairs simultaneously and adds all new polynomials to the Groebner basis.
+	 * @param pairs Selected pairs.
+	 * @param postponed Pairs that could not be checked by the modular reduction are appended.
+	 * @return If the Groebner basis is {1}.
+	 */
+	bool reducePairs(const std::vector<SPolPair>& pairs, std::vector<SPolPair>& postponed);
+
+	/**
+	 * Reduces the given pairs one by one using the Reductor and adds the nonzero remainders to the Groebner basis.
+	 * @param pairs Postponed pairs, cleared afterwards.
+	 * @return If the Groebner basis is {1}.
+	 */
+	bool reducePostponed(std::vector<SPolPair>& pairs);
+
+	/**
+	 * Reduces the matrix given by its reducers and rows modulo a word-sized prime.
+	 * @return Which rows vanish modulo the prime, or std::nullopt if the matrix can not be mapped to the prime field.
+	 */
+	std::optional<std::vector<bool>> vanishingRows(
+		std::size_t columns,
+		const std::vector<typename MacaulayMatrix<CoefficientField<Coeff>>::Row>& reducers,
+		const std::vector<typename MacaulayMatrix<CoefficientField<Coeff>>::Row>& rows
+	) const;
+
+	/// Returns the sparsest generator whose leading monomial divides m.
+	std::optional<std::size_t> findReducer(const Monomial::Arg& m) const;
+};
+
+}
+
+#include "F4.tpp"
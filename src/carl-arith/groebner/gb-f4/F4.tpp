@@ -0,0 +1,333 @@
+/**
+ * @file F4.tpp
+ * @ingroup gb
+ */
+#pragma once
+#include "F4.h"
+
+#include <carl-arith/numbers/PrimeFactory.h>
+#include <carl-arith/poly/umvpoly/functions/SPolynomial.h>
+
+#include <algorithm>
+#include <map>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace carl
+{
+
+/**
+ * Calculate the Groebner basis
+ */
+template<class Polynomial, template<typename> class AddingPolicy>
+void F4<Polynomial, AddingPolicy>::calculate(const std::list<Polynomial>& scheduledForAdding)
+{
+	CARL_LOG_INFO("carl.gb.f4", "Calculate gb");
+	for(std::size_t i = 0; i < this->pGb->getGenerators().size(); ++i)
+	{
+		this->mGbElementsIndices.push_back(i);
+	}
+	this->initSugar();
+
+	bool foundGB = false;
+	for(const Polynomial& newPol : scheduledForAdding)
+	{
+		// The S-polynomials of postponed pairs require normalized generators.
+		if(this->addToGb(newPol.normalize()))
+		{
+			CARL_LOG_INFO("carl.gb.f4", "Added a constant polynomial.");
+			foundGB = true;
+			break;
+		}
+	}
+
+	std::vector<SPolPair> postponed;
+	while(!foundGB)
+	{
+		while(!foundGB && !this->pCritPairs->empty())
+		{
+			foundGB = reducePairs(selectPairs(), postponed);
+		}
+		if(foundGB || postponed.empty()) break;
+		// Adding new generators creates new pairs, hence we continue with the main loop.
+		foundGB = reducePostponed(postponed);
+	}
+	this->mGbElementsIndices.clear();
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+std::vector<SPolPair> F4<Polynomial, AddingPolicy>::selectPairs()
+{
+	std::vector<SPolPair> pairs;
+	pairs.push_back(this->pCritPairs->pop());
+	// New polynomials are added without a sugar degree, hence the sugar degree of every pair is the degree of its lcm (normal strategy).
+	// The pairs are ordered by their sugar degree first, hence the pairs of the same degree come in a row.
+	uint sugar = pairs.front().mSugar;
+	while(!this->pCritPairs->empty() && this->pCritPairs->top().mSugar == sugar)
+	{
+		pairs.push_back(this->pCritPairs->pop());
+	}
+	CARL_LOG_DEBUG("carl.gb.f4", "Selected " << pairs.size() << " pairs of degree " << sugar);
+	return pairs;
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+std::optional<std::size_t> F4<Polynomial, AddingPolicy>::findReducer(const Monomial::Arg& m) const
+{
+	if(!m) return std::nullopt;
+	const std::vector<Polynomial>& generators = this->pGb->getGenerators();
+	std::optional<std::size_t> res;
+	for(std::size_t index : this->mGbElementsIndices)
+	{
+		if(!Polynomial::Policy::divisible(m, generators[index].lmon())) continue;
+		if(!res || generators[index].nr_terms() < generators[*res].nr_terms())
+		{
+			res = index;
+		}
+	}
+	return res;
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+bool F4<Polynomial, AddingPolicy>::reducePairs(const std::vector<SPolPair>& pairs, std::vector<SPolPair>& postponed)
+{
+	using Field = CoefficientField<Coeff>;
+	using Row = typename MacaulayMatrix<Field>::Row;
+	const std::vector<Polynomial>& generators = this->pGb->getGenerators();
+
+	// Both halves of every pair, every half is used only once.
+	std::vector<RowSource> halves;
+	std::map<std::pair<std::size_t, const Monomial*>, std::size_t> halfIndices;
+	std::vector<std::pair<std::size_t, std::size_t>> pairHalves;
+	auto addHalf = [&](std::size_t generator, const Monomial::Arg& lcm) {
+		Monomial::Arg factor;
+		bool divides = lcm->divide(generators[generator].lmon(), factor);
+		assert(divides);
+		(void)divides;
+		auto it = halfIndices.emplace(std::make_pair(generator, factor.get()), halves.size());
+		if(it.second) halves.push_back(RowSource({ generator, factor }));
+		return it.first->second;
+	};
+	for(const SPolPair& pair : pairs)
+	{
+		std::size_t h1 = addHalf(pair.mP1, pair.mLcm);
+		std::size_t h2 = addHalf(pair.mP2, pair.mLcm);
+		pairHalves.emplace_back(h1, h2);
+	}
+
+	// Symbolic preprocessing: add a reducer for every monomial that is divisible by some leading monomial.
+	std::unordered_set<Monomial::Arg> monomials;
+	std::vector<Monomial::Arg> todo;
+	auto addTail = [&](const RowSource& source) {
+		const Polynomial& p = generators[source.generator];
+		for(const auto& term : p)
+		{
+			if(term.monomial() == p.lmon()) continue;
+			todo.push_back(term.monomial() * source.factor);
+		}
+	};
+	for(const RowSource& half : halves)
+	{
+		monomials.insert(generators[half.generator].lmon() * half.factor);
+		addTail(half);
+	}
+	std::vector<RowSource> reducers;
+	while(!todo.empty())
+	{
+		Monomial::Arg m = std::move(todo.back());
+		todo.pop_back();
+		if(!monomials.insert(m).second) continue;
+		auto reducer = findReducer(m);
+		if(!reducer) continue;
+		Monomial::Arg factor;
+		m->divide(generators[*reducer].lmon(), factor);
+		reducers.push_back(RowSource({ *reducer, factor }));
+		addTail(reducers.back());
+	}
+
+	// Columns are sorted descendingly.
+	std::vector<Monomial::Arg> columnMonomials(monomials.begin(), monomials.end());
+	std::sort(columnMonomials.begin(), columnMonomials.end(), [](const Monomial::Arg& lhs, const Monomial::Arg& rhs){
+		return Polynomial::OrderedBy::less(rhs, lhs);
+	});
+	std::unordered_map<Monomial::Arg, std::size_t> columns;
+	for(std::size_t i = 0; i < columnMonomials.size(); ++i)
+	{
+		columns.emplace(columnMonomials[i], i);
+	}
+	CARL_LOG_DEBUG("carl.gb.f4", "Matrix with " << halves.size() << " rows, " << reducers.size() << " reducers and " << columnMonomials.size() << " columns");
+
+	auto makeRow = [&](const RowSource& source) {
+		const Polynomial& p = generators[source.generator];
+		Row row;
+		row.entries.reserve(p.nr_terms());
+		for(const auto& term : p)
+		{
+			row.entries.emplace_back(columns.at(term.monomial() * source.factor), term.coeff());
+		}
+		std::sort(row.entries.begin(), row.entries.end(), [](const auto& lhs, const auto& rhs){ return lhs.first < rhs.first; });
+		if(Polynomial::Policy::has_reasons)
+		{
+			row.reasons = p.getReasons();
+		}
+		return row;
+	};
+	std::vector<Row> reducerRows;
+	reducerRows.reserve(reducers.size());
+	for(const RowSource& reducer : reducers)
+	{
+		reducerRows.push_back(makeRow(reducer));
+	}
+	// Process the halves from the largest leading monomial, such that halves with the same lcm reduce each other.
+	std::vector<std::size_t> order(halves.size());
+	std::vector<Row> rows;
+	rows.reserve(halves.size());
+	for(std::size_t i = 0; i < halves.size(); ++i)
+	{
+		order[i] = i;
+		rows.push_back(makeRow(halves[i]));
+	}
+	std::stable_sort(order.begin(), order.end(), [&rows](std::size_t lhs, std::size_t rhs){
+		return rows[lhs].leading_column() < rows[rhs].leading_column();
+	});
+	std::vector<Row> orderedRows;
+	orderedRows.reserve(rows.size());
+	for(std::size_t i : order)
+	{
+		orderedRows.push_back(std::move(rows[i]));
+	}
+
+	std::vector<bool> skip(orderedRows.size(), false);
+	if constexpr (std::is_same<Coeff, mpq_class>::value)
+	{
+		if(auto vanishing = vanishingRows(columnMonomials.size(), reducerRows, orderedRows))
+		{
+			skip = std::move(*vanishing);
+			std::vector<bool> skipHalf(halves.size(), false);
+			for(std::size_t i = 0; i < order.size(); ++i)
+			{
+				skipHalf[order[i]] = skip[i];
+			}
+			for(std::size_t i = 0; i < pairs.size(); ++i)
+			{
+				if(skipHalf[pairHalves[i].first] || skipHalf[pairHalves[i].second])
+				{
+					postponed.push_back(pairs[i]);
+				}
+			}
+		}
+	}
+
+	// Leading monomials that are divisible by some generator.
+	// Skipped rows are not reduced, hence their leading monomials are not covered by a pivot.
+	std::vector<bool> isLeading(columnMonomials.size(), false);
+	for(const Row& row : reducerRows) isLeading[row.leading_column()] = true;
+	for(std::size_t i = 0; i < orderedRows.size(); ++i)
+	{
+		if(!skip[i]) isLeading[orderedRows[i].leading_column()] = true;
+	}
+
+	MacaulayMatrix<Field> matrix(columnMonomials.size(), Field());
+	for(Row& row : reducerRows)
+	{
+		matrix.add_pivot(std::move(row));
+	}
+	std::vector<Polynomial> newPolynomials;
+	for(std::size_t i = 0; i < orderedRows.size(); ++i)
+	{
+		if(skip[i]) continue;
+		auto column = matrix.reduce(std::move(orderedRows[i]));
+		if(!column || isLeading[*column]) continue;
+		const Row* row = matrix.pivot(*column);
+		typename Polynomial::TermsType terms;
+		terms.reserve(row->entries.size());
+		for(auto it = row->entries.rbegin(); it != row->entries.rend(); ++it)
+		{
+			terms.emplace_back(it->second, columnMonomials[it->first]);
+		}
+		Polynomial p(std::move(terms), false, true);
+		p.setReasons(row->reasons);
+		CARL_LOG_DEBUG("carl.gb.f4", "New polynomial: " << p);
+		newPolynomials.push_back(std::move(p));
+	}
+
+	for(const Polynomial& p : newPolynomials)
+	{
+		if(this->addToGb(p)) return true;
+	}
+	return false;
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+bool F4<Polynomial, AddingPolicy>::reducePostponed(std::vector<SPolPair>& pairs)
+{
+	CARL_LOG_DEBUG("carl.gb.f4", "Check " << pairs.size() << " postponed pairs");
+	std::vector<SPolPair> current;
+	current.swap(pairs);
+	for(const SPolPair& pair : current)
+	{
+		const Polynomial& p1 = this->pGb->getGenerators()[pair.mP1];
+		const Polynomial& p2 = this->pGb->getGenerators()[pair.mP2];
+		Polynomial spol = carl::SPolynomial(p1, p2);
+		spol.setReasons(p1.getReasons() | p2.getReasons());
+		Reductor<Polynomial, Polynomial> reductor(*this->pGb, spol);
+		Polynomial remainder = reductor.fullReduce();
+		this->mStats->TreatSPair();
+		if(is_zero(remainder))
+		{
+			this->mStats->ZeroReduction();
+		}
+		else
+		{
+			CARL_LOG_DEBUG("carl.gb.f4", "Postponed pair " << pair.mP1 << ", " << pair.mP2 << " did not vanish: " << remainder);
+			this->mStats->NonZeroReduction();
+			if(this->addToGb(remainder.normalize())) return true;
+		}
+	}
+	return false;
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+std::optional<std::vector<bool>> F4<Polynomial, AddingPolicy>::vanishingRows(
+	std::size_t columns,
+	const std::vector<typename MacaulayMatrix<CoefficientField<Coeff>>::Row>& reducers,
+	const std::vector<typename MacaulayMatrix<CoefficientField<Coeff>>::Row>& rows
+) const
+{
+	using Row = typename MacaulayMatrix<PrimeField>::Row;
+	static const uint prime = WordPrimeFactory().next_prime();
+	PrimeField field(prime);
+	auto convert = [&field](const auto& row) -> std::optional<Row> {
+		Row res;
+		res.entries.reserve(row.entries.size());
+		for(const auto& e : row.entries)
+		{
+			PrimeField::Element den = field.reduce(carl::get_denom(e.second));
+			if(den == 0) return std::nullopt;
+			PrimeField::Element c = field.div(field.reduce(carl::get_num(e.second)), den);
+			if(c != 0) res.entries.emplace_back(e.first, c);
+		}
+		return res;
+	};
+
+	MacaulayMatrix<PrimeField> matrix(columns, field);
+	for(const auto& reducer : reducers)
+	{
+		auto row = convert(reducer);
+		// The leading coefficient must not vanish, otherwise the reducer can not be used as a pivot.
+		if(!row || row->entries.empty() || row->leading_column() != reducer.leading_column()) return std::nullopt;
+		matrix.add_pivot(std::move(*row));
+	}
+	std::vector<bool> res;
+	res.reserve(rows.size());
+	for(const auto& r : rows)
+	{
+		auto row = convert(r);
+		if(!row) return std::nullopt;
+		res.push_back(!matrix.reduce(std::move(*row)));
+	}
+	return res;
+}
+
+}
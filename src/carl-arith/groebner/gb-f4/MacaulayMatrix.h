@@ -0,0 +1,155 @@
+/**
+ * @file MacaulayMatrix.h
+ * @ingroup gb
+ */
+
+#pragma once
+
+#include <carl-common/datastructures/BitVector.h>
+
+#include <cassert>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace carl
+{
+
+/**
+ * Exact arithmetic over a field given by its coefficient type, e.g. the rationals.
+ * Offers the same interface as PrimeField, such that MacaulayMatrix can work on both.
+ */
+template<typename Coeff>
+struct CoefficientField
+{
+	using Element = Coeff;
+
+	bool is_zero(const Coeff& a) const {
+		return carl::is_zero(a);
+	}
+	Coeff sub(const Coeff& a, const Coeff& b) const {
+		return a - b;
+	}
+	Coeff mul(const Coeff& a, const Coeff& b) const {
+		return a * b;
+	}
+	Coeff inv(const Coeff& a) const {
+		assert(!carl::is_zero(a));
+		return Coeff(1) / a;
+	}
+};
+
+/**
+ * A sparse Macaulay matrix in row echelon form, as used by F4.
+ *
+ * Columns correspond to monomials and are sorted descendingly, i.e. column zero is the largest monomial.
+ * The matrix stores at most one row for every column, called the pivot of this column, whose first nonzero entry is one and lies in this column.
+ * New rows are reduced by all pivots before they are stored themselves.
+ * Every row keeps the reasons of all the rows it was combined from.
+ * @ingroup gb
+ */
+template<typename Field>
+class MacaulayMatrix
+{
+public:
+	using Element = typename Field::Element;
+
+	struct Row
+	{
+		/// Nonzero entries as pairs of column and coefficient, sorted by column.
+		std::vector<std::pair<std::size_t, Element>> entries;
+		/// The reasons of this row.
+		BitVector reasons;
+
+		std::size_t leading_column() const {
+			assert(!entries.empty());
+			return entries.front().first;
+		}
+	};
+
+private:
+	Field mField;
+	/// Rows, in the order they were added.
+	std::vector<Row> mRows;
+	/// Index of the pivot for every column.
+	std::vector<std::optional<std::size_t>> mPivots;
+	/// Dense accumulator used for the reduction, all entries are zero in between two reductions.
+	std::vector<Element> mDense;
+
+	void normalize(Row& row) const {
+		const Element& lead = row.entries.front().second;
+		if (lead == Element(1)) return;
+		Element factor = mField.inv(lead);
+		for (auto& e: row.entries) {
+			e.second = mField.mul(e.second, factor);
+		}
+	}
+
+public:
+	MacaulayMatrix(std::size_t columns, const Field& field):
+		mField(field),
+		mPivots(columns),
+		mDense(columns, Element(0))
+	{}
+
+	/// Returns the number of columns.
+	std::size_t columns() const {
+		return mPivots.size();
+	}
+
+	/// Returns the pivot of the given column, if there is one.
+	const Row* pivot(std::size_t column) const {
+		if (!mPivots[column]) return nullptr;
+		return &mRows[*mPivots[column]];
+	}
+
+	/**
+	 * Stores a row as pivot of its leading column without reducing it.
+	 * This is only valid if there is no pivot for this column yet, which holds for the reducers of the symbolic preprocessing.
+	 * @param row A nonzero row.
+	 */
+	void add_pivot(Row&& row) {
+		assert(!row.entries.empty());
+		assert(!mPivots[row.leading_column()]);
+		normalize(row);
+		mPivots[row.leading_column()] = mRows.size();
+		mRows.emplace_back(std::move(row));
+	}
+
+	/**
+	 * Reduces a row by all pivots and stores the result as a new pivot.
+	 * @param row The row.
+	 * @return The column of the new pivot, or std::nullopt if the row was reduced to zero.
+	 */
+	std::optional<std::size_t> reduce(Row&& row) {
+		if (row.entries.empty()) return std::nullopt;
+		for (const auto& e: row.entries) {
+			mDense[e.first] = e.second;
+		}
+		Row res;
+		res.reasons = std::move(row.reasons);
+		// Pivots only have entries right of their column, hence a single sweep from left to right suffices.
+		for (std::size_t col = row.leading_column(); col < mDense.size(); ++col) {
+			if (mField.is_zero(mDense[col])) continue;
+			Element factor = std::move(mDense[col]);
+			mDense[col] = Element(0);
+			if (mPivots[col]) {
+				const Row& p = mRows[*mPivots[col]];
+				for (auto it = p.entries.begin() + 1; it != p.entries.end(); ++it) {
+					mDense[it->first] = mField.sub(mDense[it->first], mField.mul(factor, it->second));
+				}
+				res.reasons |= p.reasons;
+			} else {
+				res.entries.emplace_back(col, std::move(factor));
+			}
+		}
+		if (res.entries.empty()) return std::nullopt;
+		std::size_t col = res.leading_column();
+		normalize(res);
+		mPivots[col] = mRows.size();
+		mRows.emplace_back(std::move(res));
+		return col;
+	}
+};
+
+}
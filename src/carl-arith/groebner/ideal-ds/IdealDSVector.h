@@ -67,6 +67,13 @@ public:
                 continue;
             }
 			
+            if constexpr (Polynomial::Policy::packed_monomials) {
+                // Most candidates do not divide, reject them without creating a quotient.
+                if (t.monomial() && !Polynomial::Policy::divisible(t.monomial(), mGenerators[*it].lmon())) {
+                    ++it;
+                    continue;
+                }
+            }
             Term<typename Polynomial::CoeffType> divres;
 			if (t.divide(mGenerators[*it].lterm(), divres)) {
 				//Division succeeded, so we have found a divisor;
@@ -32,6 +32,7 @@
 #include "BoundType.h"
 #include "policies/checking.h"
 #include "policies/rounding.h"
+#include "policies/rounding_double.h"
 
 CLANG_WARNING_DISABLE("-Wunused-parameter")
 CLANG_WARNING_DISABLE("-Wunused-local-typedef")
@@ -73,12 +74,18 @@ namespace carl
 
     /**
      * Template specialization for rounding and checking policies for native double.
+     * By default, rounding<double> is used, which does not switch the rounding mode of the FPU.
+     * If INTERVAL_FPU_ROUNDING is set, the rounding policy of boost is used instead.
      */
     // TODO: Create struct specialization for all types which are already covered by the standard boost interval policies.
     template<typename Interval>
     struct policies<double, Interval>
     {
+#ifdef INTERVAL_FPU_ROUNDING
         using roundingP = boost::numeric::interval_lib::save_state<boost::numeric::interval_lib::rounded_transc_std<double> >; // TODO: change it to boost::numeric::interval_lib::rounded_transc_opp, if new boost release patches the bug with clang
+#else
+        using roundingP = carl::rounding<double>;
+#endif
         using checkingP = boost::numeric::interval_lib::checking_no_nan<double, boost::numeric::interval_lib::checking_no_nan<double> >;
 		static void sanitize(Interval& n) {
 			if (std::isinf(n.lower())) {
@@ -830,6 +830,8 @@ template<typename Num, EnableIf<std::is_floating_point<Num>>>
 Interval<Number> Interval<Number>::root(int deg) const
 	{
 		assert(this->is_consistent());
+        // The square root is rounded directly, while nth_root iterates Newton's method up to a fixpoint.
+        auto nth_root = [deg](const BoostInterval& i) { return deg == 2 ? boost::numeric::sqrt(i) : boost::numeric::nth_root(i, deg); };
         if( deg % 2 == 0 )
         {
             if( mUpperBoundType != BoundType::INFTY &&  mContent.upper() < carl::constant_zero<Number>().get() )
@@ -842,11 +844,11 @@ Interval<Number> Interval<Number>::root(int deg) const
                 }
                 else
                 {
-                    return Interval<Number>(boost::numeric::nth_root(BoostInterval(carl::constant_zero<Number>().get(),mContent.upper()), deg), BoundType::WEAK, mUpperBoundType);
+                    return Interval<Number>(nth_root(BoostInterval(carl::constant_zero<Number>().get(),mContent.upper())), BoundType::WEAK, mUpperBoundType);
                 }
             }
         }
-		return Interval<Number>(boost::numeric::nth_root(mContent, deg), mLowerBoundType, mUpperBoundType);
+		return Interval<Number>(nth_root(mContent), mLowerBoundType, mUpperBoundType);
 	}
 
 template<typename Number>
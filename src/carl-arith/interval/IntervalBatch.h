@@ -0,0 +1,160 @@
+/**
+ * @file IntervalBatch.h
+ */
+
+#pragma once
+
+#include "Interval.h"
+#include "policies/rounding_double.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+
+namespace carl {
+
+/**
+ * A fixed number of closed double intervals that are processed at once.
+ *
+ * The bounds are stored as separate arrays of lower and upper bounds.
+ * All operations round outward using the branch-free functions of rounding<double> and
+ * are written as plain loops over the lanes, such that the compiler can vectorize them, e.g. for four or eight lanes.
+ * The results coincide with the respective operations on Interval<double> (with the default rounding policy),
+ * as long as all bounds stay finite.
+ */
+template<std::size_t N>
+struct IntervalBatch {
+	std::array<double, N> lower;
+	std::array<double, N> upper;
+
+	IntervalBatch() = default;
+	/// Constructs a batch that holds the given interval in every lane.
+	explicit IntervalBatch(const Interval<double>& i) {
+		assert(is_batchable(i));
+		lower.fill(i.lower());
+		upper.fill(i.upper());
+	}
+
+	/// Checks whether an interval can be stored in a batch, i.e. is closed and bounded.
+	static bool is_batchable(const Interval<double>& i) {
+		return i.is_closed_interval() && rounding_double::is_finite(i.lower()) && rounding_double::is_finite(i.upper());
+	}
+
+	/// Stores an interval in the given lane.
+	void set(std::size_t lane, const Interval<double>& i) {
+		assert(lane < N && is_batchable(i));
+		lower[lane] = i.lower();
+		upper[lane] = i.upper();
+	}
+	/// Returns the interval of the given lane.
+	Interval<double> get(std::size_t lane) const {
+		assert(lane < N);
+		return Interval<double>(lower[lane], BoundType::WEAK, upper[lane], BoundType::WEAK);
+	}
+	/// Checks whether both bounds of the given lane are finite.
+	bool is_finite(std::size_t lane) const {
+		return rounding_double::is_finite(lower[lane]) & rounding_double::is_finite(upper[lane]);
+	}
+};
+
+template<std::size_t N>
+inline IntervalBatch<N> operator+(const IntervalBatch<N>& lhs, const IntervalBatch<N>& rhs) {
+	IntervalBatch<N> res;
+	for (std::size_t i = 0; i < N; ++i) {
+		res.lower[i] = rounding_double::add<false>(lhs.lower[i], rhs.lower[i]);
+		res.upper[i] = rounding_double::add<true>(lhs.upper[i], rhs.upper[i]);
+	}
+	return res;
+}
+
+template<std::size_t N>
+inline IntervalBatch<N> operator-(const IntervalBatch<N>& lhs, const IntervalBatch<N>& rhs) {
+	IntervalBatch<N> res;
+	for (std::size_t i = 0; i < N; ++i) {
+		res.lower[i] = rounding_double::add<false>(lhs.lower[i], -rhs.upper[i]);
+		res.upper[i] = rounding_double::add<true>(lhs.upper[i], -rhs.lower[i]);
+	}
+	return res;
+}
+
+/**
+ * Multiplies two batches.
+ * Instead of distinguishing the signs of the bounds, all four products are rounded in both directions.
+ * As rounding is monotonic, the minimum and maximum are the same as for the case distinction.
+ */
+template<std::size_t N>
+inline IntervalBatch<N> operator*(const IntervalBatch<N>& lhs, const IntervalBatch<N>& rhs) {
+	IntervalBatch<N> res;
+	for (std::size_t i = 0; i < N; ++i) {
+		double lld, llu, lud, luu, uld, ulu, uud, uuu;
+		rounding_double::mul_outward(lhs.lower[i], rhs.lower[i], lld, llu);
+		rounding_double::mul_outward(lhs.lower[i], rhs.upper[i], lud, luu);
+		rounding_double::mul_outward(lhs.upper[i], rhs.lower[i], uld, ulu);
+		rounding_double::mul_outward(lhs.upper[i], rhs.upper[i], uud, uuu);
+		res.lower[i] = std::min(std::min(lld, lud), std::min(uld, uud));
+		res.upper[i] = std::max(std::max(llu, luu), std::max(ulu, uuu));
+	}
+	return res;
+}
+
+namespace detail {
+	/// Computes x^exp for every lane by repeated squaring with the given rounding, as boost::numeric::pow() does for positive x.
+	template<bool Up, std::size_t N>
+	inline std::array<double, N> pow_rounded(std::array<double, N> x, uint exp) {
+		std::array<double, N> res;
+		for (std::size_t i = 0; i < N; ++i) {
+			res[i] = (exp & 1) ? x[i] : 1.0;
+		}
+		exp >>= 1;
+		while (exp > 0) {
+			for (std::size_t i = 0; i < N; ++i) {
+				x[i] = rounding_double::mul<Up>(x[i], x[i]);
+			}
+			if (exp & 1) {
+				for (std::size_t i = 0; i < N; ++i) {
+					res[i] = rounding_double::mul<Up>(x[i], res[i]);
+				}
+			}
+			exp >>= 1;
+		}
+		return res;
+	}
+}
+
+/**
+ * Computes the power of a batch.
+ * The sign cases of boost::numeric::pow() are evaluated for all lanes and the results are selected afterwards.
+ * @param b Batch.
+ * @param exp Exponent, at least one.
+ * @return b^exp.
+ */
+template<std::size_t N>
+inline IntervalBatch<N> pow(const IntervalBatch<N>& b, uint exp) {
+	assert(exp > 0);
+	std::array<double, N> base;
+	std::array<double, N> negLower;
+	for (std::size_t i = 0; i < N; ++i) {
+		base[i] = (b.upper[i] < 0) ? -b.upper[i] : b.lower[i];
+		negLower[i] = -b.lower[i];
+	}
+	// Lower bound if the interval does not contain zero in its interior.
+	auto pd = detail::pow_rounded<false>(base, exp);
+	// Upper bounds from both sides, each only meaningful if the bound has the respective sign.
+	auto pl = detail::pow_rounded<true>(negLower, exp);
+	auto pu = detail::pow_rounded<true>(b.upper, exp);
+	IntervalBatch<N> res;
+	for (std::size_t i = 0; i < N; ++i) {
+		bool negL = b.lower[i] < 0;
+		bool negU = b.upper[i] < 0;
+		if (exp & 1) {
+			res.lower[i] = negL ? -pl[i] : pd[i];
+			res.upper[i] = negU ? -pd[i] : pu[i];
+		} else {
+			res.lower[i] = (negL & !negU) ? 0.0 : pd[i];
+			res.upper[i] = negU ? pl[i] : (negL ? std::max(pl[i], pu[i]) : pu[i]);
+		}
+	}
+	return res;
+}
+
+}
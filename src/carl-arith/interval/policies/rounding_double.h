@@ -0,0 +1,225 @@
+/**
+ * This file contains the rounding policy needed from the boost interval class
+ * for native doubles, which does not change the rounding mode of the FPU.
+ *
+ * @file   rounding_double.h
+ */
+
+#pragma once
+
+#include "rounding.h"
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace carl
+{
+namespace rounding_double
+{
+	/// Results and errors below this magnitude may not be exactly representable, hence rounding is done conservatively.
+	constexpr double tiny = 0x1p-969;
+	constexpr double infinity = std::numeric_limits<double>::infinity();
+
+	/// Returns the smallest double larger than x, without branches.
+	inline double next_up(double x) {
+		std::uint64_t bits = std::bit_cast<std::uint64_t>(x);
+		// Positive numbers are incremented, negative numbers are decremented.
+		double res = std::bit_cast<double>(bits + 1 - ((bits >> 63) << 1));
+		res = (x == 0) ? std::numeric_limits<double>::denorm_min() : res;
+		return (x == infinity || x != x) ? x : res;
+	}
+	/// Returns the largest double smaller than x, without branches.
+	inline double next_down(double x) {
+		return -next_up(-x);
+	}
+	inline bool is_finite(double x) {
+		return x - x == 0;
+	}
+
+	/**
+	 * Computes the error of the product a * b, i.e. a * b - p for p = a * b rounded to nearest.
+	 * Uses a fused multiply-add if the hardware supports it and Dekker's TwoProduct otherwise,
+	 * as a fused multiply-add in software is slower than the whole rest of the operation.
+	 * If the operands are too large to be split, the result is NaN.
+	 */
+	inline double product_error(double a, double b, double p) {
+#ifdef __FMA__
+		return std::fma(a, b, -p);
+#else
+		constexpr double splitter = 134217729.0; // 2^27 + 1
+		double ca = splitter * a;
+		double ahi = ca - (ca - a);
+		double alo = a - ahi;
+		double cb = splitter * b;
+		double bhi = cb - (cb - b);
+		double blo = b - bhi;
+		return ((ahi * bhi - p) + ahi * blo + alo * bhi) + alo * blo;
+#endif
+	}
+
+	/**
+	 * Rounds the result of a + b, computed with rounding to nearest, in the given direction.
+	 * The rounding error is obtained exactly by TwoSum.
+	 */
+	template<bool Up>
+	inline double add(double a, double b) {
+		double s = a + b;
+		double bb = s - a;
+		double err = (a - (s - bb)) + (b - bb);
+		bool overflow = (s == (Up ? -infinity : infinity)) & is_finite(a) & is_finite(b);
+		if constexpr (Up) {
+			return ((err > 0) | overflow) ? next_up(s) : s;
+		} else {
+			return ((err < 0) | overflow) ? next_down(s) : s;
+		}
+	}
+	/**
+	 * Rounds the result of a * b, computed with rounding to nearest, in both directions.
+	 * The rounding error is obtained exactly by product_error().
+	 */
+	inline void mul_outward(double a, double b, double& down, double& up) {
+		double p = a * b;
+		double err = product_error(a, b, p);
+		bool finite = is_finite(a) & is_finite(b);
+		// The error can not be computed if the product is too small, or if the product or its operands are too large.
+		bool uncertain = ((std::abs(p) < tiny) & (a != 0) & (b != 0)) | ((err != err) & is_finite(p));
+		down = ((err < 0) | ((p == infinity) & finite) | uncertain) ? next_down(p) : p;
+		up = ((err > 0) | ((p == -infinity) & finite) | uncertain) ? next_up(p) : p;
+	}
+	/**
+	 * Rounds the result of a * b, computed with rounding to nearest, in the given direction.
+	 */
+	template<bool Up>
+	inline double mul(double a, double b) {
+		double down;
+		double up;
+		mul_outward(a, b, down, up);
+		return Up ? up : down;
+	}
+	/**
+	 * Rounds the result of a / b, computed with rounding to nearest, in the given direction.
+	 * The exact quotient is q + r / b for the remainder r = a - q * b, which is computed exactly using product_error().
+	 */
+	template<bool Up>
+	inline double div(double a, double b) {
+		double q = a / b;
+		double qb = q * b;
+		double r = (a - qb) - product_error(q, b, qb);
+		bool above = ((r > 0) & (b > 0)) | ((r < 0) & (b < 0));
+		bool below = ((r < 0) & (b > 0)) | ((r > 0) & (b < 0));
+		bool overflow = (q == (Up ? -infinity : infinity)) & is_finite(a) & is_finite(b) & (b != 0);
+		bool underflow = ((std::abs(q) < tiny) | (std::abs(a) < tiny)) & (a != 0) & is_finite(b);
+		bool unknown = (r != r) & is_finite(q) & is_finite(b) & (q != 0);
+		if constexpr (Up) {
+			return (above | overflow | underflow | unknown) ? next_up(q) : q;
+		} else {
+			return (below | overflow | underflow | unknown) ? next_down(q) : q;
+		}
+	}
+	/**
+	 * Rounds the square root of a, computed with rounding to nearest, in the given direction.
+	 * The rounding error is a - s * s, which is computed exactly using product_error().
+	 */
+	template<bool Up>
+	inline double sqrt(double a) {
+		double s = std::sqrt(a);
+		double ss = s * s;
+		double r = (a - ss) - product_error(s, s, ss);
+		bool underflow = (a < tiny) & (a > 0);
+		if constexpr (Up) {
+			return ((r > 0) | underflow) ? next_up(s) : s;
+		} else {
+			return ((r < 0) | underflow) ? next_down(s) : s;
+		}
+	}
+	/**
+	 * Widens the result of a function of the standard library by two ulps in the given direction.
+	 * This is sound if the standard library is accurate up to two ulps, as e.g. the glibc.
+	 */
+	template<bool Up>
+	inline double widen(double x) {
+		if constexpr (Up) {
+			return next_up(next_up(x));
+		} else {
+			return next_down(next_down(x));
+		}
+	}
+}
+
+	/**
+	 * Rounding policy for native doubles that works with the default rounding to nearest.
+	 *
+	 * The results of the basic operations (addition, subtraction, multiplication, division and square root)
+	 * are computed with rounding to nearest and their exact rounding error is obtained by error-free transformations.
+	 * If the error is nonzero, the result is moved by one ulp in the desired direction.
+	 * Hence the results coincide with directed rounding, except for results and errors in the range of subnormal numbers,
+	 * where the result is widened by one ulp in any case.
+	 *
+	 * As opposed to the policies of boost, the rounding mode of the FPU is neither changed nor saved and restored.
+	 * This avoids stalling the pipeline, does not affect other threads and all operations are free of branches,
+	 * which allows the compiler to vectorize loops over many intervals (see IntervalBatch).
+	 *
+	 * The functions of the standard library (exp, log, sin, ...) are widened by two ulps in both directions.
+	 */
+	template<>
+	struct rounding<double>
+	{
+		using unprotected_rounding = rounding<double>;
+
+		void init() {}
+
+		template<typename U>
+		double conv_down(const U& v) {
+			if constexpr (std::is_same_v<U, double> || std::is_same_v<U, float> || (std::is_integral_v<U> && sizeof(U) <= 4)) {
+				return static_cast<double>(v);
+			} else {
+				return rounding_double::next_down(static_cast<double>(v));
+			}
+		}
+		template<typename U>
+		double conv_up(const U& v) {
+			if constexpr (std::is_same_v<U, double> || std::is_same_v<U, float> || (std::is_integral_v<U> && sizeof(U) <= 4)) {
+				return static_cast<double>(v);
+			} else {
+				return rounding_double::next_up(static_cast<double>(v));
+			}
+		}
+
+		double add_down(double lhs, double rhs) { return rounding_double::add<false>(lhs, rhs); }
+		double add_up  (double lhs, double rhs) { return rounding_double::add<true>(lhs, rhs); }
+		double sub_down(double lhs, double rhs) { return rounding_double::add<false>(lhs, -rhs); }
+		double sub_up  (double lhs, double rhs) { return rounding_double::add<true>(lhs, -rhs); }
+		double mul_down(double lhs, double rhs) { return rounding_double::mul<false>(lhs, rhs); }
+		double mul_up  (double lhs, double rhs) { return rounding_double::mul<true>(lhs, rhs); }
+		double div_down(double lhs, double rhs) { return rounding_double::div<false>(lhs, rhs); }
+		double div_up  (double lhs, double rhs) { return rounding_double::div<true>(lhs, rhs); }
+		double sqrt_down(double val) { return rounding_double::sqrt<false>(val); }
+		double sqrt_up  (double val) { return rounding_double::sqrt<true>(val); }
+
+		double median(double lhs, double rhs) { return (lhs + rhs) / 2; }
+		double int_down(double val) { return std::floor(val); }
+		double int_up  (double val) { return std::ceil(val); }
+
+#define CARL_ROUNDING_DOUBLE_FUNCTION(f) \
+		double f##_down(double val) { return rounding_double::widen<false>(std::f(val)); } \
+		double f##_up  (double val) { return rounding_double::widen<true>(std::f(val)); }
+		CARL_ROUNDING_DOUBLE_FUNCTION(exp)
+		CARL_ROUNDING_DOUBLE_FUNCTION(log)
+		CARL_ROUNDING_DOUBLE_FUNCTION(sin)
+		CARL_ROUNDING_DOUBLE_FUNCTION(cos)
+		CARL_ROUNDING_DOUBLE_FUNCTION(tan)
+		CARL_ROUNDING_DOUBLE_FUNCTION(asin)
+		CARL_ROUNDING_DOUBLE_FUNCTION(acos)
+		CARL_ROUNDING_DOUBLE_FUNCTION(atan)
+		CARL_ROUNDING_DOUBLE_FUNCTION(sinh)
+		CARL_ROUNDING_DOUBLE_FUNCTION(cosh)
+		CARL_ROUNDING_DOUBLE_FUNCTION(tanh)
+		CARL_ROUNDING_DOUBLE_FUNCTION(asinh)
+		CARL_ROUNDING_DOUBLE_FUNCTION(acosh)
+		CARL_ROUNDING_DOUBLE_FUNCTION(atanh)
+#undef CARL_ROUNDING_DOUBLE_FUNCTION
+	};
+}
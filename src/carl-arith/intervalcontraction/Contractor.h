@@ -5,6 +5,7 @@
 #include <carl-arith/constraint/BasicConstraint.h>
 #include <carl-arith/interval/Interval.h>
 #include <carl-arith/poly/umvpoly/functions/IntervalEvaluation.h>
+#include <carl-arith/poly/umvpoly/functions/IntervalEvaluator.h>
 #include <carl-arith/interval/SetTheory.h>
 
 #include <algorithm>
@@ -135,14 +136,26 @@ public:
 	 */
 	template<typename Number>
 	std::vector<Interval<Number>> evaluate(const std::map<Variable, Interval<Number>>& assignment, const Interval<Number>& h = Interval<Number>(0,0)) const {
-		std::vector<Interval<Number>> res;
 		CARL_LOG_DEBUG("carl.contractor", "Evaluating on " << assignment);
 		auto num = carl::evaluate(numerator(), assignment);
 		CARL_LOG_DEBUG("carl.contractor", numerator() << " -> " << num);
+		if (!is_one(denominator())) {
+			return evaluate(num, carl::evaluate(denominator(), assignment), h);
+		}
+		return evaluate(num, Interval<Number>(1), h);
+	}
+
+	/**
+	 * Evaluate this contraction given the values of the numerator and the denominator.
+	 * The value of the denominator is ignored if the denominator is one.
+	 * @see evaluate(const std::map<Variable, Interval<Number>>&, const Interval<Number>&)
+	 */
+	template<typename Number>
+	std::vector<Interval<Number>> evaluate(Interval<Number> num, const Interval<Number>& den, const Interval<Number>& h) const {
+		std::vector<Interval<Number>> res;
 		num += h;
 		CARL_LOG_DEBUG("carl.contractor", "Subtracting " << h << " -> " << num);
 		if (!is_one(denominator())) {
-			auto den = carl::evaluate(denominator(), assignment);;
 			CARL_LOG_DEBUG("carl.contractor", denominator() << " -> " << den);
 			Interval<Number> resA;
 			Interval<Number> resB;
@@ -184,15 +197,23 @@ std::ostream& operator<<(std::ostream& os, const Evaluation<Polynomial>& e) {
 	return os;
 }
 
+/**
+ * Contracts the interval of a variable with respect to a constraint.
+ * Numerator and denominator of the evaluation are compiled to IntervalEvaluators, as they are evaluated many times.
+ */
 template<typename Origin, typename Polynomial, typename Number = double>
 class Contractor {
 private:
 	Evaluation<Polynomial> mEvaluation;
+	IntervalEvaluator<Number> mNumerator;
+	IntervalEvaluator<Number> mDenominator;
 	Interval<Number> mRelation;
 	Origin mOrigin;
 public:
 	Contractor(const Origin& origin, const BasicConstraint<Polynomial>& c, Variable v):
 		mEvaluation(c.lhs(), v),
+		mNumerator(mEvaluation.numerator()),
+		mDenominator(mEvaluation.denominator()),
 		mOrigin(origin)
 	{
 		switch (c.relation()) {
@@ -227,16 +248,42 @@ public:
 	const auto& origin() const {
 		return mOrigin;
 	}
+	/// The compiled numerator, its variables() determine the order of its values.
+	const IntervalEvaluator<Number>& numerator() const {
+		return mNumerator;
+	}
+	/// The compiled denominator, its variables() determine the order of its values.
+	const IntervalEvaluator<Number>& denominator() const {
+		return mDenominator;
+	}
+	/// The values the left-hand side may take according to the relation of the constraint.
+	const Interval<Number>& relation() const {
+		return mRelation;
+	}
 
 	std::vector<Interval<Number>> evaluate(const std::map<Variable, Interval<Number>>& assignment) const {
 		CARL_LOG_DEBUG("carl.contractor", "Evaluating " << mEvaluation << " on " << assignment);
-		return mEvaluation.evaluate(assignment, mRelation);
+		auto num = mNumerator.evaluate(assignment);
+		CARL_LOG_DEBUG("carl.contractor", mEvaluation.numerator() << " -> " << num);
+		return mEvaluation.evaluate(num, mDenominator.evaluate(assignment), mRelation);
 	}
 
 	std::vector<Interval<Number>> contract(const std::map<Variable, Interval<Number>>& assignment) const {
 		auto res = evaluate(assignment);
 		assert(assignment.find(mEvaluation.var()) != assignment.end());
-		auto cur = assignment.find(mEvaluation.var())->second;
+		return intersect(std::move(res), assignment.find(mEvaluation.var())->second);
+	}
+
+	/**
+	 * Contracts the interval cur of var() given the values of the numerator and the denominator.
+	 * Allows to evaluate numerator() and denominator() on other representations of the assignment.
+	 */
+	std::vector<Interval<Number>> contract(const Interval<Number>& num, const Interval<Number>& den, const Interval<Number>& cur) const {
+		return intersect(mEvaluation.evaluate(num, den, mRelation), cur);
+	}
+
+private:
+	static std::vector<Interval<Number>> intersect(std::vector<Interval<Number>> res, const Interval<Number>& cur) {
 		CARL_LOG_DEBUG("carl.contractor", "Intersecting " << res << " with " << cur);
 
 		std::size_t last = 0;
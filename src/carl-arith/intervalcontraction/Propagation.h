@@ -0,0 +1,285 @@
+#pragma once
+
+/**
+ * @file Propagation.h
+ * This file contains carl::contractor::Propagation, which contracts interval domains with respect to a set of constraints until a fixpoint is reached.
+ */
+
+#include "Contractor.h"
+#include <carl-arith/interval/Sampling.h>
+#include <carl-arith/poly/umvpoly/functions/Derivative.h>
+
+#include <algorithm>
+#include <deque>
+#include <limits>
+#include <map>
+#include <optional>
+#include <vector>
+
+namespace carl {
+namespace contractor {
+
+/**
+ * Contracts the domains of variables with respect to a set of constraints, similar to HC4.
+ *
+ * Every constraint is split into one Contractor per variable, called a projection.
+ * Variables are numbered densely and their domains are stored in a vector. The inputs of the compiled numerator and denominator
+ * of a projection are resolved to these numbers once, hence applying a projection does not look up variables in a map.
+ *
+ * Projections that may contract a domain are kept in a work queue. If a projection contracts the domain of its variable,
+ * all other projections that depend on this variable are queued, including weak projections of the same variable from other constraints.
+ * To bound the work on large sets of constraints, they are only queued if the contraction is significant:
+ * the domain became bounded on some side, or it shrank by at least the given fraction of its width
+ * (or, if the domain is unbounded, a finite bound moved by this fraction of its magnitude).
+ * Contractions of domains narrower than the given minimal width are not propagated, but their projections are still applied to detect conflicts.
+ *
+ * If the variable of a projection also occurs in the numerator or denominator, the projection is weak.
+ * In this case, the projection is followed by interval Newton steps on the whole constraint, which approximate box consistency as in BC4.
+ *
+ * Constraints with relation NEQ are ignored, as they can not contract a domain to an interval.
+ */
+template<typename Origin, typename Polynomial, typename Number = double>
+class Propagation {
+private:
+	struct Newton {
+		IntervalEvaluator<Number> value;
+		IntervalEvaluator<Number> derivative;
+		std::vector<std::size_t> valueSlots;
+		std::vector<std::size_t> derivativeSlots;
+	};
+	struct Projection {
+		Contractor<Origin, Polynomial, Number> contractor;
+		std::size_t var;
+		/// The variable indices of the inputs of the numerator and the denominator.
+		std::vector<std::size_t> numeratorSlots;
+		std::vector<std::size_t> denominatorSlots;
+		std::optional<Newton> newton;
+	};
+
+	std::vector<Variable> mVariables;
+	std::map<Variable, std::size_t> mIndices;
+	std::vector<Interval<Number>> mDomains;
+	std::vector<Projection> mProjections;
+	/// The projections that depend on a variable, including weak projections of this variable.
+	std::vector<std::vector<std::size_t>> mDependents;
+	std::deque<std::size_t> mQueue;
+	std::vector<bool> mQueued;
+	/// Buffer for the inputs of an evaluation.
+	std::vector<Interval<Number>> mValues;
+
+	Number mMinContraction;
+	Number mMinWidth;
+	std::optional<std::size_t> mConflict;
+	std::size_t mContractions = 0;
+
+	std::size_t index(Variable v) {
+		auto it = mIndices.find(v);
+		if (it != mIndices.end()) return it->second;
+		mIndices.emplace(v, mVariables.size());
+		mVariables.push_back(v);
+		mDomains.emplace_back(Interval<Number>::unbounded_interval());
+		mDependents.emplace_back();
+		return mVariables.size() - 1;
+	}
+
+	std::vector<std::size_t> slots(const std::vector<Variable>& vars) {
+		std::vector<std::size_t> res;
+		for (auto v: vars) {
+			res.push_back(index(v));
+		}
+		return res;
+	}
+
+	void enqueue(std::size_t projection) {
+		if (mQueued[projection]) return;
+		mQueued[projection] = true;
+		mQueue.push_back(projection);
+	}
+
+	/// Queues the projections that depend on var, except for the projection skip.
+	void enqueue_dependents(std::size_t var, std::size_t skip = std::numeric_limits<std::size_t>::max()) {
+		for (auto p: mDependents[var]) {
+			if (p != skip) enqueue(p);
+		}
+	}
+
+	/// Evaluates e on the current domains, using value for the variable var.
+	Interval<Number> evaluate(const IntervalEvaluator<Number>& e, const std::vector<std::size_t>& slots, std::size_t var, const Interval<Number>& value) {
+		mValues.clear();
+		for (auto s: slots) {
+			mValues.push_back(s == var ? value : mDomains[s]);
+		}
+		return e.evaluate(mValues);
+	}
+
+	/**
+	 * Performs an interval Newton step for the variable var with domain x.
+	 * For every x in the domain, p(x) = p(c) + p'(y) * (x - c) for some y in the domain, hence x - c lies in (h - p(c)) / p'(domain).
+	 */
+	Interval<Number> newton(const Newton& n, std::size_t var, const Interval<Number>& x, const Interval<Number>& h) {
+		if (x.is_unbounded() || x.is_point_interval()) return x;
+		Number c = carl::center(x);
+		auto value = evaluate(n.value, n.valueSlots, var, Interval<Number>(c));
+		auto derivative = evaluate(n.derivative, n.derivativeSlots, var, x);
+		Interval<Number> resA;
+		Interval<Number> resB;
+		Interval<Number> res;
+		if ((h - value).div_ext(derivative, resA, resB)) {
+			res = set_intersection(x, c + resA).convex_hull(set_intersection(x, c + resB));
+		} else {
+			res = set_intersection(x, c + resA);
+		}
+		CARL_LOG_DEBUG("carl.contractor", "Newton step for " << mVariables[var] << ": " << x << " -> " << res);
+		if (mVariables[var].type() == VariableType::VT_INT) {
+			res = res.integral_part();
+		}
+		return res;
+	}
+
+	/// Applies a projection and returns the contracted domain of its variable.
+	Interval<Number> apply(const Projection& p) {
+		const Interval<Number> cur = mDomains[p.var];
+		auto num = evaluate(p.contractor.numerator(), p.numeratorSlots, p.var, cur);
+		auto den = evaluate(p.contractor.denominator(), p.denominatorSlots, p.var, cur);
+		Interval<Number> res = Interval<Number>::empty_interval();
+		for (const auto& i: p.contractor.contract(num, den, cur)) {
+			res = res.convex_hull(i);
+		}
+		if (!p.newton) return res;
+		// The projection does not queue itself, hence iterate the Newton step while it contracts significantly.
+		while (!res.is_empty() && !res.is_unbounded() && res.diameter() >= mMinWidth) {
+			auto next = newton(*p.newton, p.var, res, p.contractor.relation());
+			bool significant = next.is_empty() || is_significant(res, next);
+			res = next;
+			if (!significant) break;
+		}
+		return res;
+	}
+
+	/// Checks whether contracting old to res is worth propagating.
+	bool is_significant(const Interval<Number>& old, const Interval<Number>& res) const {
+		if (old.lower_bound_type() == BoundType::INFTY && res.lower_bound_type() != BoundType::INFTY) return true;
+		if (old.upper_bound_type() == BoundType::INFTY && res.upper_bound_type() != BoundType::INFTY) return true;
+		if (!old.is_unbounded()) {
+			return old.diameter() - res.diameter() >= mMinContraction * old.diameter();
+		}
+		Number one = carl::constant_one<Number>::get();
+		if (old.lower_bound_type() != BoundType::INFTY && res.lower() - old.lower() >= mMinContraction * std::max(one, carl::abs(old.lower()))) return true;
+		if (old.upper_bound_type() != BoundType::INFTY && old.upper() - res.upper() >= mMinContraction * std::max(one, carl::abs(old.upper()))) return true;
+		return false;
+	}
+
+public:
+	/**
+	 * @param minContraction The fraction by which a domain has to shrink such that the contraction is propagated.
+	 * @param minWidth The width below which domains are not contracted any further.
+	 */
+	explicit Propagation(const Number& minContraction = Number(1) / Number(100), const Number& minWidth = Number(1) / Number(1000000)):
+		mMinContraction(minContraction), mMinWidth(minWidth)
+	{}
+
+	/**
+	 * Adds the projections of a constraint and queues them.
+	 */
+	void add(const Origin& origin, const BasicConstraint<Polynomial>& c) {
+		if (c.relation() == Relation::NEQ) return;
+		for (auto v: carl::variables(c.lhs())) {
+			std::size_t id = mProjections.size();
+			Contractor<Origin, Polynomial, Number> contractor(origin, c, v);
+			std::size_t var = index(v);
+			auto numeratorSlots = slots(contractor.numerator().variables());
+			auto denominatorSlots = slots(contractor.denominator().variables());
+			std::optional<Newton> newton;
+			const auto& dependees = contractor.dependees();
+			if (std::find(dependees.begin(), dependees.end(), v) != dependees.end()) {
+				IntervalEvaluator<Number> value(c.lhs());
+				IntervalEvaluator<Number> derivative(carl::derivative(c.lhs(), v));
+				auto valueSlots = slots(value.variables());
+				auto derivativeSlots = slots(derivative.variables());
+				newton = Newton{ std::move(value), std::move(derivative), std::move(valueSlots), std::move(derivativeSlots) };
+			}
+			for (auto d: dependees) {
+				mDependents[index(d)].push_back(id);
+			}
+			mProjections.push_back(Projection{ std::move(contractor), var, std::move(numeratorSlots), std::move(denominatorSlots), std::move(newton) });
+			mQueued.push_back(false);
+			enqueue(id);
+		}
+	}
+
+	/**
+	 * Restricts the domain of a variable and queues the projections that depend on it.
+	 */
+	void set_domain(Variable v, const Interval<Number>& domain) {
+		assert(!domain.is_empty());
+		std::size_t var = index(v);
+		mDomains[var] = domain;
+		enqueue_dependents(var);
+	}
+
+	/**
+	 * Applies queued projections until the queue is empty, a domain becomes empty or limit projections have been applied.
+	 * @return false if a domain became empty, i.e. the constraints are unsatisfiable within the initial domains.
+	 */
+	bool propagate(std::size_t limit = std::numeric_limits<std::size_t>::max()) {
+		for (std::size_t i = 0; i < limit && !mConflict && !mQueue.empty(); ++i) {
+			std::size_t id = mQueue.front();
+			mQueue.pop_front();
+			mQueued[id] = false;
+			const auto& p = mProjections[id];
+			const auto& old = mDomains[p.var];
+			++mContractions;
+			auto res = apply(p);
+			if (res.is_empty()) {
+				CARL_LOG_DEBUG("carl.contractor", "Conflict for " << mVariables[p.var] << " from " << p.contractor.origin());
+				mConflict = id;
+			} else if (res != old) {
+				CARL_LOG_DEBUG("carl.contractor", "Contracted " << mVariables[p.var] << ": " << old << " -> " << res);
+				bool narrow = !old.is_unbounded() && old.diameter() < mMinWidth;
+				bool significant = !narrow && is_significant(old, res);
+				mDomains[p.var] = res;
+				if (significant) enqueue_dependents(p.var, id);
+			}
+		}
+		return !mConflict;
+	}
+
+	/// Returns the current domain of v, which is unbounded if v does not occur in any constraint.
+	Interval<Number> domain(Variable v) const {
+		auto it = mIndices.find(v);
+		if (it == mIndices.end()) return Interval<Number>::unbounded_interval();
+		return mDomains[it->second];
+	}
+
+	/// Returns the current domains of all variables.
+	std::map<Variable, Interval<Number>> domains() const {
+		std::map<Variable, Interval<Number>> res;
+		for (std::size_t i = 0; i < mVariables.size(); ++i) {
+			res.emplace(mVariables[i], mDomains[i]);
+		}
+		return res;
+	}
+
+	/// Checks whether no projection is queued, i.e. propagate() has reached a fixpoint.
+	bool is_fixpoint() const {
+		return mQueue.empty();
+	}
+
+	bool is_conflict() const {
+		return mConflict.has_value();
+	}
+
+	/// Returns the origin of the constraint that emptied a domain.
+	const Origin& conflict() const {
+		assert(is_conflict());
+		return mProjections[*mConflict].contractor.origin();
+	}
+
+	/// Returns the number of projections that have been applied.
+	std::size_t contractions() const {
+		return mContractions;
+	}
+};
+
+}
+}
@@ -81,4 +81,56 @@ const T& PrimeFactory<T>::next_prime() {
     return mPrimes[mNext++];
 }
 
+/**
+ * This class enumerates primes that fit into a machine word, for use in modular algorithms.
+ * The primes are enumerated downwards, starting at the largest prime below 2^31, such that the product of two residues always fits into 64 bits.
+ */
+class WordPrimeFactory
+{
+	uint mCurrent = uint(1) << 31;
+
+	static uint pow_mod(uint base, uint exp, uint mod) {
+		uint res = 1;
+		base %= mod;
+		while (exp > 0) {
+			if (exp & 1) res = (res * base) % mod;
+			base = (base * base) % mod;
+			exp >>= 1;
+		}
+		return res;
+	}
+public:
+	/// Deterministic Miller-Rabin test, sufficient for all n < 3215031751.
+	static bool is_prime(uint n) {
+		if (n < 2) return false;
+		for (uint p: {2, 3, 5, 7}) {
+			if (n % p == 0) return n == p;
+		}
+		uint d = n - 1;
+		std::size_t s = 0;
+		while ((d & 1) == 0) {
+			d >>= 1;
+			++s;
+		}
+		for (uint a: {2, 3, 5, 7}) {
+			uint x = pow_mod(a, d, n);
+			if (x == 1 || x == n - 1) continue;
+			bool composite = true;
+			for (std::size_t r = 1; r < s && composite; ++r) {
+				x = (x * x) % n;
+				if (x == n - 1) composite = false;
+			}
+			if (composite) return false;
+		}
+		return true;
+	}
+	/// Computes the next (smaller) prime and returns it.
+	uint next_prime() {
+		do {
+			--mCurrent;
+		} while (!is_prime(mCurrent));
+		return mCurrent;
+	}
+};
+
 }
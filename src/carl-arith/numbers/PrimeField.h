@@ -0,0 +1,147 @@
+/**
+ * @file PrimeField.h
+ *
+ * Word-size prime field arithmetic for modular algorithms.
+ */
+
+#pragma once
+
+#include "numbers.h"
+
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+namespace carl {
+
+/**
+ * The prime field Z_p for a prime p < 2^31.
+ *
+ * Contrary to GaloisField and GFNumber, elements are plain machine words in [0, p) that do not carry a reference to their field.
+ * All operations are performed by the field object, products are reduced using Barrett reduction with a precomputed reciprocal of p.
+ * As p < 2^31, the sum of three products of two elements still fits into 64 bits, which allows for delayed reductions in polynomial kernels.
+ */
+class PrimeField {
+public:
+	/// Type of a field element.
+	using Element = std::uint32_t;
+private:
+	/// The characteristic.
+	Element mP;
+	/// Barrett constant floor((2^64 - 1) / p).
+	std::uint64_t mBarrett;
+	/// Optional table of inverses, indexed by the element.
+	std::vector<Element> mInverses;
+public:
+	/**
+	 * Creates the field Z_p.
+	 * @param p A prime number below 2^31.
+	 * @param precompute_inverses If set, a table of all inverses is computed. This is only sensible for small p.
+	 */
+	explicit PrimeField(uint p, bool precompute_inverses = false):
+		mP(static_cast<Element>(p)),
+		mBarrett(~std::uint64_t(0) / p)
+	{
+		assert(p > 1 && p < (uint(1) << 31));
+		if (precompute_inverses) {
+			mInverses.resize(mP, 0);
+			mInverses[1] = 1;
+			for (Element i = 2; i < mP; ++i) {
+				// inv(i) = -(p / i) * inv(p mod i)
+				mInverses[i] = mul(mP - mP / i, mInverses[mP % i]);
+			}
+		}
+	}
+
+	/// Returns the characteristic.
+	Element p() const noexcept {
+		return mP;
+	}
+
+	/// Reduces an arbitrary 64 bit number modulo p.
+	Element reduce(std::uint64_t n) const {
+		std::uint64_t q = static_cast<std::uint64_t>((static_cast<unsigned __int128>(n) * mBarrett) >> 64);
+		std::uint64_t r = n - q * mP;
+		while (r >= mP) r -= mP;
+		return static_cast<Element>(r);
+	}
+	/// Reduces a signed number modulo p.
+	Element from_signed(sint n) const {
+		if (n >= 0) return reduce(static_cast<std::uint64_t>(n));
+		return neg(reduce(static_cast<std::uint64_t>(-(n + 1)) + 1));
+	}
+	/// Reduces an integer modulo p.
+	Element reduce(const mpz_class& n) const {
+		return static_cast<Element>(mpz_fdiv_ui(n.get_mpz_t(), mP));
+	}
+	/// Returns the symmetric representative of a in (-p/2, p/2].
+	sint symmetric(Element a) const {
+		if (2 * std::uint64_t(a) > mP) return sint(a) - sint(mP);
+		return sint(a);
+	}
+
+	Element add(Element a, Element b) const {
+		Element r = a + b;
+		return r >= mP ? r - mP : r;
+	}
+	Element sub(Element a, Element b) const {
+		return a >= b ? a - b : a + (mP - b);
+	}
+	Element neg(Element a) const {
+		return a == 0 ? 0 : mP - a;
+	}
+	Element mul(Element a, Element b) const {
+		return reduce(std::uint64_t(a) * b);
+	}
+	Element pow(Element a, uint e) const {
+		Element res = 1;
+		while (e > 0) {
+			if (e & 1) res = mul(res, a);
+			a = mul(a, a);
+			e >>= 1;
+		}
+		return res;
+	}
+	/// Computes the inverse of a nonzero element, either from the table or by the extended euclidean algorithm.
+	Element inv(Element a) const {
+		assert(a != 0);
+		if (!mInverses.empty()) return mInverses[a];
+		sint t = 0;
+		sint newt = 1;
+		sint r = mP;
+		sint newr = a;
+		while (newr != 0) {
+			sint q = r / newr;
+			sint tmp = t - q * newt;
+			t = newt;
+			newt = tmp;
+			tmp = r - q * newr;
+			r = newr;
+			newr = tmp;
+		}
+		assert(r == 1);
+		return t < 0 ? static_cast<Element>(t + mP) : static_cast<Element>(t);
+	}
+	Element div(Element a, Element b) const {
+		return mul(a, inv(b));
+	}
+
+	bool is_zero(Element a) const {
+		return a == 0;
+	}
+	/// Divides a by b, for compatibility with generic algorithms over exact domains.
+	bool try_divide(Element a, Element b, Element& res) const {
+		if (b == 0) return false;
+		res = div(a, b);
+		return true;
+	}
+
+	friend bool operator==(const PrimeField& lhs, const PrimeField& rhs) {
+		return lhs.mP == rhs.mP;
+	}
+	friend std::ostream& operator<<(std::ostream& os, const PrimeField& rhs) {
+		return os << "GF(" << rhs.mP << ")";
+	}
+};
+
+}
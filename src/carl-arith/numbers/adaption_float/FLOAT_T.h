@@ -19,6 +19,7 @@ static_assert(false, "This file may only be included indirectly by numbers.h");
 #include <carl-common/meta/SFINAE.h>
 #include "roundingConversion.h"
 
+#include <bit>
 #include <cfloat>
 #include <cmath>
 #include <cstddef>
@@ -91,12 +92,12 @@ namespace carl
 		// Make sure maxUlps is non-negative and small enough that the
 		// default NAN won't compare as equal to anything.
 		assert(maxUlps > 0 && maxUlps < 4 * 1024 * 1024);
-		sint aInt = *reinterpret_cast<const sint*>(&A);
+		sint aInt = std::bit_cast<sint>(A);
 		// Make aInt lexicographically ordered as a twos-complement int
 		if (aInt < 0)
 			aInt = static_cast<sint>(0x8000000000000000) - aInt;
 		// Make bInt lexicographically ordered as a twos-complement int
-		sint bInt = *reinterpret_cast<const sint*>(&B);
+		sint bInt = std::bit_cast<sint>(B);
 		if (bInt < 0)
 			bInt = static_cast<sint>(0x8000000000000000) - bInt;
 		auto intDiff = static_cast<uint>(std::abs(aInt - bInt));
@@ -1,10 +1,9 @@
+#include <carl-common/config.h>
+#ifdef USE_LIBPOLY
 #include "LPPolynomial.h"
 #include "helper.h"
 #include <poly/variable_list.h>
 
-#include <carl-common/config.h>
-#ifdef USE_LIBPOLY
-
 namespace carl {
 
 LPPolynomial::LPPolynomial(const LPPolynomial& rhs)
@@ -5,6 +5,12 @@
 #ifdef USE_LIBPOLY
 
 
+#ifdef THREAD_SAFE
+#define LPVARIABLES_LOCK_GUARD std::lock_guard<std::mutex> lock(mutex);
+#else
+#define LPVARIABLES_LOCK_GUARD
+#endif
+
 namespace carl {
 
 LPVariables::LPVariables() {
@@ -22,13 +28,15 @@ LPVariables::~LPVariables() {
 
 
 std::optional<carl::Variable> LPVariables::carl_variable(lp_variable_t var) const {
+    LPVARIABLES_LOCK_GUARD
     auto it = vars_libpoly_carl.find(var);
     if(it == vars_libpoly_carl.end()) return std::nullopt;
     CARL_LOG_TRACE("carl.poly", "Mapping libpoly variable " << lp_variable_db_get_name(lp_var_db, var) << " (" << var << ") -> " << it->second << " (" << it->second.id() << ")");
     return it->second;
 }
 
-std::optional<lp_variable_t> LPVariables::lp_variable_opt(carl::Variable var) const {    
+std::optional<lp_variable_t> LPVariables::lp_variable_opt(carl::Variable var) const {
+    LPVARIABLES_LOCK_GUARD
     auto it = vars_carl_libpoly.find(var);
     if(it == vars_carl_libpoly.end()) return std::nullopt;
     CARL_LOG_TRACE("carl.poly", "Mapping carl variable " << var << " (" << var.id() << ") -> " << lp_variable_db_get_name(lp_var_db, it->second) << " (" << it->second << ")");
@@ -36,6 +44,7 @@ std::optional<lp_variable_t> LPVariables::lp_variable_opt(carl::Variable var) co
 }
 
 lp_variable_t LPVariables::lp_variable(carl::Variable var) {
+    LPVARIABLES_LOCK_GUARD
     auto it = vars_carl_libpoly.find(var);
     if(it != vars_carl_libpoly.end()) {
         CARL_LOG_TRACE("carl.poly", "Mapping carl variable " << var << " (" << var.id() << ") -> " << lp_variable_db_get_name(lp_var_db, it->second) << " (" << it->second << ")");
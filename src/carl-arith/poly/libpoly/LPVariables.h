@@ -5,6 +5,7 @@
 
 #include <carl-common/memory/Singleton.h>
 #include <map>
+#include <mutex>
 #include <optional>
 #include "../../core/Variable.h"
 #include <poly/poly.h>
@@ -20,6 +21,8 @@ class LPVariables : public Singleton<LPVariables> {
     std::map<carl::Variable, lp_variable_t> vars_carl_libpoly;
     // mapping from libpoly variables to carl variables
     std::map<lp_variable_t, carl::Variable> vars_libpoly_carl;
+    // protects the mappings if THREAD_SAFE is set
+    mutable std::mutex mutex;
 
 public:
     lp_variable_db_t* lp_var_db;
@@ -0,0 +1,82 @@
+/**
+ * @file HeapMultiplication.h
+ * @ingroup multirp
+ *
+ * Heap-based multiplication of sparse polynomials.
+ */
+
+#pragma once
+
+#include "Term.h"
+#include <carl-arith/numbers/numbers.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace carl
+{
+	/**
+	 * Multiplies two sparse polynomials given as sequences of terms that are sorted ascendingly with respect to Ordering.
+	 *
+	 * Implements the algorithm by Johnson as described in @cite MP09:
+	 * the terms of the product are generated in descending order by a heap that contains (at most) one candidate product for every term of the shorter factor.
+	 * Products with the same monomial are popped consecutively and their coefficients are summed up immediately.
+	 * Hence the result is fully ordered and the only scratch space is the heap of size `min(|lhs|, |rhs|)`.
+	 *
+	 * The ordering must be compatible with the multiplication of monomials, which holds for all monomial orderings.
+	 * @param lhs Terms of the first factor, sorted ascendingly, without zero terms.
+	 * @param rhs Terms of the second factor, sorted ascendingly, without zero terms.
+	 * @param result Terms of the product, sorted ascendingly, without zero terms.
+	 */
+	template<typename Ordering, typename Coeff>
+	void heap_multiply(const std::vector<Term<Coeff>>& lhs, const std::vector<Term<Coeff>>& rhs, std::vector<Term<Coeff>>& result) {
+		result.clear();
+		if (lhs.empty() || rhs.empty()) return;
+		const auto& outer = (lhs.size() <= rhs.size()) ? lhs : rhs;
+		const auto& inner = (lhs.size() <= rhs.size()) ? rhs : lhs;
+		// Indices count from the largest term.
+		auto outerTerm = [&outer](std::size_t i) -> const Term<Coeff>& { return outer[outer.size() - 1 - i]; };
+		auto innerTerm = [&inner](std::size_t j) -> const Term<Coeff>& { return inner[inner.size() - 1 - j]; };
+
+		struct Entry {
+			Monomial::Arg monomial;
+			std::size_t i;
+			std::size_t j;
+		};
+		auto product = [&](std::size_t i, std::size_t j) {
+			return Entry({ outerTerm(i).monomial() * innerTerm(j).monomial(), i, j });
+		};
+		auto less = [](const Entry& e1, const Entry& e2) {
+			return Ordering::less(e1.monomial, e2.monomial);
+		};
+
+		std::vector<Entry> heap;
+		heap.reserve(outer.size());
+		heap.push_back(product(0, 0));
+		while (!heap.empty()) {
+			Monomial::Arg monomial = heap.front().monomial;
+			Coeff coeff = constant_zero<Coeff>::get();
+			while (!heap.empty() && heap.front().monomial == monomial) {
+				std::pop_heap(heap.begin(), heap.end(), less);
+				std::size_t i = heap.back().i;
+				std::size_t j = heap.back().j;
+				coeff += outerTerm(i).coeff() * innerTerm(j).coeff();
+				if (j + 1 < inner.size()) {
+					heap.back() = product(i, j + 1);
+					std::push_heap(heap.begin(), heap.end(), less);
+				} else {
+					heap.pop_back();
+				}
+				// Row i+1 is only needed once the largest product of row i is gone.
+				if (j == 0 && i + 1 < outer.size()) {
+					heap.push_back(product(i + 1, 0));
+					std::push_heap(heap.begin(), heap.end(), less);
+				}
+			}
+			if (!carl::is_zero(coeff)) {
+				result.emplace_back(std::move(coeff), std::move(monomial));
+			}
+		}
+		std::reverse(result.begin(), result.end());
+	}
+}
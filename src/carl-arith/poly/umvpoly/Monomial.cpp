@@ -13,6 +13,11 @@ namespace carl
 	Monomial::~Monomial() {
 		CARL_LOG_TRACE("carl.core.monomial", "Freeing " << *this);
 		MonomialPool::getInstance().free(this);
+		#ifdef THREAD_SAFE
+		delete mPacked.load(std::memory_order_acquire);
+		#else
+		delete mPacked;
+		#endif
 	}
 	Monomial::Arg Monomial::drop_variable(Variable v) const
 	{
@@ -148,7 +153,7 @@ namespace carl
 		return createMonomial(std::move(newExps), mTotalDegree / 2);
 	}
 	
-	Monomial::Arg Monomial::lcm(const std::shared_ptr<const Monomial>& lhs, const std::shared_ptr<const Monomial>& rhs)
+	Monomial::Arg Monomial::lcm(const Monomial::Arg& lhs, const Monomial::Arg& rhs)
 	{
 		if (!lhs && !rhs) return nullptr;
 		if (!lhs) return rhs;
@@ -170,7 +175,7 @@ namespace carl
 			{
 				// Insert remaining part
 				newExps.insert(newExps.end(), itleft, lhs->mExponents.end());
-				std::shared_ptr<const Monomial> result = MonomialPool::getInstance().create( std::move(newExps), expsum );
+				Monomial::Arg result = MonomialPool::getInstance().create( std::move(newExps), expsum );
 				CARL_LOG_TRACE("carl.core.monomial", "Result: " << result);
 				return result;
 			}
@@ -199,11 +204,21 @@ namespace carl
 		}
 		 // Insert remaining part
 		newExps.insert(newExps.end(), itright, rhs->mExponents.end());
-		std::shared_ptr<const Monomial> result = MonomialPool::getInstance().create( std::move(newExps), expsum );
+		Monomial::Arg result = MonomialPool::getInstance().create( std::move(newExps), expsum );
 		CARL_LOG_TRACE("carl.core.monomial", "Result: " << result);
 		return result;
 	}
 	
+	Monomial::Arg Monomial::lcm_packed(const Monomial::Arg& lhs, const Monomial::Arg& rhs)
+	{
+		if (!lhs || !rhs || !lhs->packed().valid() || !rhs->packed().valid()) return lcm(lhs, rhs);
+		if (lhs == rhs || rhs->packed().divisible(lhs->packed())) return rhs;
+		if (lhs->packed().divisible(rhs->packed())) return lhs;
+		Content newExps;
+		std::size_t tdeg = PackedExponents::lcm(lhs->packed(), lhs->mExponents, rhs->packed(), rhs->mExponents, newExps);
+		return MonomialPool::getInstance().create(std::move(newExps), tdeg);
+	}
+
 	bool Monomial::is_consistent() const
 	{
 		CARL_LOG_FUNC("carl.core.monomial", mExponents << ", " << mTotalDegree << ", " << mHash);
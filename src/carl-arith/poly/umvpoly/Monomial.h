@@ -7,20 +7,24 @@
 
 #pragma once
 
+#include <carl-common/config.h>
 #include <carl-common/util/hash.h>
 #include <carl-arith/numbers/numbers.h>
 #include <carl-arith/core/CompareResult.h>
 #include <carl-arith/core/Variable.h>
 #include <carl-arith/core/Variables.h>
 #include <carl-arith/core/VariablePool.h>
+#include "PackedExponents.h"
 
 #include <algorithm>
+#include <atomic>
 #include <list>
 #include <numeric>
 #include <set>
 #include <sstream>
 
 #include <boost/intrusive/unordered_set.hpp>
+#include <boost/intrusive_ptr.hpp>
 
 
 namespace carl
@@ -39,6 +43,10 @@ namespace carl
 		return p.first == v;
 	}
 
+	class Monomial;
+	void intrusive_ptr_add_ref(const Monomial* m);
+	void intrusive_ptr_release(const Monomial* m);
+
 	/**
 	 * The general-purpose monomials. Notice that we aim to keep this object as small as possbible,
 	 * while also limiting the use of expensive language features such as RTTI, exceptions and even
@@ -58,8 +66,14 @@ namespace carl
 	class Monomial final : public boost::intrusive::unordered_set_base_hook<>
 	{
 		friend class MonomialPool;
+		friend void intrusive_ptr_add_ref(const Monomial* m);
+		friend void intrusive_ptr_release(const Monomial* m);
 	public:
-		using Arg = std::shared_ptr<const Monomial>;
+		/**
+		 * Handle to a pooled monomial.
+		 * The reference count is stored within the monomial, hence a handle is a single pointer and copying it needs no control block.
+		 */
+		using Arg = boost::intrusive_ptr<const Monomial>;
 		using Content = std::vector<std::pair<Variable, std::size_t>>;
 		~Monomial();
 
@@ -82,7 +96,38 @@ namespace carl
 		using exponents_it = Content::iterator ;
 		using exponents_cIt = Content::const_iterator;
 
-		mutable std::weak_ptr<const Monomial> mWeakPtr;
+		#ifdef THREAD_SAFE
+		using RefCount = std::atomic<std::size_t>;
+		using PackedPtr = std::atomic<const PackedExponents*>;
+		#else
+		using RefCount = std::size_t;
+		using PackedPtr = const PackedExponents*;
+		#endif
+		/// Packed copy of the exponents, see PackedExponents. Only computed by packed(), as only the packed orderings and policies use it.
+		mutable PackedPtr mPacked = nullptr;
+		/// Number of handles to this monomial.
+		mutable RefCount mRefCount = 0;
+		/// Immortal monomials are never freed and are not reference counted.
+		bool mImmortal = false;
+
+		/**
+		 * Increments the reference count unless it has already dropped to zero, i.e. the monomial is about to be freed.
+		 * @return If a reference was acquired.
+		 */
+		bool try_add_ref() const {
+			if (mImmortal) return true;
+			#ifdef THREAD_SAFE
+			std::size_t count = mRefCount.load(std::memory_order_relaxed);
+			while (count != 0) {
+				if (mRefCount.compare_exchange_weak(count, count + 1, std::memory_order_acquire, std::memory_order_relaxed)) return true;
+			}
+			return false;
+			#else
+			if (mRefCount == 0) return false;
+			++mRefCount;
+			return true;
+			#endif
+		}
 
 		/**
 		 * Calculates the hash and stores it to mHash.
@@ -189,6 +234,31 @@ namespace carl
 		const Content& exponents() const {
 			return mExponents;
 		}
+
+		/**
+		 * Returns the packed representation of the exponents, which is computed on the first call.
+		 * It may be invalid if the monomial is too large to be packed.
+		 * @return Packed exponents.
+		 */
+		const PackedExponents& packed() const {
+			#ifdef THREAD_SAFE
+			const PackedExponents* packed = mPacked.load(std::memory_order_acquire);
+			if (packed == nullptr) {
+				const PackedExponents* fresh = new PackedExponents(mExponents, mTotalDegree);
+				if (mPacked.compare_exchange_strong(packed, fresh, std::memory_order_acq_rel, std::memory_order_acquire)) {
+					packed = fresh;
+				} else {
+					delete fresh;
+				}
+			}
+			return *packed;
+			#else
+			if (mPacked == nullptr) {
+				mPacked = new PackedExponents(mExponents, mTotalDegree);
+			}
+			return *mPacked;
+			#endif
+		}
 		
 		/**
 		 * Checks whether the monomial is a constant.
@@ -358,6 +428,18 @@ namespace carl
 			// If there remain variables in the m, it fails.
 			return itright == m->mExponents.end();
 		}
+		/**
+		 * Checks if this monomial is divisible by the given monomial m.
+		 * Uses the packed representation if both monomials could be packed and falls back to divisible() otherwise.
+		 * @param m Monomial.
+		 * @return If this is divisible by m.
+		 */
+		bool divisible_packed(const Monomial::Arg& m) const
+		{
+			if(!m) return true;
+			if(packed().valid() && m->packed().valid()) return packed().divisible(m->packed());
+			return divisible(m);
+		}
 		/**
 		 * Returns a new monomial that is this monomial divided by m.
 		 * Returns a pair of a monomial pointer and a bool.
@@ -416,6 +498,40 @@ namespace carl
 			return lexicalCompare(*lhs, *rhs);
 		}
 		
+		/**
+		 * Same as compareLexical(), but uses the packed representation if possible.
+		 */
+		static CompareResult compareLexicalPacked(const Monomial::Arg& lhs, const Monomial::Arg& rhs)
+		{
+			if( !lhs && !rhs )
+				return CompareResult::EQUAL;
+			if( !lhs )
+				return CompareResult::LESS;
+			if( !rhs )
+				return CompareResult::GREATER;
+			if(lhs->packed().valid() && rhs->packed().valid())
+				return PackedExponents::compare_lexical(lhs->packed(), rhs->packed());
+			return lexicalCompare(*lhs, *rhs);
+		}
+
+		/**
+		 * Same as compareGradedLexical(), but uses the packed representation if possible.
+		 */
+		static CompareResult compareGradedLexicalPacked(const Monomial::Arg& lhs, const Monomial::Arg& rhs)
+		{
+			if( !lhs && !rhs )
+				return CompareResult::EQUAL;
+			if( !lhs )
+				return CompareResult::LESS;
+			if( !rhs )
+				return CompareResult::GREATER;
+			if(lhs->mTotalDegree < rhs->mTotalDegree) return CompareResult::LESS;
+			if(lhs->mTotalDegree > rhs->mTotalDegree) return CompareResult::GREATER;
+			if(lhs->packed().valid() && rhs->packed().valid())
+				return PackedExponents::compare_lexical(lhs->packed(), rhs->packed());
+			return lexicalCompare(*lhs, *rhs);
+		}
+
 		static CompareResult compareGradedLexical(const Monomial::Arg& lhs, Variable rhs)
 		{
 			if(!lhs) return CompareResult::LESS;
@@ -436,6 +552,14 @@ namespace carl
 		 * @return lcm of lhs and rhs.
 		 */
 		static Monomial::Arg lcm(const Monomial::Arg& lhs, const Monomial::Arg& rhs);
+
+		/**
+		 * Same as lcm(), but uses the packed representation if possible.
+		 * @param lhs First monomial.
+		 * @param rhs Second monomial.
+		 * @return lcm of lhs and rhs.
+		 */
+		static Monomial::Arg lcm_packed(const Monomial::Arg& lhs, const Monomial::Arg& rhs);
 		
 		
 		/**
@@ -482,6 +606,24 @@ namespace carl
          */
 	};
 	
+	inline void intrusive_ptr_add_ref(const Monomial* m) {
+		if (m->mImmortal) return;
+		#ifdef THREAD_SAFE
+		m->mRefCount.fetch_add(1, std::memory_order_relaxed);
+		#else
+		++m->mRefCount;
+		#endif
+	}
+
+	inline void intrusive_ptr_release(const Monomial* m) {
+		if (m->mImmortal) return;
+		#ifdef THREAD_SAFE
+		if (m->mRefCount.fetch_sub(1, std::memory_order_acq_rel) == 1) delete m;
+		#else
+		if (--m->mRefCount == 0) delete m;
+		#endif
+	}
+
 	/// @name Comparison operators
 	/// @{
 
@@ -632,7 +774,7 @@ namespace carl
 		return os;
 	}
 	/**
-	 * Streaming operator for std::shared_ptr<Monomial>.
+	 * Streaming operator for Monomial::Arg.
 	 * @param os Output stream.
 	 * @param rhs Monomial.
 	 * @return `os`
@@ -704,8 +846,8 @@ namespace std
 	};
 	
 	/**
-	 * The template specialization of `std::hash` for a shared pointer of a `carl::Monomial`.
-	 * @param monomial The shared pointer to a monomial.
+	 * The template specialization of `std::hash` for a handle of a `carl::Monomial`.
+	 * @param monomial The handle of a monomial.
 	 * @return Hash of monomial.
 	 */
 	template<>
@@ -61,5 +61,9 @@ struct MonomialComparator
 
 using LexOrdering = MonomialComparator<Monomial::compareLexical, false >;
 using GrLexOrdering = MonomialComparator<Monomial::compareGradedLexical, true >;
+/// Same as LexOrdering, but compares the packed exponents (see PackedExponents) if possible.
+using PackedLexOrdering = MonomialComparator<Monomial::compareLexicalPacked, false >;
+/// Same as GrLexOrdering, but compares the packed exponents (see PackedExponents) if possible.
+using PackedGrLexOrdering = MonomialComparator<Monomial::compareGradedLexicalPacked, true >;
 //using GrRevLexOrdering = MonomialComparator<Monomial::GrRevLexCompare, true >;
 }
@@ -12,20 +12,27 @@ namespace carl {
 Monomial::Arg MonomialPool::add(Monomial::Content&& c, exponent totalDegree) {
 	CARL_LOG_TRACE("carl.core.monomial", c << ", " << totalDegree);
 
-	MONOMIAL_POOL_LOCK_GUARD
+	std::size_t index = shard_of(Monomial::hashContent(c));
+	Shard& shard = *mShards[index];
+	MONOMIAL_POOL_LOCK_GUARD(shard)
 
 	underlying_set::insert_commit_data insert_data;
-	auto res = mPool.insert_check(c, content_hash(), content_equal(), insert_data);
+	auto res = shard.set.insert_check(c, content_hash(), content_equal(), insert_data);
 	if (!res.second) {
-		return res.first->mWeakPtr.lock();
-	} else {
-		auto shared = std::shared_ptr<Monomial>(new Monomial(c, totalDegree));
-		shared.get()->mId = mIDs.get();
-		shared.get()->mWeakPtr = shared;
-		mPool.insert_commit(*shared.get(), insert_data);
-		check_rehash();
-		return shared;
+		if (res.first->try_add_ref()) {
+			return Monomial::Arg(&*res.first, false);
+		}
+		// The last handle was released and the monomial waits for free() in another thread, hence we replace it.
+		shard.set.erase(res.first);
+		res = shard.set.insert_check(c, content_hash(), content_equal(), insert_data);
+		assert(res.second);
 	}
+	auto monomial = new Monomial(std::move(c), totalDegree);
+	monomial->mId = shard.ids.get() * num_shards + index;
+	monomial->mImmortal = monomial->tdeg() <= immortal_degree;
+	shard.set.insert_commit(*monomial, insert_data);
+	shard.check_rehash();
+	return Monomial::Arg(monomial);
 }
 
 Monomial::Arg MonomialPool::create(Variable _var, exponent _exp) {
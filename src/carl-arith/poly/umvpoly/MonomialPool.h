@@ -13,6 +13,8 @@
 
 #include <boost/intrusive/unordered_set.hpp>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 namespace carl {
 
@@ -40,39 +42,70 @@ class MonomialPool : public Singleton<MonomialPool> {
 		}
 	};
 
+public:
+	/// Number of shards, must be a power of two.
+	static constexpr std::size_t num_shards = 64;
+	/// Monomials up to this total degree are immortal, i.e. never freed and not reference counted.
+	static constexpr exponent immortal_degree = 1;
 private:
-	// Members:
-	/// id allocator
-	IDPool mIDs;
-	//size_t mIdAllocator;
-	pool::RehashPolicy mRehashPolicy;
 	using underlying_set = boost::intrusive::unordered_set<Monomial>;
-	std::unique_ptr<underlying_set::bucket_type[]> mPoolBuckets;
-	/// The pool.
-	underlying_set mPool;
-	/// Mutex to avoid multiple access to the pool
-	mutable std::recursive_mutex mMutex;
+
+	/**
+	 * A part of the pool that holds all monomials whose hash is mapped to this shard.
+	 * Every shard has its own lock and its own id allocator, hence threads creating different monomials rarely contend.
+	 */
+	struct alignas(64) Shard {
+		/// id allocator, the global id is the local id times num_shards plus the index of the shard.
+		IDPool ids;
+		pool::RehashPolicy rehash_policy;
+		std::unique_ptr<underlying_set::bucket_type[]> buckets;
+		/// The monomials of this shard.
+		underlying_set set;
+		/// Mutex to avoid multiple access to this shard
+		mutable std::mutex mutex;
+
+		explicit Shard(std::size_t capacity)
+			: buckets(new underlying_set::bucket_type[rehash_policy.numBucketsFor(capacity)]),
+			  set(underlying_set::bucket_traits(buckets.get(), rehash_policy.numBucketsFor(capacity))) {}
+
+		void check_rehash() {
+			auto rehash = rehash_policy.needRehash(set.bucket_count(), set.size());
+			if (rehash.first) {
+				auto new_buckets = new underlying_set::bucket_type[rehash.second];
+				set.rehash(underlying_set::bucket_traits(new_buckets, rehash.second));
+				buckets.reset(new_buckets);
+			}
+		}
+	};
+
+	// Members:
+	/// The shards of the pool.
+	std::vector<std::unique_ptr<Shard>> mShards;
 
 	#ifdef THREAD_SAFE
-	#define MONOMIAL_POOL_LOCK_GUARD std::lock_guard<std::recursive_mutex> lock(mMutex);
-	#define MONOMIAL_POOL_LOCK mMutex.lock();
-	#define MONOMIAL_POOL_UNLOCK mMutex.unlock();
+	#define MONOMIAL_POOL_LOCK_GUARD(shard) std::lock_guard<std::mutex> lock((shard).mutex);
 	#else
-	#define MONOMIAL_POOL_LOCK_GUARD
-	#define MONOMIAL_POOL_LOCK
-	#define MONOMIAL_POOL_UNLOCK
+	#define MONOMIAL_POOL_LOCK_GUARD(shard)
 	#endif
 
+	/// Maps a hash to a shard, using the high bits of a multiplicative hash as the low bits are used for the buckets.
+	static std::size_t shard_of(std::size_t hash) {
+		return static_cast<std::size_t>((static_cast<std::uint64_t>(hash) * 0x9E3779B97F4A7C15ull) >> 58);
+	}
+	static_assert(num_shards == 64, "shard_of() assumes 64 shards");
+
 protected:
 	/**
 	 * Constructor of the pool.
 	 * @param _capacity Expected necessary capacity of the pool.
 	 */
-	explicit MonomialPool(std::size_t _capacity = 1000)
-		: mPoolBuckets(new underlying_set::bucket_type[mRehashPolicy.numBucketsFor(_capacity)]),
-		  mPool(underlying_set::bucket_traits(mPoolBuckets.get(), mRehashPolicy.numBucketsFor(_capacity))) {
-		mIDs.get();
-		assert(mIDs.largestID() == 0);
+	explicit MonomialPool(std::size_t _capacity = 1000) {
+		for (std::size_t i = 0; i < num_shards; ++i) {
+			mShards.emplace_back(std::make_unique<Shard>(std::max(_capacity / num_shards, std::size_t(16))));
+		}
+		// Reserve the id zero for monomials that are not pooled.
+		mShards[0]->ids.get();
+		assert(mShards[0]->ids.largestID() == 0);
 		VariablePool::getInstance();
 		CARL_LOG_DEBUG("carl.pool", "Monomialpool constructed");
 	}
@@ -84,15 +117,6 @@ protected:
 
 	Monomial::Arg add(Monomial::Content&& c, exponent totalDegree = 0);
 
-	void check_rehash() {
-		auto rehash = mRehashPolicy.needRehash(mPool.bucket_count(), mPool.size());
-		if (rehash.first) {
-			auto new_buckets = new underlying_set::bucket_type[rehash.second];
-			mPool.rehash(underlying_set::bucket_traits(new_buckets, rehash.second));
-			mPoolBuckets.reset(new_buckets);
-		}
-	}
-
 public:
 	/**
 	 * Creates a monomial from a variable and an exponent.
@@ -137,29 +161,42 @@ public:
 		if (m == nullptr) return;
 		if (m->id() == 0) return;
 		CARL_LOG_TRACE("carl.core.monomial", "Freeing " << m);
-		MONOMIAL_POOL_LOCK_GUARD;
-		auto it = mPool.find(*m);
-		if (it != mPool.end()) {
+		Shard& shard = *mShards[m->id() % num_shards];
+		MONOMIAL_POOL_LOCK_GUARD(shard)
+		// The monomial may already have been replaced by add() if it expired while another thread requested it.
+		if (m->is_linked()) {
 			CARL_LOG_TRACE("carl.core.monomial", "Found " << m->id());
-			mIDs.free(m->id());
-			mPool.erase(it);
+			shard.set.erase(shard.set.iterator_to(*m));
 		} else {
 			CARL_LOG_TRACE("carl.core.monomial", "Not found in pool.");
 		}
+		shard.ids.free(m->id() / num_shards);
 	}
 
 	std::size_t size() const {
-		return mPool.size();
+		std::size_t res = 0;
+		for (const auto& shard: mShards) {
+			MONOMIAL_POOL_LOCK_GUARD(*shard)
+			res += shard->set.size();
+		}
+		return res;
 	}
+	/// Returns an upper bound on the ids of all monomials in the pool.
 	std::size_t largestID() const {
-		return mIDs.largestID();
+		std::size_t res = 0;
+		for (std::size_t i = 0; i < num_shards; ++i) {
+			res = std::max(res, mShards[i]->ids.largestID() * num_shards + i);
+		}
+		return res;
 	}
 };
 
 inline std::ostream& operator<<(std::ostream& os, const MonomialPool& mp) {
 	os << "MonomialPool of size " << mp.size() << std::endl;
-	for (const auto& entry : mp.mPool) {
-		os << "\t" << entry << std::endl;
+	for (const auto& shard : mp.mShards) {
+		for (const auto& entry : shard->set) {
+			os << "\t" << entry << std::endl;
+		}
 	}
 	return os;
 }
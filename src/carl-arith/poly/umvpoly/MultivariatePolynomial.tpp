@@ -8,6 +8,7 @@
 
 #include "MultivariatePolynomial.h"
 
+#include "HeapMultiplication.h"
 #include "Term.h"
 #include "UnivariatePolynomial.h"
 #include <carl-logging/carl-logging.h>
@@ -1003,22 +1004,13 @@ MultivariatePolynomial<Coeff,Ordering,Policies>& MultivariatePolynomial<Coeff,Or
 		*this = rhs;
 		return *this *= c;
 	}
-	auto id = mTermAdditionManager.getId(mTerms.size() * rhs.mTerms.size());
-	TermType newlterm;
-	bool first = true;
-	for (auto t1 = mTerms.rbegin(); t1 != mTerms.rend(); t1++) {
-		for (auto t2 = rhs.mTerms.rbegin(); t2 != rhs.mTerms.rend(); t2++) {
-			if (first) {
-				newlterm = *t1 * *t2;
-				first = false;
-			} else mTermAdditionManager.template addTerm<false>(id, std::move((*t1)*(*t2)));
-		}
-	}
-	mTermAdditionManager.readTerms(id, mTerms);
-	if (carl::is_zero(newlterm)) makeMinimallyOrdered<false, true>();
-	else mTerms.push_back(newlterm);
-	//makeMinimallyOrdered<false, true>();
-	mOrdered = false;
+	// The heap multiplication needs both factors to be fully ordered and yields a fully ordered result.
+	makeOrdered();
+	rhs.makeOrdered();
+	TermsType terms;
+	heap_multiply<Ordering>(mTerms, rhs.mTerms, terms);
+	mTerms = std::move(terms);
+	mOrdered = true;
 	assert(this->is_consistent());
 	return *this;
 }
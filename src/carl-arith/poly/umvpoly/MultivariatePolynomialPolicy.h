@@ -14,9 +14,11 @@ namespace carl
 {
     /**
      * The default policy for polynomials. 
+	 * If PackedMonomials is set, operations on monomials that are performed by algorithms like Gröbner bases (divisibility checks and lcm computations)
+	 * use the packed representation of the monomials, see PackedExponents.
 	 * @ingroup multirp
      */
-	template<typename ReasonsAdaptor = NoReasons, typename Allocator = NoAllocator>
+	template<typename ReasonsAdaptor = NoReasons, typename Allocator = NoAllocator, bool PackedMonomials = false>
     struct StdMultivariatePolynomialPolicies : public ReasonsAdaptor
     {
 		
@@ -29,6 +31,37 @@ namespace carl
 		
 		// Easy access.
 		static const bool has_reasons = ReasonsAdaptor::has_reasons;
+
+		/// Whether monomial operations use the packed representation.
+		static const bool packed_monomials = PackedMonomials;
+
+		/**
+		 * Checks if m is divisible by d.
+		 * @param m Monomial, must not be nullptr.
+		 * @param d Monomial.
+		 * @return If m is divisible by d.
+		 */
+		static bool divisible(const Monomial::Arg& m, const Monomial::Arg& d) {
+			if constexpr (PackedMonomials) {
+				return m->divisible_packed(d);
+			} else {
+				return m->divisible(d);
+			}
+		}
+
+		/**
+		 * Calculates the least common multiple of two monomials.
+		 * @param lhs First monomial.
+		 * @param rhs Second monomial.
+		 * @return lcm of lhs and rhs.
+		 */
+		static Monomial::Arg lcm(const Monomial::Arg& lhs, const Monomial::Arg& rhs) {
+			if constexpr (PackedMonomials) {
+				return Monomial::lcm_packed(lhs, rhs);
+			} else {
+				return Monomial::lcm(lhs, rhs);
+			}
+		}
     };
 	
 }
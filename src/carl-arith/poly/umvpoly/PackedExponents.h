@@ -0,0 +1,231 @@
+/**
+ * @file PackedExponents.h
+ * @ingroup multirp
+ *
+ * A packed, fixed-width representation of the exponent vector of a monomial.
+ */
+
+#pragma once
+
+#include <carl-arith/core/CompareResult.h>
+#include <carl-arith/core/Variable.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace carl
+{
+	/**
+	 * Packed representation of the exponent vector of a monomial with few variables and small exponents.
+	 *
+	 * Every pair of variable and exponent is encoded in a single 64 bit key `(content << 16) | (0xFFFF - exponent)`,
+	 * where `content` is the content of the variable.
+	 * The keys are stored in the same order as the pairs of the monomial, unused keys are zero.
+	 * This encoding is chosen such that comparing the keys position-wise yields exactly the lexical ordering of monomials:
+	 * a smaller variable yields a smaller key, a larger exponent of the same variable yields a smaller key and a missing entry is smaller than any key.
+	 * Thereby comparisons boil down to finding the first mismatching key, which is done with SSE2 if available.
+	 *
+	 * Additionally, we store the total degree and a bit mask of the occurring variables (modulo 64) that allows to reject most divisibility checks immediately.
+	 *
+	 * Monomials that can not be represented (more than #capacity variables, exponents larger than #max_exponent or variables with a rank) yield an invalid object.
+	 * @ingroup multirp
+	 */
+	class PackedExponents {
+	public:
+		/// Maximum number of variables.
+		static constexpr std::size_t capacity = 8;
+		/// Maximum exponent.
+		static constexpr std::size_t max_exponent = 0xFFFF;
+	private:
+		static constexpr std::size_t exponent_bits = 16;
+
+		/// The keys, padded with zeros.
+		alignas(16) std::array<std::uint64_t, capacity> mKeys = {};
+		/// Bit i is set if a variable with id i (modulo 64) occurs.
+		std::uint64_t mMask = 0;
+		/// The total degree.
+		std::uint32_t mTotalDegree = 0;
+		/// The number of used keys.
+		std::uint8_t mSize = 0;
+		/// Whether the monomial could be packed.
+		bool mValid = false;
+
+		static std::uint64_t variable_content(Variable v) {
+			return (static_cast<std::uint64_t>(v.id()) << Variable::RESERVED_FOR_TYPE) | static_cast<std::uint64_t>(v.type());
+		}
+
+		/**
+		 * Returns the index of the first key where lhs and rhs differ, or #capacity if they are equal.
+		 */
+		static std::size_t first_mismatch(const PackedExponents& lhs, const PackedExponents& rhs) {
+			std::size_t size = std::max(lhs.mSize, rhs.mSize);
+#ifdef __SSE2__
+			for (std::size_t i = 0; i < size; i += 2) {
+				__m128i l = _mm_load_si128(reinterpret_cast<const __m128i*>(lhs.mKeys.data() + i));
+				__m128i r = _mm_load_si128(reinterpret_cast<const __m128i*>(rhs.mKeys.data() + i));
+				int eq = _mm_movemask_epi8(_mm_cmpeq_epi32(l, r));
+				if (eq != 0xFFFF) {
+					return ((eq & 0xFF) != 0xFF) ? i : i + 1;
+				}
+			}
+#else
+			for (std::size_t i = 0; i < size; ++i) {
+				if (lhs.mKeys[i] != rhs.mKeys[i]) return i;
+			}
+#endif
+			return capacity;
+		}
+
+		/**
+		 * Returns the index of the key of this with the same variable as the given key, or #capacity if there is none.
+		 */
+		std::size_t find_variable(std::uint64_t key) const {
+#ifdef __SSE2__
+			const __m128i var = _mm_set1_epi64x(static_cast<long long>(key >> exponent_bits));
+			for (std::size_t i = 0; i < mSize; i += 2) {
+				__m128i keys = _mm_srli_epi64(_mm_load_si128(reinterpret_cast<const __m128i*>(mKeys.data() + i)), exponent_bits);
+				int eq = _mm_movemask_epi8(_mm_cmpeq_epi32(keys, var));
+				if ((eq & 0xFF) == 0xFF) return i;
+				if ((eq >> 8) == 0xFF && i + 1 < mSize) return i + 1;
+			}
+#else
+			for (std::size_t i = 0; i < mSize; ++i) {
+				if ((mKeys[i] >> exponent_bits) == (key >> exponent_bits)) return i;
+			}
+#endif
+			return capacity;
+		}
+
+	public:
+		PackedExponents() = default;
+
+		/**
+		 * Packs the given variables and exponents, which are expected to be sorted by variable.
+		 * @param content Pairs of variables and exponents.
+		 * @param totalDegree Total degree.
+		 */
+		template<typename Content>
+		PackedExponents(const Content& content, std::size_t totalDegree) {
+			if (content.size() > capacity) return;
+			for (const auto& p: content) {
+				if (p.first.rank() != 0) return;
+				if (p.second > max_exponent) return;
+				std::uint64_t c = variable_content(p.first);
+				if (c >= (std::uint64_t(1) << (64 - exponent_bits))) return;
+				mKeys[mSize++] = (c << exponent_bits) | (max_exponent - p.second);
+				mMask |= std::uint64_t(1) << (p.first.id() % 64);
+			}
+			mTotalDegree = static_cast<std::uint32_t>(totalDegree);
+			mValid = true;
+		}
+
+		/// Checks whether the monomial could be packed.
+		bool valid() const {
+			return mValid;
+		}
+		/// Returns the number of variables.
+		std::size_t size() const {
+			return mSize;
+		}
+		/// Returns the total degree.
+		std::size_t tdeg() const {
+			return mTotalDegree;
+		}
+		/// Returns the bit mask of the occurring variables.
+		std::uint64_t mask() const {
+			return mMask;
+		}
+		/// Returns the exponent stored at the given position.
+		std::size_t exponent_at(std::size_t index) const {
+			assert(index < mSize);
+			return max_exponent - (mKeys[index] & max_exponent);
+		}
+
+		/**
+		 * Lexical comparison, equivalent to Monomial::lexicalCompare().
+		 * Both arguments must be valid.
+		 */
+		static CompareResult compare_lexical(const PackedExponents& lhs, const PackedExponents& rhs) {
+			assert(lhs.valid() && rhs.valid());
+			std::size_t i = first_mismatch(lhs, rhs);
+			if (i == capacity) return CompareResult::EQUAL;
+			return (lhs.mKeys[i] < rhs.mKeys[i]) ? CompareResult::LESS : CompareResult::GREATER;
+		}
+
+		/**
+		 * Graded lexical comparison, equivalent to Monomial::compareGradedLexical().
+		 * Both arguments must be valid.
+		 */
+		static CompareResult compare_graded_lexical(const PackedExponents& lhs, const PackedExponents& rhs) {
+			if (lhs.mTotalDegree < rhs.mTotalDegree) return CompareResult::LESS;
+			if (lhs.mTotalDegree > rhs.mTotalDegree) return CompareResult::GREATER;
+			return compare_lexical(lhs, rhs);
+		}
+
+		/**
+		 * Checks whether this is divisible by m.
+		 * Both this and m must be valid.
+		 */
+		bool divisible(const PackedExponents& m) const {
+			assert(valid() && m.valid());
+			if ((m.mMask & ~mMask) != 0) return false;
+			if (m.mTotalDegree > mTotalDegree) return false;
+			if (m.mSize > mSize) return false;
+			for (std::size_t i = 0; i < m.mSize; ++i) {
+				std::size_t pos = find_variable(m.mKeys[i]);
+				if (pos == capacity) return false;
+				// Same variable: the key is smaller iff the exponent is larger.
+				if (mKeys[pos] > m.mKeys[i]) return false;
+			}
+			return true;
+		}
+
+		/**
+		 * Computes the variables and exponents of the least common multiple of lhs and rhs.
+		 * The variables are taken from the given contents, that must be the ones lhs and rhs were created from.
+		 * Both arguments must be valid.
+		 * @return The total degree of the lcm.
+		 */
+		template<typename Content>
+		static std::size_t lcm(const PackedExponents& lhs, const Content& lhsContent, const PackedExponents& rhs, const Content& rhsContent, Content& res) {
+			assert(lhs.valid() && rhs.valid());
+			res.reserve(lhs.mSize + rhs.mSize);
+			std::size_t tdeg = 0;
+			std::size_t l = 0;
+			std::size_t r = 0;
+			while (l < lhs.mSize && r < rhs.mSize) {
+				std::uint64_t lvar = lhs.mKeys[l] >> exponent_bits;
+				std::uint64_t rvar = rhs.mKeys[r] >> exponent_bits;
+				if (lvar == rvar) {
+					const auto& p = (lhs.mKeys[l] < rhs.mKeys[r]) ? lhsContent[l] : rhsContent[r];
+					res.push_back(p);
+					tdeg += p.second;
+					++l;
+					++r;
+				} else if (lvar < rvar) {
+					res.push_back(lhsContent[l]);
+					tdeg += lhsContent[l++].second;
+				} else {
+					res.push_back(rhsContent[r]);
+					tdeg += rhsContent[r++].second;
+				}
+			}
+			for (; l < lhs.mSize; ++l) {
+				res.push_back(lhsContent[l]);
+				tdeg += lhsContent[l].second;
+			}
+			for (; r < rhs.mSize; ++r) {
+				res.push_back(rhsContent[r]);
+				tdeg += rhsContent[r].second;
+			}
+			return tdeg;
+		}
+	};
+}
@@ -0,0 +1,420 @@
+/**
+ * @file GCD_modular.h
+ * @ingroup gcd
+ *
+ * Native modular multivariate GCD computation for builds without CoCoA.
+ * Follows Brown's algorithm as presented in @cite GCL92, Algorithms 7.1 and 7.2:
+ * the inputs are mapped to Z_p[x_1,...,x_n] for word-size primes p, the images
+ * are computed recursively by evaluation and interpolation of one variable at a
+ * time and finally lifted to the integers by chinese remaindering.
+ */
+
+#pragma once
+
+#include "../MultivariatePolynomial.h"
+#include <carl-arith/numbers/numbers.h>
+#include <carl-arith/numbers/PrimeFactory.h>
+#include "PrimeFieldPolynomial.h"
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <optional>
+#include <vector>
+
+namespace carl {
+namespace gcd_detail {
+
+/// Dense exponent vector with respect to a fixed list of variables.
+using ExponentVector = std::vector<exponent>;
+/// Sparse polynomial as a list of exponent vectors and coefficients, sorted lexicographically descending.
+template<typename Coeff>
+using SparsePolynomial = std::vector<std::pair<ExponentVector, Coeff>>;
+
+/**
+ * Exact arithmetic over the integers.
+ */
+struct IntegerArithmetic {
+	bool is_zero(const mpz_class& a) const {
+		return carl::is_zero(a);
+	}
+	mpz_class sub(const mpz_class& a, const mpz_class& b) const {
+		return a - b;
+	}
+	mpz_class mul(const mpz_class& a, const mpz_class& b) const {
+		return a * b;
+	}
+	bool try_divide(const mpz_class& a, const mpz_class& b, mpz_class& res) const {
+		if (carl::is_zero(b)) return false;
+		if (!mpz_divisible_p(a.get_mpz_t(), b.get_mpz_t())) return false;
+		mpz_divexact(res.get_mpz_t(), a.get_mpz_t(), b.get_mpz_t());
+		return true;
+	}
+};
+
+/**
+ * Splits a sparse polynomial in k variables into its coefficients with respect to the first k-1 variables.
+ * Every coefficient is a dense univariate polynomial in the last variable.
+ */
+inline std::vector<std::pair<ExponentVector, PrimeFieldPolynomial>> split_last(const SparsePolynomial<PrimeField::Element>& p) {
+	std::vector<std::pair<ExponentVector, PrimeFieldPolynomial>> res;
+	for (const auto& t: p) {
+		ExponentVector prefix(t.first.begin(), t.first.end() - 1);
+		if (res.empty() || res.back().first != prefix) {
+			res.emplace_back(std::move(prefix), PrimeFieldPolynomial());
+		}
+		auto& coeff = res.back().second;
+		exponent e = t.first.back();
+		if (coeff.size() <= e) coeff.resize(e + 1, 0);
+		coeff[e] = t.second;
+	}
+	return res;
+}
+
+/// Inverse of split_last().
+template<typename Groups>
+SparsePolynomial<PrimeField::Element> join_last(const Groups& groups) {
+	SparsePolynomial<PrimeField::Element> res;
+	for (const auto& g: groups) {
+		for (std::size_t e = g.second.size(); e > 0; --e) {
+			if (g.second[e - 1] == 0) continue;
+			ExponentVector ev(g.first);
+			ev.push_back(e - 1);
+			res.emplace_back(std::move(ev), g.second[e - 1]);
+		}
+	}
+	return res;
+}
+
+/// Substitutes alpha for the last variable.
+inline SparsePolynomial<PrimeField::Element> evaluate_last(const SparsePolynomial<PrimeField::Element>& p, PrimeField::Element alpha, const PrimeField& f) {
+	SparsePolynomial<PrimeField::Element> res;
+	for (const auto& t: p) {
+		PrimeField::Element val = f.mul(t.second, f.pow(alpha, t.first.back()));
+		if (!res.empty() && std::equal(res.back().first.begin(), res.back().first.end(), t.first.begin())) {
+			res.back().second = f.add(res.back().second, val);
+		} else {
+			if (!res.empty() && res.back().second == 0) res.pop_back();
+			res.emplace_back(ExponentVector(t.first.begin(), t.first.end() - 1), val);
+		}
+	}
+	if (!res.empty() && res.back().second == 0) res.pop_back();
+	return res;
+}
+
+inline bool is_constant(const SparsePolynomial<PrimeField::Element>& p) {
+	return p.size() == 1 && std::all_of(p.front().first.begin(), p.front().first.end(), [](exponent e){ return e == 0; });
+}
+
+inline void make_monic(SparsePolynomial<PrimeField::Element>& p, const PrimeField& f) {
+	if (p.empty()) return;
+	PrimeField::Element inv = f.inv(p.front().second);
+	for (auto& t: p) t.second = f.mul(t.second, inv);
+}
+
+/**
+ * Exact division of sparse polynomials with respect to the lexicographic ordering.
+ * @return true if divisor divides dividend, false otherwise.
+ */
+template<typename Coeff, typename Arithmetic>
+bool try_divide(const SparsePolynomial<Coeff>& dividend, const SparsePolynomial<Coeff>& divisor, const Arithmetic& arith, SparsePolynomial<Coeff>& quotient) {
+	assert(!divisor.empty());
+	std::map<ExponentVector, Coeff, std::greater<ExponentVector>> rem(dividend.begin(), dividend.end());
+	const auto& lead = divisor.front();
+	quotient.clear();
+	while (!rem.empty()) {
+		auto it = rem.begin();
+		ExponentVector ev(it->first.size());
+		for (std::size_t i = 0; i < ev.size(); ++i) {
+			if (it->first[i] < lead.first[i]) return false;
+			ev[i] = it->first[i] - lead.first[i];
+		}
+		Coeff c;
+		if (!arith.try_divide(it->second, lead.second, c)) return false;
+		for (const auto& t: divisor) {
+			ExponentVector target(ev);
+			for (std::size_t i = 0; i < target.size(); ++i) target[i] += t.first[i];
+			auto& entry = rem[target];
+			entry = arith.sub(entry, arith.mul(c, t.second));
+			if (arith.is_zero(entry)) rem.erase(target);
+		}
+		quotient.emplace_back(std::move(ev), std::move(c));
+	}
+	return true;
+}
+
+/**
+ * Computes the monic gcd of two polynomials in Z_p[x_1,...,x_k], where k is the length of the exponent vectors.
+ * Implements Algorithm 7.2 (PGCD) from @cite GCL92: the content with respect to x_k is split off,
+ * x_k is evaluated at sufficiently many points and the images are interpolated again.
+ * @return The gcd, or std::nullopt if the field is too small to find enough evaluation points.
+ */
+inline std::optional<SparsePolynomial<PrimeField::Element>> gcd_mod_p(const SparsePolynomial<PrimeField::Element>& a, const SparsePolynomial<PrimeField::Element>& b, std::size_t k, const PrimeField& f) {
+	if (a.empty() || b.empty()) {
+		SparsePolynomial<PrimeField::Element> res = a.empty() ? b : a;
+		make_monic(res, f);
+		return res;
+	}
+	if (k == 0) {
+		return SparsePolynomial<PrimeField::Element>({{ExponentVector(), 1}});
+	}
+	if (k == 1) {
+		PrimeFieldPolynomial g = primefield::gcd(split_last(a).front().second, split_last(b).front().second, f);
+		return join_last(std::vector<std::pair<ExponentVector, PrimeFieldPolynomial>>({{ExponentVector(), std::move(g)}}));
+	}
+
+	auto ga = split_last(a);
+	auto gb = split_last(b);
+	PrimeFieldPolynomial conta;
+	for (const auto& g: ga) conta = primefield::gcd(conta, g.second, f);
+	PrimeFieldPolynomial contb;
+	for (const auto& g: gb) contb = primefield::gcd(contb, g.second, f);
+	std::size_t dega = 0;
+	for (auto& g: ga) {
+		g.second = primefield::divide_inplace(g.second, conta, f);
+		dega = std::max(dega, g.second.size() - 1);
+	}
+	std::size_t degb = 0;
+	for (auto& g: gb) {
+		g.second = primefield::divide_inplace(g.second, contb, f);
+		degb = std::max(degb, g.second.size() - 1);
+	}
+	PrimeFieldPolynomial cont = primefield::gcd(conta, contb, f);
+	const PrimeFieldPolynomial& lca = ga.front().second;
+	const PrimeFieldPolynomial& lcb = gb.front().second;
+	PrimeFieldPolynomial lcgcd = primefield::gcd(lca, lcb, f);
+	std::size_t bound = lcgcd.size() - 1 + std::min(dega, degb);
+	auto pa = join_last(ga);
+	auto pb = join_last(gb);
+
+	std::map<ExponentVector, PrimeFieldPolynomial, std::greater<ExponentVector>> interpolant;
+	PrimeFieldPolynomial modulus = {1};
+	for (PrimeField::Element alpha = 0; alpha < f.p(); ++alpha) {
+		if (primefield::evaluate(lca, alpha, f) == 0 || primefield::evaluate(lcb, alpha, f) == 0) continue;
+		auto image = gcd_mod_p(evaluate_last(pa, alpha, f), evaluate_last(pb, alpha, f), k - 1, f);
+		if (!image) return std::nullopt;
+		if (is_constant(*image)) {
+			return join_last(std::vector<std::pair<ExponentVector, PrimeFieldPolynomial>>({{ExponentVector(k - 1, 0), cont}}));
+		}
+		PrimeField::Element scale = primefield::evaluate(lcgcd, alpha, f);
+		for (auto& t: *image) t.second = f.mul(t.second, scale);
+
+		if (interpolant.empty() || image->front().first < interpolant.begin()->first) {
+			// Either the first image or all previous evaluation points were unlucky.
+			interpolant.clear();
+			for (const auto& t: *image) interpolant.emplace(t.first, PrimeFieldPolynomial({t.second}));
+			modulus = {f.neg(alpha), 1};
+		} else if (image->front().first > interpolant.begin()->first) {
+			// This evaluation point is unlucky.
+			continue;
+		} else {
+			std::map<ExponentVector, PrimeField::Element, std::greater<ExponentVector>> values(image->begin(), image->end());
+			for (const auto& v: values) interpolant.try_emplace(v.first);
+			PrimeField::Element factor = f.inv(primefield::evaluate(modulus, alpha, f));
+			for (auto it = interpolant.begin(); it != interpolant.end();) {
+				auto vit = values.find(it->first);
+				PrimeField::Element target = vit == values.end() ? 0 : vit->second;
+				PrimeField::Element diff = f.mul(f.sub(target, primefield::evaluate(it->second, alpha, f)), factor);
+				if (diff != 0) {
+					if (it->second.size() < modulus.size()) it->second.resize(modulus.size(), 0);
+					for (std::size_t i = 0; i < modulus.size(); ++i) {
+						it->second[i] = f.add(it->second[i], f.mul(diff, modulus[i]));
+					}
+					primefield::trim(it->second);
+				}
+				if (it->second.empty()) it = interpolant.erase(it);
+				else ++it;
+			}
+			modulus = primefield::multiply(modulus, {f.neg(alpha), 1}, f);
+		}
+
+		if (modulus.size() - 1 > bound) {
+			PrimeFieldPolynomial c;
+			for (const auto& g: interpolant) c = primefield::gcd(c, g.second, f);
+			std::vector<std::pair<ExponentVector, PrimeFieldPolynomial>> groups;
+			for (const auto& g: interpolant) {
+				PrimeFieldPolynomial tmp = g.second;
+				groups.emplace_back(g.first, primefield::divide_inplace(tmp, c, f));
+			}
+			auto candidate = join_last(groups);
+			make_monic(candidate, f);
+			SparsePolynomial<PrimeField::Element> quot;
+			if (try_divide(pa, candidate, f, quot) && try_divide(pb, candidate, f, quot)) {
+				for (auto& g: groups) g.second = primefield::multiply(g.second, cont, f);
+				auto res = join_last(groups);
+				make_monic(res, f);
+				return res;
+			}
+			interpolant.clear();
+			modulus = {1};
+		}
+	}
+	return std::nullopt;
+}
+
+/// Computes the integer content of p.
+inline mpz_class content(const SparsePolynomial<mpz_class>& p) {
+	mpz_class res;
+	for (const auto& t: p) res = carl::gcd(res, t.second);
+	return res;
+}
+
+/**
+ * Computes the gcd of two primitive integer polynomials.
+ * Implements Algorithm 7.1 (MGCD) from @cite GCL92, but uses early termination once the
+ * chinese remainder lifting stabilizes, followed by trial division.
+ */
+inline SparsePolynomial<mpz_class> gcd_integer(const SparsePolynomial<mpz_class>& a, const SparsePolynomial<mpz_class>& b, std::size_t n) {
+	const mpz_class& lca = a.front().second;
+	const mpz_class& lcb = b.front().second;
+	mpz_class lcgcd = carl::gcd(lca, lcb);
+
+	WordPrimeFactory primes;
+	std::map<ExponentVector, mpz_class, std::greater<ExponentVector>> lifted;
+	mpz_class modulus;
+	while (true) {
+		PrimeField f(primes.next_prime());
+		if (f.reduce(lca) == 0 || f.reduce(lcb) == 0) continue;
+		SparsePolynomial<PrimeField::Element> ap;
+		for (const auto& t: a) {
+			PrimeField::Element c = f.reduce(t.second);
+			if (c != 0) ap.emplace_back(t.first, c);
+		}
+		SparsePolynomial<PrimeField::Element> bp;
+		for (const auto& t: b) {
+			PrimeField::Element c = f.reduce(t.second);
+			if (c != 0) bp.emplace_back(t.first, c);
+		}
+		auto image = gcd_mod_p(ap, bp, n, f);
+		if (!image) continue;
+		if (is_constant(*image)) {
+			return SparsePolynomial<mpz_class>({{ExponentVector(n, 0), mpz_class(1)}});
+		}
+		PrimeField::Element scale = f.reduce(lcgcd);
+		for (auto& t: *image) t.second = f.mul(t.second, scale);
+
+		if (lifted.empty() || image->front().first < lifted.begin()->first) {
+			// Either the first image or all previous primes were unlucky.
+			lifted.clear();
+			for (const auto& t: *image) {
+				lifted.emplace(t.first, mpz_class(f.symmetric(t.second)));
+			}
+			modulus = f.p();
+			continue;
+		} else if (image->front().first > lifted.begin()->first) {
+			// This prime is unlucky.
+			continue;
+		}
+
+		// Chinese remaindering with symmetric representatives.
+		std::map<ExponentVector, PrimeField::Element, std::greater<ExponentVector>> values(image->begin(), image->end());
+		for (const auto& v: values) lifted.try_emplace(v.first);
+		PrimeField::Element factor = f.inv(f.reduce(modulus));
+		mpz_class newmodulus = modulus * static_cast<unsigned long>(f.p());
+		mpz_class halfmodulus = newmodulus / 2;
+		bool changed = false;
+		for (auto it = lifted.begin(); it != lifted.end();) {
+			auto vit = values.find(it->first);
+			PrimeField::Element target = vit == values.end() ? 0 : vit->second;
+			PrimeField::Element diff = f.mul(f.sub(target, f.reduce(it->second)), factor);
+			if (diff != 0) {
+				changed = true;
+				it->second += modulus * static_cast<unsigned long>(diff);
+				if (it->second > halfmodulus) it->second -= newmodulus;
+			}
+			if (carl::is_zero(it->second)) it = lifted.erase(it);
+			else ++it;
+		}
+		modulus = newmodulus;
+
+		if (!changed) {
+			SparsePolynomial<mpz_class> candidate(lifted.begin(), lifted.end());
+			mpz_class c = content(candidate);
+			for (auto& t: candidate) mpz_divexact(t.second.get_mpz_t(), t.second.get_mpz_t(), c.get_mpz_t());
+			SparsePolynomial<mpz_class> quot;
+			if (try_divide(a, candidate, IntegerArithmetic(), quot) && try_divide(b, candidate, IntegerArithmetic(), quot)) {
+				return candidate;
+			}
+		}
+	}
+}
+
+/**
+ * Converts p to a sparse polynomial with integer coefficients over the given variables.
+ * Rational coefficients are made integral by multiplication with the main denominator.
+ */
+template<typename C, typename O, typename P>
+SparsePolynomial<mpz_class> to_sparse(const MultivariatePolynomial<C,O,P>& p, const std::vector<Variable>& vars) {
+	C factor = C(1);
+	if constexpr (!is_integer_type<C>::value) {
+		factor = C(p.main_denom());
+	}
+	SparsePolynomial<mpz_class> res;
+	for (const auto& t: p) {
+		ExponentVector ev(vars.size(), 0);
+		if (t.monomial()) {
+			for (const auto& ve: *t.monomial()) {
+				auto it = std::lower_bound(vars.begin(), vars.end(), ve.first);
+				assert(it != vars.end() && *it == ve.first);
+				ev[static_cast<std::size_t>(std::distance(vars.begin(), it))] = ve.second;
+			}
+		}
+		res.emplace_back(std::move(ev), carl::get_num(C(t.coeff() * factor)));
+	}
+	std::sort(res.begin(), res.end(), [](const auto& lhs, const auto& rhs){ return lhs.first > rhs.first; });
+	return res;
+}
+
+template<typename C, typename O, typename P>
+MultivariatePolynomial<C,O,P> from_sparse(const SparsePolynomial<mpz_class>& p, const std::vector<Variable>& vars) {
+	typename MultivariatePolynomial<C,O,P>::TermsType terms;
+	for (const auto& t: p) {
+		std::vector<std::pair<Variable, exponent>> vepairs;
+		exponent total = 0;
+		for (std::size_t i = 0; i < vars.size(); ++i) {
+			if (t.first[i] == 0) continue;
+			vepairs.emplace_back(vars[i], t.first[i]);
+			total += t.first[i];
+		}
+		if (vepairs.empty()) {
+			terms.emplace_back(C(t.second));
+		} else {
+			terms.emplace_back(C(t.second), createMonomial(std::move(vepairs), total));
+		}
+	}
+	return MultivariatePolynomial<C,O,P>(std::move(terms), false, false);
+}
+
+/**
+ * Computes the gcd of two non-constant polynomials with integer or rational coefficients by the modular approach.
+ * For integer coefficients, the result is primitive up to the gcd of the contents and has a positive leading coefficient.
+ * For rational coefficients, the result is normalized to leading coefficient one.
+ */
+template<typename C, typename O, typename P>
+MultivariatePolynomial<C,O,P> gcd_modular(const MultivariatePolynomial<C,O,P>& a, const MultivariatePolynomial<C,O,P>& b) {
+	carlVariables allvars;
+	variables(a, allvars);
+	variables(b, allvars);
+	const std::vector<Variable>& vars = allvars.as_vector();
+
+	auto sa = to_sparse(a, vars);
+	auto sb = to_sparse(b, vars);
+	mpz_class ca = content(sa);
+	mpz_class cb = content(sb);
+	for (auto& t: sa) mpz_divexact(t.second.get_mpz_t(), t.second.get_mpz_t(), ca.get_mpz_t());
+	for (auto& t: sb) mpz_divexact(t.second.get_mpz_t(), t.second.get_mpz_t(), cb.get_mpz_t());
+	mpz_class c = carl::gcd(ca, cb);
+
+	auto res = gcd_integer(sa, sb, vars.size());
+	if constexpr (is_field_type<C>::value) {
+		return from_sparse<C,O,P>(res, vars).normalize();
+	} else {
+		for (auto& t: res) t.second *= c;
+		auto g = from_sparse<C,O,P>(res, vars);
+		if (carl::is_negative(g.lcoeff())) return -g;
+		return g;
+	}
+}
+
+}
+}
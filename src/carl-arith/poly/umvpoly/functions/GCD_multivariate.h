@@ -1,6 +1,7 @@
 #pragma once
 
 #include <carl-common/config.h>
+#include "GCD_modular.h"
 #include "PrimitiveEuclidean.h"
 #include <carl-arith/numbers/typetraits.h>
 #include <carl-arith/poly/umvpoly/functions/to_univariate_polynomial.h>
@@ -68,8 +69,8 @@ MultivariatePolynomial<C,O,P> gcd(const MultivariatePolynomial<C,O,P>& a, const
 		[](const MultivariatePolynomial<mpq_class,O,P>& n1, const MultivariatePolynomial<mpq_class,O,P>& n2){ CoCoAAdaptor<MultivariatePolynomial<mpq_class,O,P>> c({n1, n2}); return c.gcd(n1,n2); },
 		[](const MultivariatePolynomial<mpz_class,O,P>& n1, const MultivariatePolynomial<mpz_class,O,P>& n2){ CoCoAAdaptor<MultivariatePolynomial<mpz_class,O,P>> c({n1, n2}); return c.gcd(n1,n2); }
 	#else
-		[](const MultivariatePolynomial<mpq_class,O,P>& n1, const MultivariatePolynomial<mpq_class,O,P>& n2){ return gcd_detail::gcd_calculate(n1,n2); },
-		[](const MultivariatePolynomial<mpz_class,O,P>& n1, const MultivariatePolynomial<mpz_class,O,P>& n2){ return gcd_detail::gcd_calculate(n1,n2); }
+		[](const MultivariatePolynomial<mpq_class,O,P>& n1, const MultivariatePolynomial<mpq_class,O,P>& n2){ return gcd_detail::gcd_modular(n1,n2); },
+		[](const MultivariatePolynomial<mpz_class,O,P>& n1, const MultivariatePolynomial<mpz_class,O,P>& n2){ return gcd_detail::gcd_modular(n1,n2); }
 	#endif
 	};
 	CARL_LOG_DEBUG("carl.core.gcd", "gcd(" << a << ", " << b << ")");
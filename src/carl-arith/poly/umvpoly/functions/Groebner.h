@@ -1,17 +1,33 @@
 #pragma once
 
+#include <carl-common/config.h>
 #include "../CoCoAAdaptor.h"
+#include <carl-arith/groebner/GBProcedure.h>
+#include <carl-arith/groebner/gb-f4/F4.h>
 
 namespace carl {
 
 template<typename C, typename O, typename P>
 class MultivariatePolynomial;
 
+/**
+ * Computes the reduced Groebner basis of the given polynomials.
+ * Uses CoCoA if available and the native F4 implementation otherwise.
+ */
 template<typename C, typename O, typename P>
 std::vector<MultivariatePolynomial<C,O,P>> groebner_basis(const std::vector<MultivariatePolynomial<C,O,P>>& polys) {
 	if (polys.size() <= 1) return polys;
+#if defined USE_COCOA
     CoCoAAdaptor adaptor(polys);
     return adaptor.GBasis(polys);
+#else
+	GBProcedure<MultivariatePolynomial<C,O,P>, F4, StdAdding> gb;
+	for (const auto& p: polys) {
+		gb.addPolynomial(p);
+	}
+	gb.calculate();
+	return gb.getBasisPolynomials();
+#endif
 }
 
 }
@@ -0,0 +1,377 @@
+/**
+ * @file IntervalEvaluator.h
+ * @ingroup multirp
+ */
+
+#pragma once
+
+#include "IntervalEvaluation.h"
+#include "horner/IntervalEvaluation.h"
+
+#include <carl-arith/core/Variables.h>
+#include <carl-arith/interval/IntervalBatch.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <map>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace carl {
+
+/**
+ * A polynomial compiled to a straight-line program for repeated interval evaluation.
+ *
+ * The polynomial is lowered once to a flat list of instructions over dense variable slots, such that evaluating it
+ * neither walks the terms nor looks up variables in a map for every monomial.
+ * Every power of a variable and every common prefix of the monomials (in the order of their variables) is computed only once.
+ * A polynomial can also be lowered from a MultivariateHorner scheme.
+ *
+ * The operations and their order are the same as for carl::evaluate(), except that carl::evaluate() stops early
+ * once a monomial evaluates to zero or the sum becomes unbounded. Hence the results coincide as long as all values are non-empty and bounded.
+ *
+ * Registers 0 to variables().size()-1 hold the values of the variables, instruction i writes register variables().size()+i.
+ *
+ * For double intervals, evaluate_batch() runs the program on IntervalBatch with batch_width inputs at once.
+ */
+template<typename Number>
+class IntervalEvaluator {
+public:
+	/// Number of inputs evaluated at once by evaluate_batch() for double intervals.
+	static constexpr std::size_t batch_width = 4;
+
+	enum class OpCode : std::uint8_t {
+		/// Power of register lhs with exponent rhs.
+		Power,
+		/// Constant lhs.
+		Constant,
+		/// Sum of registers lhs and rhs.
+		Add,
+		/// Product of registers lhs and rhs.
+		Mul,
+		/// Sum of constant lhs and register rhs.
+		AddConstant,
+		/// Product of constant lhs and register rhs.
+		MulConstant
+	};
+	struct Instruction {
+		OpCode op;
+		std::size_t lhs;
+		std::size_t rhs;
+	};
+
+private:
+	std::vector<Variable> mVariables;
+	std::vector<Interval<Number>> mConstants;
+	std::vector<Instruction> mProgram;
+	/// The register holding the result.
+	std::size_t mResult = 0;
+
+	/// Helper for the lowering, maps subexpressions to registers.
+	struct Builder {
+		IntervalEvaluator& evaluator;
+		std::map<Variable, std::size_t> slots;
+		std::map<std::pair<std::size_t, uint>, std::size_t> powers;
+		std::map<std::vector<std::size_t>, std::size_t> products;
+
+		std::size_t emit(OpCode op, std::size_t lhs, std::size_t rhs) {
+			evaluator.mProgram.push_back(Instruction{ op, lhs, rhs });
+			return evaluator.mVariables.size() + evaluator.mProgram.size() - 1;
+		}
+		template<typename Coeff>
+		std::size_t constant(const Coeff& c) {
+			evaluator.mConstants.emplace_back(c);
+			return evaluator.mConstants.size() - 1;
+		}
+		std::size_t slot(Variable v) {
+			auto it = slots.find(v);
+			if (it != slots.end()) return it->second;
+			assert(evaluator.mProgram.empty());
+			evaluator.mVariables.push_back(v);
+			return slots.emplace(v, evaluator.mVariables.size() - 1).first->second;
+		}
+		std::size_t power(std::size_t slot, uint exp) {
+			if (exp == 1) return slot;
+			auto it = powers.find(std::make_pair(slot, exp));
+			if (it != powers.end()) return it->second;
+			std::size_t res = emit(OpCode::Power, slot, exp);
+			powers.emplace(std::make_pair(slot, exp), res);
+			return res;
+		}
+		std::size_t monomial(const Monomial& m) {
+			// The registers of the powers multiplied so far.
+			std::vector<std::size_t> prefix;
+			std::size_t res = 0;
+			for (const auto& e: m) {
+				std::size_t p = power(slot(e.first), e.second);
+				prefix.push_back(p);
+				if (prefix.size() == 1) {
+					res = p;
+					continue;
+				}
+				auto it = products.find(prefix);
+				if (it == products.end()) {
+					it = products.emplace(prefix, emit(OpCode::Mul, res, p)).first;
+				}
+				res = it->second;
+			}
+			return res;
+		}
+		template<typename Coeff>
+		std::size_t term(const Term<Coeff>& t) {
+			if (!t.monomial()) return emit(OpCode::Constant, constant(t.coeff()), 0);
+			std::size_t m = monomial(*t.monomial());
+			if (carl::is_one(t.coeff())) return m;
+			return emit(OpCode::MulConstant, constant(t.coeff()), m);
+		}
+		template<typename Poly, typename Strategy>
+		static void collect(const MultivariateHorner<Poly, Strategy>& h, carlVariables& vars) {
+			if (h.getVariable() == Variable::NO_VARIABLE) return;
+			vars.add(h.getVariable());
+			if (h.getDependent()) collect(*h.getDependent(), vars);
+			if (h.getIndependent()) collect(*h.getIndependent(), vars);
+		}
+		template<typename Poly, typename Strategy>
+		std::size_t horner(const MultivariateHorner<Poly, Strategy>& h) {
+			if (h.getVariable() == Variable::NO_VARIABLE) {
+				return emit(OpCode::Constant, constant(h.getIndepConstant()), 0);
+			}
+			std::size_t p = power(slot(h.getVariable()), h.getExponent());
+			std::size_t dep;
+			if (h.getDependent()) {
+				dep = emit(OpCode::Mul, p, horner(*h.getDependent()));
+			} else {
+				dep = emit(OpCode::MulConstant, constant(h.getDepConstant()), p);
+			}
+			if (h.getIndependent()) {
+				return emit(OpCode::Add, dep, horner(*h.getIndependent()));
+			}
+			return emit(OpCode::AddConstant, constant(h.getIndepConstant()), dep);
+		}
+	};
+
+	void run(std::vector<Interval<Number>>& registers) const {
+		std::size_t offset = mVariables.size();
+		for (std::size_t i = 0; i < mProgram.size(); ++i) {
+			const Instruction& ins = mProgram[i];
+			Interval<Number>& res = registers[offset + i];
+			switch (ins.op) {
+				case OpCode::Power:
+					res = carl::pow(registers[ins.lhs], ins.rhs);
+					break;
+				case OpCode::Constant:
+					res = mConstants[ins.lhs];
+					break;
+				case OpCode::Add:
+					res = registers[ins.lhs] + registers[ins.rhs];
+					break;
+				case OpCode::Mul:
+					res = registers[ins.lhs] * registers[ins.rhs];
+					break;
+				case OpCode::AddConstant:
+					res = registers[ins.rhs] + mConstants[ins.lhs];
+					break;
+				case OpCode::MulConstant:
+					res = mConstants[ins.lhs] * registers[ins.rhs];
+					break;
+			}
+		}
+	}
+
+	/**
+	 * Runs the program on batches.
+	 * @param registers Register file whose variable slots are set.
+	 * @param finite Is cleared for every lane where some intermediate result is not finite.
+	 */
+	template<std::size_t N>
+	void run(std::vector<IntervalBatch<N>>& registers, std::array<bool, N>& finite) const {
+		std::size_t offset = mVariables.size();
+		for (std::size_t i = 0; i < mProgram.size(); ++i) {
+			const Instruction& ins = mProgram[i];
+			IntervalBatch<N>& res = registers[offset + i];
+			switch (ins.op) {
+				case OpCode::Power:
+					res = carl::pow(registers[ins.lhs], uint(ins.rhs));
+					break;
+				case OpCode::Constant:
+					res = IntervalBatch<N>(mConstants[ins.lhs]);
+					break;
+				case OpCode::Add:
+					res = registers[ins.lhs] + registers[ins.rhs];
+					break;
+				case OpCode::Mul:
+					res = registers[ins.lhs] * registers[ins.rhs];
+					break;
+				case OpCode::AddConstant:
+					res = registers[ins.rhs] + IntervalBatch<N>(mConstants[ins.lhs]);
+					break;
+				case OpCode::MulConstant:
+					res = IntervalBatch<N>(mConstants[ins.lhs]) * registers[ins.rhs];
+					break;
+			}
+			for (std::size_t lane = 0; lane < N; ++lane) {
+				finite[lane] &= res.is_finite(lane);
+			}
+		}
+	}
+
+	/// Returns the register file of the current thread, sized for this program.
+	std::vector<Interval<Number>>& registers() const {
+		thread_local std::vector<Interval<Number>> registers;
+		registers.resize(mVariables.size() + mProgram.size());
+		return registers;
+	}
+	/// Returns the batched register file of the current thread, sized for this program.
+	template<std::size_t N>
+	std::vector<IntervalBatch<N>>& batch_registers() const {
+		thread_local std::vector<IntervalBatch<N>> registers;
+		registers.resize(mVariables.size() + mProgram.size());
+		return registers;
+	}
+
+	/// Checks whether all constants can be stored in batches.
+	bool batchable_constants() const {
+		return std::all_of(mConstants.begin(), mConstants.end(), [](const auto& c){ return IntervalBatch<batch_width>::is_batchable(c); });
+	}
+
+public:
+	/**
+	 * Compiles a polynomial.
+	 * The slots of the variables are ordered by the variables.
+	 * @param p Polynomial.
+	 */
+	template<typename Coeff, typename Ordering, typename Policies>
+	explicit IntervalEvaluator(const MultivariatePolynomial<Coeff, Ordering, Policies>& p) {
+		Builder builder{ *this, {}, {}, {} };
+		for (Variable v: carl::variables(p)) {
+			builder.slot(v);
+		}
+		if (is_zero(p)) {
+			mResult = builder.emit(OpCode::Constant, builder.constant(Number(0)), 0);
+			return;
+		}
+		mResult = builder.term(p[0]);
+		for (std::size_t i = 1; i < p.nr_terms(); ++i) {
+			mResult = builder.emit(OpCode::Add, mResult, builder.term(p[i]));
+		}
+	}
+
+	/**
+	 * Compiles a polynomial given as a Horner scheme.
+	 * The slots of the variables are ordered by the variables.
+	 * @param h Horner scheme.
+	 */
+	template<typename Poly, typename Strategy>
+	explicit IntervalEvaluator(const MultivariateHorner<Poly, Strategy>& h) {
+		Builder builder{ *this, {}, {}, {} };
+		carlVariables vars;
+		Builder::collect(h, vars);
+		for (Variable v: vars) {
+			builder.slot(v);
+		}
+		mResult = builder.horner(h);
+	}
+
+	/// Returns the variables in the order of their slots.
+	const std::vector<Variable>& variables() const {
+		return mVariables;
+	}
+	/// Returns the instructions.
+	const std::vector<Instruction>& program() const {
+		return mProgram;
+	}
+	/// Returns the constants used by the instructions.
+	const std::vector<Interval<Number>>& constants() const {
+		return mConstants;
+	}
+	/// Returns the register holding the result.
+	std::size_t result() const {
+		return mResult;
+	}
+
+	/**
+	 * Evaluates the polynomial.
+	 * @param values The values of the variables, in the order of variables().
+	 * @return The resulting interval.
+	 */
+	Interval<Number> evaluate(const std::vector<Interval<Number>>& values) const {
+		assert(values.size() == mVariables.size());
+		auto& regs = registers();
+		std::copy(values.begin(), values.end(), regs.begin());
+		run(regs);
+		return regs[mResult];
+	}
+
+	/**
+	 * Evaluates the polynomial.
+	 * Every variable is looked up once.
+	 * @param map Assigns an interval to every variable of the polynomial.
+	 * @return The resulting interval.
+	 */
+	Interval<Number> evaluate(const std::map<Variable, Interval<Number>>& map) const {
+		auto& regs = registers();
+		for (std::size_t i = 0; i < mVariables.size(); ++i) {
+			CARL_LOG_ASSERT("carl.core.intervalevaluation", map.count(mVariables[i]) > 0, "Every variable is expected to be in the map.");
+			regs[i] = map.at(mVariables[i]);
+		}
+		run(regs);
+		return regs[mResult];
+	}
+
+	/**
+	 * Evaluates the polynomial for a batch of inputs.
+	 * For double intervals, batch_width inputs are evaluated at once if all their values are closed and bounded.
+	 * Inputs where some intermediate result is not finite are evaluated again on their own, hence the results are the same as for evaluate().
+	 * @param values The values of the variables for every input, each in the order of variables().
+	 * @return The resulting intervals, one for every input.
+	 */
+	std::vector<Interval<Number>> evaluate_batch(const std::vector<std::vector<Interval<Number>>>& values) const {
+		std::vector<Interval<Number>> res;
+		res.reserve(values.size());
+		std::size_t next = 0;
+		if constexpr (std::is_same_v<Number, double>) {
+			constexpr std::size_t N = batch_width;
+			if (batchable_constants()) {
+				auto& regs = batch_registers<N>();
+				auto batchable = [](const auto& v){
+					return std::all_of(v.begin(), v.end(), [](const auto& i){ return IntervalBatch<N>::is_batchable(i); });
+				};
+				for (; next + N <= values.size(); next += N) {
+					if (!std::all_of(values.begin() + long(next), values.begin() + long(next + N), batchable)) {
+						for (std::size_t lane = 0; lane < N; ++lane) {
+							res.emplace_back(evaluate(values[next + lane]));
+						}
+						continue;
+					}
+					for (std::size_t lane = 0; lane < N; ++lane) {
+						assert(values[next + lane].size() == mVariables.size());
+						for (std::size_t var = 0; var < mVariables.size(); ++var) {
+							regs[var].set(lane, values[next + lane][var]);
+						}
+					}
+					std::array<bool, N> finite;
+					finite.fill(true);
+					run(regs, finite);
+					for (std::size_t lane = 0; lane < N; ++lane) {
+						if (finite[lane]) res.emplace_back(regs[mResult].get(lane));
+						else res.emplace_back(evaluate(values[next + lane]));
+					}
+				}
+			}
+		}
+		auto& regs = registers();
+		for (; next < values.size(); ++next) {
+			const auto& v = values[next];
+			assert(v.size() == mVariables.size());
+			std::copy(v.begin(), v.end(), regs.begin());
+			run(regs);
+			res.emplace_back(regs[mResult]);
+		}
+		return res;
+	}
+};
+
+}
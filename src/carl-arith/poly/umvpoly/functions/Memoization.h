@@ -0,0 +1,257 @@
+/**
+ * @file Memoization.h
+ * @ingroup upoly
+ *
+ * Memoized versions of sturm_sequence(), subresultants(), principalSubresultantsCoefficients(), resultant() and discriminant().
+ *
+ * The results are stored in bounded caches (see LRUCache) that are shared for each coefficient type.
+ * The size of an entry is the number of coefficients (or terms, if the coefficients are polynomials) of its key and its result.
+ * Hits and misses are reported to carl-statistics as "memoization".
+ */
+
+#pragma once
+
+#include "MemoizationStatistics.h"
+#include "Resultant.h"
+#include "SturmSequence.h"
+#include "../UnivariatePolynomial.h"
+
+#include <carl-arith/numbers/typetraits.h>
+#include <carl-common/datastructures/LRUCache.h>
+#include <carl-common/util/hash.h>
+
+#include <algorithm>
+#include <cassert>
+#include <list>
+#include <memory>
+#include <vector>
+
+namespace carl {
+namespace memoization {
+
+/// Default capacity of every cache, in coefficients.
+constexpr std::size_t default_capacity = std::size_t(1) << 20;
+
+/// The size of a polynomial as accounted for in the caches.
+template<typename Coeff>
+std::size_t size(const UnivariatePolynomial<Coeff>& p) {
+	if constexpr (is_number_type<Coeff>::value) {
+		return p.coefficients().size();
+	} else {
+		std::size_t res = 0;
+		for (const auto& c: p.coefficients()) res += std::max<std::size_t>(c.nr_terms(), 1);
+		return res;
+	}
+}
+/// The size of a sequence of polynomials as accounted for in the caches.
+template<typename Container>
+std::size_t size(const Container& polys) {
+	std::size_t res = 1;
+	for (const auto& p: polys) res += memoization::size(p);
+	return res;
+}
+
+/// Key of the caches for operations on two polynomials.
+template<typename Coeff>
+struct PolynomialPair {
+	UnivariatePolynomial<Coeff> first;
+	UnivariatePolynomial<Coeff> second;
+	SubresultantStrategy strategy;
+	bool operator==(const PolynomialPair& rhs) const {
+		return strategy == rhs.strategy && first == rhs.first && second == rhs.second;
+	}
+};
+template<typename Coeff>
+struct PolynomialPairHash {
+	std::size_t operator()(const PolynomialPair<Coeff>& p) const {
+		return carl::hash_all(p.first, p.second, static_cast<int>(p.strategy));
+	}
+};
+/// Key of the caches for operations on a single polynomial.
+template<typename Coeff>
+struct PolynomialStrategy {
+	UnivariatePolynomial<Coeff> poly;
+	SubresultantStrategy strategy;
+	bool operator==(const PolynomialStrategy& rhs) const {
+		return strategy == rhs.strategy && poly == rhs.poly;
+	}
+};
+template<typename Coeff>
+struct PolynomialStrategyHash {
+	std::size_t operator()(const PolynomialStrategy<Coeff>& p) const {
+		return carl::hash_all(p.poly, static_cast<int>(p.strategy));
+	}
+};
+
+/// The size of a key for operations on two polynomials as accounted for in the caches.
+template<typename Coeff>
+std::size_t size(const PolynomialPair<Coeff>& key) {
+	return memoization::size(key.first) + memoization::size(key.second);
+}
+/// The size of a key for operations on a single polynomial as accounted for in the caches.
+template<typename Coeff>
+std::size_t size(const PolynomialStrategy<Coeff>& key) {
+	return memoization::size(key.poly);
+}
+
+template<typename Coeff>
+using SturmCache = LRUCache<UnivariatePolynomial<Coeff>, std::shared_ptr<const std::vector<UnivariatePolynomial<Coeff>>>>;
+template<typename Coeff>
+using SubresultantsCache = LRUCache<PolynomialPair<Coeff>, std::shared_ptr<const std::list<UnivariatePolynomial<Coeff>>>, PolynomialPairHash<Coeff>>;
+template<typename Coeff>
+using ResultantCache = LRUCache<PolynomialPair<Coeff>, UnivariatePolynomial<Coeff>, PolynomialPairHash<Coeff>>;
+template<typename Coeff>
+using DiscriminantCache = LRUCache<PolynomialStrategy<Coeff>, UnivariatePolynomial<Coeff>, PolynomialStrategyHash<Coeff>>;
+
+/// Returns the cache for sturm sequences.
+template<typename Coeff>
+SturmCache<Coeff>& sturm_cache() {
+	static SturmCache<Coeff> cache(default_capacity);
+	return cache;
+}
+/// Returns the cache for subresultants.
+template<typename Coeff>
+SubresultantsCache<Coeff>& subresultants_cache() {
+	static SubresultantsCache<Coeff> cache(default_capacity);
+	return cache;
+}
+/// Returns the cache for resultants.
+template<typename Coeff>
+ResultantCache<Coeff>& resultant_cache() {
+	static ResultantCache<Coeff> cache(default_capacity);
+	return cache;
+}
+/// Returns the cache for discriminants.
+template<typename Coeff>
+DiscriminantCache<Coeff>& discriminant_cache() {
+	static DiscriminantCache<Coeff> cache(default_capacity);
+	return cache;
+}
+
+/// Clears all caches for the given coefficient type.
+template<typename Coeff>
+void clear() {
+	sturm_cache<Coeff>().clear();
+	subresultants_cache<Coeff>().clear();
+	resultant_cache<Coeff>().clear();
+	discriminant_cache<Coeff>().clear();
+}
+
+}
+
+/**
+ * Memoized version of sturm_sequence(const UnivariatePolynomial<Coeff>&).
+ * @param p Polynomial.
+ * @return Sturm sequence of p.
+ */
+template<typename Coeff>
+std::shared_ptr<const std::vector<UnivariatePolynomial<Coeff>>> cached_sturm_sequence(const UnivariatePolynomial<Coeff>& p) {
+	auto& cache = memoization::sturm_cache<Coeff>();
+	if (auto res = cache.get(p)) {
+		CARL_CALL_STATISTICS(memoization::statistics().sturm_hits++);
+		return *res;
+	}
+	CARL_CALL_STATISTICS(memoization::statistics().sturm_misses++);
+	auto res = std::make_shared<const std::vector<UnivariatePolynomial<Coeff>>>(sturm_sequence(p));
+	cache.put(p, res, memoization::size(p) + memoization::size(*res));
+	return res;
+}
+
+/**
+ * Memoized version of subresultants().
+ * @param p First polynomial.
+ * @param q Second polynomial.
+ * @param strategy Strategy.
+ * @return Subresultants of p and q.
+ */
+template<typename Coeff>
+std::shared_ptr<const std::list<UnivariatePolynomial<Coeff>>> cached_subresultants(
+	const UnivariatePolynomial<Coeff>& p,
+	const UnivariatePolynomial<Coeff>& q,
+	SubresultantStrategy strategy = SubresultantStrategy::Default
+) {
+	auto& cache = memoization::subresultants_cache<Coeff>();
+	memoization::PolynomialPair<Coeff> key{ p, q, strategy };
+	if (auto res = cache.get(key)) {
+		CARL_CALL_STATISTICS(memoization::statistics().subresultants_hits++);
+		return *res;
+	}
+	CARL_CALL_STATISTICS(memoization::statistics().subresultants_misses++);
+	auto res = std::make_shared<const std::list<UnivariatePolynomial<Coeff>>>(subresultants(p, q, strategy));
+	cache.put(key, res, memoization::size(key) + memoization::size(*res));
+	return res;
+}
+
+/**
+ * Memoized version of principalSubresultantsCoefficients().
+ * Only the subresultants are cached, the coefficients are extracted from them.
+ * @param p First polynomial.
+ * @param q Second polynomial.
+ * @param strategy Strategy.
+ * @return Principal subresultant coefficients of p and q.
+ */
+template<typename Coeff>
+std::vector<UnivariatePolynomial<Coeff>> cached_principalSubresultantsCoefficients(
+	const UnivariatePolynomial<Coeff>& p,
+	const UnivariatePolynomial<Coeff>& q,
+	SubresultantStrategy strategy = SubresultantStrategy::Default
+) {
+	auto subres = cached_subresultants(p, q, strategy);
+	std::vector<UnivariatePolynomial<Coeff>> subresCoeffs;
+	subresCoeffs.reserve(subres->size());
+	for (const auto& s : *subres) {
+		assert(!carl::is_zero(s));
+		subresCoeffs.emplace_back(s.main_var(), s.lcoeff());
+	}
+	return subresCoeffs;
+}
+
+/**
+ * Memoized version of resultant().
+ * @param p First polynomial.
+ * @param q Second polynomial.
+ * @param strategy Strategy.
+ * @return Resultant of p and q.
+ */
+template<typename Coeff>
+UnivariatePolynomial<Coeff> cached_resultant(
+	const UnivariatePolynomial<Coeff>& p,
+	const UnivariatePolynomial<Coeff>& q,
+	SubresultantStrategy strategy = SubresultantStrategy::Default
+) {
+	auto& cache = memoization::resultant_cache<Coeff>();
+	memoization::PolynomialPair<Coeff> key{ p, q, strategy };
+	if (auto res = cache.get(key)) {
+		CARL_CALL_STATISTICS(memoization::statistics().resultant_hits++);
+		return *res;
+	}
+	CARL_CALL_STATISTICS(memoization::statistics().resultant_misses++);
+	auto res = resultant(p, q, strategy);
+	cache.put(key, res, memoization::size(key) + memoization::size(res));
+	return res;
+}
+
+/**
+ * Memoized version of discriminant().
+ * @param p Polynomial.
+ * @param strategy Strategy.
+ * @return Discriminant of p.
+ */
+template<typename Coeff>
+UnivariatePolynomial<Coeff> cached_discriminant(
+	const UnivariatePolynomial<Coeff>& p,
+	SubresultantStrategy strategy = SubresultantStrategy::Default
+) {
+	auto& cache = memoization::discriminant_cache<Coeff>();
+	memoization::PolynomialStrategy<Coeff> key{ p, strategy };
+	if (auto res = cache.get(key)) {
+		CARL_CALL_STATISTICS(memoization::statistics().discriminant_hits++);
+		return *res;
+	}
+	CARL_CALL_STATISTICS(memoization::statistics().discriminant_misses++);
+	auto res = discriminant(p, strategy);
+	cache.put(key, res, memoization::size(key) + memoization::size(res));
+	return res;
+}
+
+}
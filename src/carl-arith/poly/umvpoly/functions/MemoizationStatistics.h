@@ -0,0 +1,40 @@
+#pragma once
+
+#include <carl-statistics/carl-statistics.h>
+
+#ifdef CARL_DEVOPTION_Statistics
+
+namespace carl {
+namespace memoization {
+
+class MemoizationStatistics : public statistics::Statistics {
+public:
+	std::size_t sturm_hits = 0;
+	std::size_t sturm_misses = 0;
+	std::size_t subresultants_hits = 0;
+	std::size_t subresultants_misses = 0;
+	std::size_t resultant_hits = 0;
+	std::size_t resultant_misses = 0;
+	std::size_t discriminant_hits = 0;
+	std::size_t discriminant_misses = 0;
+	void collect() {
+		Statistics::addKeyValuePair("sturm_hits", sturm_hits);
+		Statistics::addKeyValuePair("sturm_misses", sturm_misses);
+		Statistics::addKeyValuePair("subresultants_hits", subresultants_hits);
+		Statistics::addKeyValuePair("subresultants_misses", subresultants_misses);
+		Statistics::addKeyValuePair("resultant_hits", resultant_hits);
+		Statistics::addKeyValuePair("resultant_misses", resultant_misses);
+		Statistics::addKeyValuePair("discriminant_hits", discriminant_hits);
+		Statistics::addKeyValuePair("discriminant_misses", discriminant_misses);
+	}
+};
+
+/// The statistics are shared by all translation units, hence this function is inline (and not static).
+inline auto& statistics() {
+	static CARL_INIT_STATISTICS(MemoizationStatistics, stats, "memoization");
+	return stats;
+}
+
+}
+}
+#endif
@@ -8,6 +8,7 @@
 #pragma once
 #include <carl-arith/numbers/numbers.h>
 #include "../UnivariatePolynomial.h"
+#include "PrimeFieldPolynomial.h"
 #include <carl-logging/carl-logging.h>
 #include <list>
 
@@ -15,6 +16,90 @@
 namespace carl
 {
 
+namespace hensel_detail {
+
+template<typename Integer>
+UnivariatePolynomial<Integer> representing_integers(const UnivariatePolynomial<GFNumber<Integer>>& p)
+{
+	std::vector<Integer> coeffs;
+	coeffs.reserve(p.coefficients().size());
+	for (const auto& c: p.coefficients()) {
+		coeffs.push_back(c.representing_integer());
+	}
+	return UnivariatePolynomial<Integer>(p.main_var(), std::move(coeffs));
+}
+
+/**
+ * Checks whether p is one modulo the given modulus.
+ * Works on the representing integers, as arithmetic on GFNumber does not reduce the coefficients.
+ */
+template<typename Integer>
+bool is_one_modulo(const UnivariatePolynomial<GFNumber<Integer>>& p, const Integer& modulus)
+{
+	for (std::size_t i = 0; i < p.coefficients().size(); ++i) {
+		Integer c = carl::mod(p.coefficients()[i].representing_integer(), modulus);
+		if (c != (i == 0 ? Integer(1) : Integer(0))) return false;
+	}
+	return !p.coefficients().empty();
+}
+
+/**
+ * Computes s,t such that s*a + tb == 1 (mod p^k)
+ * with deg(s) < deg(b) and deg(t) < deg(a).
+ * Assumption GCD(a mod p, b mod p) = 1 in Z_p[x]
+ * All computations modulo p are done using word-size prime field arithmetic.
+ * @param a Polynomial in Z_p^k[x]
+ * @param b Polynomial in Z_p^k[x]
+ * @param gf_p The field Z_p.
+ * @param gf_pk The ring Z_p^k.
+ * @return s and t.
+ */
+template<typename Integer>
+std::vector<UnivariatePolynomial<GFNumber<Integer>>> eea_lift(const UnivariatePolynomial<GFNumber<Integer>>& a, const UnivariatePolynomial<GFNumber<Integer>>& b, const GaloisField<Integer>* gf_p, const GaloisField<Integer>* gf_pk)
+{
+	assert(a.main_var() == b.main_var());
+	CARL_LOG_DEBUG("carl.core.hensel", "EEALIFT: a=" << a << ", b=" << b );
+	const Variable& x = a.main_var();
+	assert( gf_p->p() == gf_pk->p());
+	PrimeField field(gf_p->p());
+	UnivariatePolynomial<Integer> A = representing_integers(a);
+	UnivariatePolynomial<Integer> B = representing_integers(b);
+	PrimeFieldPolynomial amodp = primefield::from_univariate(A, field);
+	PrimeFieldPolynomial bmodp = primefield::from_univariate(B, field);
+	PrimeFieldPolynomial smodp;
+	PrimeFieldPolynomial tmodp;
+	PrimeFieldPolynomial g = primefield::extended_gcd(amodp, bmodp, smodp, tmodp, field);
+	CARL_LOG_ASSERT("carl.core.hensel", g.size() == 1 && g.front() == 1, "g expected to be one");
+	UnivariatePolynomial<Integer> s = primefield::to_univariate<Integer>(x, smodp, field);
+	UnivariatePolynomial<Integer> t = primefield::to_univariate<Integer>(x, tmodp, field);
+	CARL_LOG_DEBUG("carl.core.hensel", "EEALIFT: s=" << s << ", t=" << t );
+	Integer p = gf_p->p();
+	Integer modulus = p;
+	UnivariatePolynomial<Integer> one(x, Integer(1), 0);
+	for(unsigned j=1; j<gf_pk->k(); ++j)
+	{
+		// e = 1 - s*a - t*b. // c = (e/modulus) mod p.
+		UnivariatePolynomial<Integer> e = one - s*A - t*B;
+		for (auto& coeff: e.coefficients()) {
+			coeff = carl::div(coeff, modulus);
+		}
+		PrimeFieldPolynomial c = primefield::from_univariate(e, field);
+		PrimeFieldPolynomial sigma = primefield::multiply(smodp, c, field);
+		PrimeFieldPolynomial tau = primefield::multiply(tmodp, c, field);
+		PrimeFieldPolynomial q = primefield::divide_inplace(sigma, bmodp, field);
+		tau = primefield::add(tau, primefield::multiply(q, amodp, field), field);
+		s += primefield::to_univariate<Integer>(x, sigma, field) * modulus;
+		t += primefield::to_univariate<Integer>(x, tau, field) * modulus;
+		modulus *= p;
+	}
+	UnivariatePolynomial<GFNumber<Integer>> sres = s.toFiniteDomain(gf_pk);
+	UnivariatePolynomial<GFNumber<Integer>> tres = t.toFiniteDomain(gf_pk);
+	assert(is_one_modulo(sres*a + tres*b, modulus));
+	return {sres, tres};
+}
+
+}
+
 /**
  * Includes the algorithms 6.2 and 6.3 from the book 
  * Algorithms for Computer Algebra by Geddes, Czaper, Labahn.
@@ -192,52 +277,11 @@ class DiophantineEquations
 	/**
 	 * EEAlift computes s,t such that s*a + tb == 1 (mod p^k)
 	 * with deg(s) < deg(b) and deg(t) < deg(a).
-	 * Assumption GCD(a mod p, b mod p) = 1 in Z_p[x]
-     * @param a Polynomial in Z_p^k[x]
-     * @param b Polynomial in Z_p^k[x]
-     * @return 
-     */
-	std::vector<Polynomial> EEAlift(Polynomial a, Polynomial b) const
+	 * @see hensel_detail::eea_lift
+	 */
+	std::vector<Polynomial> EEAlift(const Polynomial& a, const Polynomial& b) const
 	{
-		assert(a.main_var() == b.main_var());
-		CARL_LOG_DEBUG("carl.core.hensel", "EEALIFT: a=" << a << ", b=" << b );
-		const Variable& x = a.main_var();
-		Polynomial amodp = a.toFiniteDomain(mGf_p);
-		Polynomial bmodp = b.toFiniteDomain(mGf_p);
-		CARL_LOG_DEBUG("carl.core.hensel", "EEALIFT: a mod p=" << amodp << ", b mod p=" << bmodp );
-		Polynomial s(x);
-		Polynomial t(x);
-		Polynomial g(x);
-		g = Polynomial::extended_gcd(amodp,bmodp,s,t);
-		CARL_LOG_DEBUG("carl.core.hensel", "EEALIFT: g=" << g << ", s=" << s << ", t=" << t );
-		CARL_LOG_ASSERT("carl.core.hensel", g.is_one(), "g expected to be one");
-		Polynomial smodp = s;
-		Polynomial tmodp = t;
-		assert( mGf_p->p() == mGf_pk->p());
-		Integer p = mGf_p->p();
-		Integer modulus = p;
-		Polynomial c(x);
-		for(unsigned j=1; j<mGf_pk->k(); ++j)
-		{
-			// TODO check moduli.
-			// e = 1 - s*a - t*b. // c = (e/modulus) mod p.
-			GFNumber<Integer> one(1,mGf_pk);
-			c =  -s*a-t*b+one;
-			UnivariatePolynomial<Integer> cf = c.to_integer_domain();
-			cf /= modulus;
-			c = cf.toFiniteDomain(mGf_p);
-			Polynomial sigmaprime =  smodp * c;
-			Polynomial tauprime = tmodp * c;
-			DivisionResult<Polynomial> d = sigmaprime.divideBy(bmodp);
-			Polynomial q = d.quotient.normalizeCoefficients();
-			Polynomial sigma = d.remainder.normalizeCoefficients();
-			Polynomial tau = (tauprime + q * amodp).normalizeCoefficients();
-			s += sigma*modulus;
-			t += tau*modulus;
-			modulus *= p;
-		}
-		assert((s.toFiniteDomain(mGf_pk)*a + t.toFiniteDomain(mGf_pk)*b).is_one());
-		return {s,t};	
+		return hensel_detail::eea_lift(a, b, mGf_p, mGf_pk);
 	}
 };
 
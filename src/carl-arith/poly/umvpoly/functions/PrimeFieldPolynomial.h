@@ -0,0 +1,198 @@
+/**
+ * @file PrimeFieldPolynomial.h
+ *
+ * Dense univariate polynomial kernels over word-size prime fields.
+ * These are meant as fast building blocks for modular algorithms like
+ * modular gcd computations or Hensel lifting and avoid any arbitrary
+ * precision arithmetic.
+ */
+
+#pragma once
+
+#include "../UnivariatePolynomial.h"
+#include <carl-arith/numbers/PrimeField.h>
+
+#include <utility>
+#include <vector>
+
+namespace carl {
+
+/// Dense univariate polynomial over a PrimeField, coefficients are ordered by increasing degree.
+using PrimeFieldPolynomial = std::vector<PrimeField::Element>;
+
+namespace primefield {
+
+/// Removes leading zero coefficients.
+inline void trim(PrimeFieldPolynomial& p) {
+	while (!p.empty() && p.back() == 0) p.pop_back();
+}
+
+/// Evaluates p at x using Horner's scheme.
+inline PrimeField::Element evaluate(const PrimeFieldPolynomial& p, PrimeField::Element x, const PrimeField& f) {
+	PrimeField::Element res = 0;
+	for (auto it = p.rbegin(); it != p.rend(); ++it) {
+		res = f.add(f.mul(res, x), *it);
+	}
+	return res;
+}
+
+/// Makes p monic in place.
+inline void make_monic(PrimeFieldPolynomial& p, const PrimeField& f) {
+	if (p.empty() || p.back() == 1) return;
+	auto inv = f.inv(p.back());
+	for (auto& c: p) c = f.mul(c, inv);
+}
+
+/// Multiplies p by a scalar in place.
+inline void scale(PrimeFieldPolynomial& p, PrimeField::Element c, const PrimeField& f) {
+	if (c == 0) {
+		p.clear();
+		return;
+	}
+	for (auto& e: p) e = f.mul(e, c);
+}
+
+inline PrimeFieldPolynomial add(const PrimeFieldPolynomial& a, const PrimeFieldPolynomial& b, const PrimeField& f) {
+	PrimeFieldPolynomial res(std::max(a.size(), b.size()), 0);
+	for (std::size_t i = 0; i < a.size(); ++i) res[i] = a[i];
+	for (std::size_t i = 0; i < b.size(); ++i) res[i] = f.add(res[i], b[i]);
+	trim(res);
+	return res;
+}
+
+inline PrimeFieldPolynomial subtract(const PrimeFieldPolynomial& a, const PrimeFieldPolynomial& b, const PrimeField& f) {
+	PrimeFieldPolynomial res(std::max(a.size(), b.size()), 0);
+	for (std::size_t i = 0; i < a.size(); ++i) res[i] = a[i];
+	for (std::size_t i = 0; i < b.size(); ++i) res[i] = f.sub(res[i], b[i]);
+	trim(res);
+	return res;
+}
+
+/**
+ * Multiplies two polynomials.
+ * Products are accumulated in 64 bits and only reduced if the accumulator may overflow.
+ */
+inline PrimeFieldPolynomial multiply(const PrimeFieldPolynomial& a, const PrimeFieldPolynomial& b, const PrimeField& f) {
+	if (a.empty() || b.empty()) return {};
+	constexpr std::uint64_t threshold = std::uint64_t(1) << 63;
+	PrimeFieldPolynomial res(a.size() + b.size() - 1, 0);
+	for (std::size_t k = 0; k < res.size(); ++k) {
+		std::size_t first = k < b.size() ? 0 : k - b.size() + 1;
+		std::size_t last = std::min(k, a.size() - 1);
+		std::uint64_t acc = 0;
+		for (std::size_t i = first; i <= last; ++i) {
+			acc += std::uint64_t(a[i]) * b[k - i];
+			if (acc >= threshold) acc = f.reduce(acc);
+		}
+		res[k] = f.reduce(acc);
+	}
+	return res;
+}
+
+/**
+ * Divides a by b, stores the remainder in a and returns the quotient.
+ */
+inline PrimeFieldPolynomial divide_inplace(PrimeFieldPolynomial& a, const PrimeFieldPolynomial& b, const PrimeField& f) {
+	assert(!b.empty());
+	if (a.size() < b.size()) return {};
+	PrimeFieldPolynomial q(a.size() - b.size() + 1, 0);
+	auto lcinv = f.inv(b.back());
+	for (std::size_t i = a.size(); i >= b.size(); --i) {
+		auto c = f.mul(a[i - 1], lcinv);
+		std::size_t shift = i - b.size();
+		q[shift] = c;
+		if (c == 0) continue;
+		auto negc = f.neg(c);
+		for (std::size_t j = 0; j < b.size(); ++j) {
+			a[shift + j] = f.reduce(a[shift + j] + std::uint64_t(negc) * b[j]);
+		}
+	}
+	trim(a);
+	return q;
+}
+
+/// Computes the monic gcd of a and b.
+inline PrimeFieldPolynomial gcd(PrimeFieldPolynomial a, PrimeFieldPolynomial b, const PrimeField& f) {
+	while (!b.empty()) {
+		divide_inplace(a, b, f);
+		std::swap(a, b);
+	}
+	make_monic(a, f);
+	return a;
+}
+
+/**
+ * Computes the monic gcd g of a and b together with s and t such that s*a + t*b = g.
+ */
+inline PrimeFieldPolynomial extended_gcd(const PrimeFieldPolynomial& a, const PrimeFieldPolynomial& b, PrimeFieldPolynomial& s, PrimeFieldPolynomial& t, const PrimeField& f) {
+	PrimeFieldPolynomial r0 = a;
+	PrimeFieldPolynomial r1 = b;
+	PrimeFieldPolynomial s0 = {1};
+	PrimeFieldPolynomial s1;
+	PrimeFieldPolynomial t0;
+	PrimeFieldPolynomial t1 = {1};
+	while (!r1.empty()) {
+		PrimeFieldPolynomial q = divide_inplace(r0, r1, f);
+		std::swap(r0, r1);
+		PrimeFieldPolynomial s2 = subtract(s0, multiply(q, s1, f), f);
+		PrimeFieldPolynomial t2 = subtract(t0, multiply(q, t1, f), f);
+		s0 = std::move(s1);
+		s1 = std::move(s2);
+		t0 = std::move(t1);
+		t1 = std::move(t2);
+	}
+	if (!r0.empty()) {
+		auto inv = f.inv(r0.back());
+		scale(r0, inv, f);
+		scale(s0, inv, f);
+		scale(t0, inv, f);
+	}
+	s = std::move(s0);
+	t = std::move(t0);
+	return r0;
+}
+
+/**
+ * Computes the resultant of a and b by the euclidean algorithm, using
+ * res(a, b) = (-1)^(deg(a) deg(b)) lc(b)^(deg(a) - deg(r)) res(b, r) for the remainder r of a and b.
+ * Both polynomials must be nonzero.
+ */
+inline PrimeField::Element resultant(PrimeFieldPolynomial a, PrimeFieldPolynomial b, const PrimeField& f) {
+	assert(!a.empty() && !b.empty());
+	PrimeField::Element res = 1;
+	while (b.size() > 1) {
+		std::size_t dega = a.size() - 1;
+		std::size_t degb = b.size() - 1;
+		divide_inplace(a, b, f);
+		if (a.empty()) return 0;
+		res = f.mul(res, f.pow(b.back(), static_cast<uint>(dega - (a.size() - 1))));
+		if ((dega & degb & 1) != 0) res = f.neg(res);
+		std::swap(a, b);
+	}
+	return f.mul(res, f.pow(b.front(), static_cast<uint>(a.size() - 1)));
+}
+
+/// Maps a univariate polynomial with integer coefficients to the prime field.
+template<typename Integer>
+PrimeFieldPolynomial from_univariate(const UnivariatePolynomial<Integer>& p, const PrimeField& f) {
+	static_assert(is_integer_type<Integer>::value, "Only integer coefficients can be mapped to a prime field");
+	PrimeFieldPolynomial res;
+	res.reserve(p.coefficients().size());
+	for (const auto& c: p.coefficients()) {
+		res.push_back(f.from_signed(carl::to_int<sint>(carl::mod(c, Integer(f.p())))));
+	}
+	trim(res);
+	return res;
+}
+
+/// Lifts a polynomial over the prime field to the integers using the symmetric representation.
+template<typename Integer>
+UnivariatePolynomial<Integer> to_univariate(Variable v, const PrimeFieldPolynomial& p, const PrimeField& f) {
+	std::vector<Integer> coeffs;
+	coeffs.reserve(p.size());
+	for (auto c: p) coeffs.emplace_back(f.symmetric(c));
+	return UnivariatePolynomial<Integer>(v, std::move(coeffs));
+}
+
+}
+}
@@ -0,0 +1,136 @@
+/**
+ * @file Projection.h
+ * @ingroup upoly
+ *
+ * Batch computation of the projection of a set of polynomials, as used by cylindrical algebraic decomposition.
+ */
+
+#pragma once
+
+#include "Factorization.h"
+#include "Memoization.h"
+#include "to_univariate_polynomial.h"
+#include "../MultivariatePolynomial.h"
+
+#include <carl-common/config.h>
+#include <carl-common/util/ThreadPool.h>
+
+#include <functional>
+#include <unordered_set>
+#include <vector>
+
+namespace carl {
+
+namespace projection_detail {
+	/// Makes the factor unique up to a constant: coprime integral coefficients and a positive leading coefficient.
+	template<typename C, typename O, typename P>
+	MultivariatePolynomial<C,O,P> canonical(const MultivariatePolynomial<C,O,P>& p) {
+		auto res = p.coprime_coefficients();
+		if (carl::is_negative(res.lcoeff())) return -res;
+		return res;
+	}
+
+	/// Appends the non-constant irreducible factors of p.
+	template<typename C, typename O, typename P>
+	void add_factors(const MultivariatePolynomial<C,O,P>& p, std::vector<MultivariatePolynomial<C,O,P>>& factors) {
+		if (p.is_constant()) return;
+		for (const auto& f: carl::irreducible_factors(p, false)) {
+			if (!f.is_constant()) factors.emplace_back(canonical(f));
+		}
+	}
+
+	/**
+	 * Runs the given independent tasks on a ThreadPool with the given number of threads (zero meaning all cores).
+	 * Polynomial arithmetic is only safe to use concurrently if carl is built with THREAD_SAFE,
+	 * otherwise the tasks are run sequentially on the calling thread.
+	 */
+	inline void run(std::vector<std::function<void()>>& tasks, std::size_t threads) {
+#ifdef THREAD_SAFE
+		if (threads != 1 && tasks.size() > 1) {
+			ThreadPool pool(threads);
+			for (auto& t: tasks) pool.submit(std::move(t));
+			pool.wait();
+			return;
+		}
+#endif
+		(void)threads;
+		for (auto& t: tasks) t();
+	}
+}
+
+/**
+ * Computes the projection of a set of polynomials with respect to the variable v, consisting of
+ * - all polynomials that do not contain v,
+ * - the coefficients of all polynomials with respect to v,
+ * - the discriminants of all polynomials with respect to v and
+ * - the resultants of all pairs of polynomials with respect to v.
+ * The result is the set of irreducible factors of these polynomials (see irreducible_factors()),
+ * each normalized to coprime integral coefficients and a positive leading coefficient, without constants and duplicates.
+ *
+ * Every polynomial is converted to a univariate polynomial in v once. Discriminants and resultants are obtained from the
+ * memoization caches (see cached_discriminant() and cached_resultant()) and computed as independent tasks, which are
+ * scheduled on a ThreadPool if carl is built with THREAD_SAFE. Every task stores its factors at a fixed position,
+ * hence the result is ordered as listed above (pairs of polynomials in lexicographic order of their indices) and
+ * does not depend on the number of threads. Zero resultants of polynomials with a common factor are skipped.
+ *
+ * @param polys Polynomials.
+ * @param v Main variable.
+ * @param threads Number of threads, zero for all cores.
+ * @param strategy Strategy for resultants and discriminants.
+ * @return Projection factors.
+ */
+template<typename C, typename O, typename P>
+std::vector<MultivariatePolynomial<C,O,P>> projection(
+	const std::vector<MultivariatePolynomial<C,O,P>>& polys,
+	Variable v,
+	std::size_t threads = 1,
+	SubresultantStrategy strategy = SubresultantStrategy::Default
+) {
+	using Poly = MultivariatePolynomial<C,O,P>;
+	std::vector<UnivariatePolynomial<Poly>> upolys;
+	std::vector<Poly> results;
+	for (const auto& p: polys) {
+		if (p.has(v)) {
+			upolys.emplace_back(carl::to_univariate_polynomial(p, v));
+		} else {
+			projection_detail::add_factors(p, results);
+		}
+	}
+
+	std::vector<std::vector<Poly>> factors(upolys.size() + upolys.size() * (upolys.size() - 1) / 2);
+	std::vector<std::function<void()>> tasks;
+	std::size_t slot = 0;
+	for (std::size_t i = 0; i < upolys.size(); ++i, ++slot) {
+		tasks.emplace_back([&upolys, &factors, i, slot, strategy](){
+			const auto& p = upolys[i];
+			for (auto it = p.coefficients().rbegin(); it != p.coefficients().rend(); ++it) {
+				projection_detail::add_factors(*it, factors[slot]);
+			}
+			if (p.degree() > 1) {
+				auto disc = cached_discriminant(p, strategy);
+				if (!carl::is_zero(disc)) projection_detail::add_factors(disc.lcoeff(), factors[slot]);
+			}
+		});
+	}
+	for (std::size_t i = 0; i < upolys.size(); ++i) {
+		for (std::size_t j = i + 1; j < upolys.size(); ++j, ++slot) {
+			tasks.emplace_back([&upolys, &factors, i, j, slot, strategy](){
+				auto res = cached_resultant(upolys[i], upolys[j], strategy);
+				if (!carl::is_zero(res)) projection_detail::add_factors(res.lcoeff(), factors[slot]);
+			});
+		}
+	}
+	projection_detail::run(tasks, threads);
+
+	for (auto& f: factors) {
+		results.insert(results.end(), std::make_move_iterator(f.begin()), std::make_move_iterator(f.end()));
+	}
+	std::unordered_set<Poly> seen;
+	std::vector<Poly> res;
+	for (auto& p: results) {
+		if (seen.insert(p).second) res.emplace_back(std::move(p));
+	}
+	return res;
+}
+
+}
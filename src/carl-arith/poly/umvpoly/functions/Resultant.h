@@ -17,6 +17,8 @@ enum class SubresultantStrategy {
 	Generic,
 	Lazard,
 	Ducos,
+	/// Computes resultants of polynomials with integer or rational multivariate coefficients by evaluation, interpolation and chinese remaindering, see resultant_modular(). Subresultants are computed like Lazard.
+	Modular,
 	Default = Lazard
 };
 
@@ -34,6 +36,7 @@ UnivariatePolynomial<Coeff> discriminant(const UnivariatePolynomial<Coeff>&, Sub
 } // namespace carl
 
 #include "../UnivariatePolynomial.h"
+#include "Resultant_modular.h"
 
 namespace carl {
 
@@ -63,6 +66,10 @@ std::list<UnivariatePolynomial<Coeff>> subresultants(
 	 */
 	assert(pol1.main_var() == pol2.main_var());
 	CARL_LOG_TRACE("carl.core.resultant", "subresultants(" << pol1 << ", " << pol2 << ")");
+	// Subresultants are computed like Lazard, the switches below handle Modular alongside Lazard.
+	if (strategy == SubresultantStrategy::Modular) {
+		strategy = SubresultantStrategy::Lazard;
+	}
 	std::list<UnivariatePolynomial<Coeff>> subresultants;
 	Variable variable = pol1.main_var();
 
@@ -154,7 +161,8 @@ std::list<UnivariatePolynomial<Coeff>> subresultants(
 				break;
 			}
 			case SubresultantStrategy::Ducos:
-			case SubresultantStrategy::Lazard: {
+			case SubresultantStrategy::Lazard:
+			case SubresultantStrategy::Modular: {
 				CARL_LOG_TRACE("carl.core.resultant", "Part 2: Ducos/Lazard strategy");
 				// "dichotomous Lazard": efficient exponentiation
 				uint deltaReduced = delta - 1;
@@ -211,7 +219,8 @@ std::list<UnivariatePolynomial<Coeff>> subresultants(
 		switch (strategy) {
 		// Compared to [Duc98], here S_{d-1} is b and S_d is a, S_e is c, and s_d is subresLcoeff.
 		case SubresultantStrategy::Generic:
-		case SubresultantStrategy::Lazard: {
+		case SubresultantStrategy::Lazard:
+		case SubresultantStrategy::Modular: {
 			CARL_LOG_TRACE("carl.core.resultant", "Part 3: Generic/Lazard strategy");
 			if (carl::is_zero(p)) return subresultants;
 
@@ -292,6 +301,16 @@ UnivariatePolynomial<Coeff> resultant(
 	SubresultantStrategy strategy) {
 	assert(p.main_var() == q.main_var());
 	if (carl::is_zero(p) || carl::is_zero(q)) return UnivariatePolynomial<Coeff>(p.main_var());
+	if constexpr (resultant_detail::is_modular_coefficient<Coeff>::value) {
+		if (strategy == SubresultantStrategy::Modular && p.degree() > 0 && q.degree() > 0) {
+			// As in subresultants(), the polynomial of larger degree is the first argument.
+			auto res = p.degree() >= q.degree() ?
+				resultant_detail::resultant_modular(p.normalized(), q.normalized()) :
+				resultant_detail::resultant_modular(q.normalized(), p.normalized());
+			CARL_LOG_TRACE("carl.core.resultant", "resultant(" << p << ", " << q << ") = " << res);
+			return UnivariatePolynomial<Coeff>(p.main_var(), res);
+		}
+	}
 
 	UnivariatePolynomial<Coeff> res = subresultants(p.normalized(), q.normalized(), strategy).front();
 
@@ -0,0 +1,242 @@
+/**
+ * @file Resultant_modular.h
+ *
+ * Native modular resultant computation for polynomials with multivariate coefficients.
+ * Instead of running a subresultant sequence over the multivariate coefficients, whose
+ * intermediate results grow quickly with the number of variables, the resultant is computed
+ * modulo word-size primes p: the variables of the coefficients are evaluated one at a time
+ * at sufficiently many points, the univariate resultants over Z_p are computed by the
+ * euclidean algorithm and the images are interpolated again (dense Newton interpolation).
+ * The images modulo different primes are finally lifted to the integers by chinese remaindering.
+ */
+
+#pragma once
+
+#include "GCD_modular.h"
+
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+namespace carl {
+namespace resultant_detail {
+
+using gcd_detail::ExponentVector;
+using gcd_detail::SparsePolynomial;
+
+/// Univariate polynomial in the main variable, whose coefficients are sparse polynomials, ordered by increasing degree.
+template<typename Coeff>
+using SparseUnivariate = std::vector<SparsePolynomial<Coeff>>;
+
+/// Maps exponent vectors of the remaining variables to dense polynomials in the variable that is interpolated.
+using Interpolant = std::map<ExponentVector, PrimeFieldPolynomial, std::greater<ExponentVector>>;
+
+/// Indicates whether resultant_modular() can be used for coefficients of type Coeff.
+template<typename Coeff>
+struct is_modular_coefficient: std::false_type {};
+template<typename O, typename P>
+struct is_modular_coefficient<MultivariatePolynomial<mpq_class,O,P>>: std::true_type {};
+template<typename O, typename P>
+struct is_modular_coefficient<MultivariatePolynomial<mpz_class,O,P>>: std::true_type {};
+
+/**
+ * Adds the image at alpha to a Newton interpolant whose previous evaluation points are the roots of modulus.
+ * Both the image and the interpolant are sorted descending.
+ */
+inline void interpolate(Interpolant& interpolant, const PrimeFieldPolynomial& modulus, PrimeField::Element alpha, const SparsePolynomial<PrimeField::Element>& image, const PrimeField& f) {
+	for (const auto& t: image) interpolant.try_emplace(t.first);
+	PrimeField::Element factor = f.inv(primefield::evaluate(modulus, alpha, f));
+	auto img = image.begin();
+	for (auto it = interpolant.begin(); it != interpolant.end();) {
+		PrimeField::Element target = 0;
+		if (img != image.end() && img->first == it->first) {
+			target = img->second;
+			++img;
+		}
+		PrimeField::Element diff = f.mul(f.sub(target, primefield::evaluate(it->second, alpha, f)), factor);
+		if (diff != 0) {
+			if (it->second.size() < modulus.size()) it->second.resize(modulus.size(), 0);
+			for (std::size_t i = 0; i < modulus.size(); ++i) {
+				it->second[i] = f.add(it->second[i], f.mul(diff, modulus[i]));
+			}
+			primefield::trim(it->second);
+		}
+		if (it->second.empty()) it = interpolant.erase(it);
+		else ++it;
+	}
+}
+
+/**
+ * Substitutes alpha for the last variable in all coefficients of p.
+ * @return false if the leading coefficient vanishes, i.e. the degree in the main variable drops.
+ */
+inline bool evaluate_last(const SparseUnivariate<PrimeField::Element>& p, PrimeField::Element alpha, SparseUnivariate<PrimeField::Element>& res, const PrimeField& f) {
+	res.resize(p.size());
+	res.back() = gcd_detail::evaluate_last(p.back(), alpha, f);
+	if (res.back().empty()) return false;
+	for (std::size_t i = 0; i + 1 < p.size(); ++i) {
+		res[i] = gcd_detail::evaluate_last(p[i], alpha, f);
+	}
+	return true;
+}
+
+/**
+ * Computes the resultant of a and b in Z_p[x_1,...,x_k][x] with respect to x, where k is the length of the exponent vectors.
+ * The variable x_k is evaluated at bounds[k-1]+1 points where both leading coefficients do not vanish,
+ * such that the resultant of the images is the image of the resultant, and the results are interpolated.
+ * @return The resultant, or std::nullopt if the field is too small to find enough evaluation points.
+ */
+inline std::optional<SparsePolynomial<PrimeField::Element>> resultant_mod_p(const SparseUnivariate<PrimeField::Element>& a, const SparseUnivariate<PrimeField::Element>& b, std::size_t k, const std::vector<std::size_t>& bounds, const PrimeField& f) {
+	if (k == 0) {
+		PrimeFieldPolynomial da;
+		for (const auto& c: a) da.push_back(c.empty() ? 0 : c.front().second);
+		PrimeFieldPolynomial db;
+		for (const auto& c: b) db.push_back(c.empty() ? 0 : c.front().second);
+		PrimeField::Element r = primefield::resultant(da, db, f);
+		if (r == 0) return SparsePolynomial<PrimeField::Element>();
+		return SparsePolynomial<PrimeField::Element>({{ExponentVector(), r}});
+	}
+	Interpolant interpolant;
+	PrimeFieldPolynomial modulus = {1};
+	SparseUnivariate<PrimeField::Element> ea;
+	SparseUnivariate<PrimeField::Element> eb;
+	for (PrimeField::Element alpha = 0; alpha < f.p(); ++alpha) {
+		if (!evaluate_last(a, alpha, ea, f) || !evaluate_last(b, alpha, eb, f)) continue;
+		auto image = resultant_mod_p(ea, eb, k - 1, bounds, f);
+		if (!image) return std::nullopt;
+		interpolate(interpolant, modulus, alpha, *image, f);
+		modulus = primefield::multiply(modulus, {f.neg(alpha), 1}, f);
+		if (modulus.size() - 1 > bounds[k - 1]) {
+			return gcd_detail::join_last(interpolant);
+		}
+	}
+	return std::nullopt;
+}
+
+/// Maps a polynomial with integer coefficients to Z_p.
+inline SparseUnivariate<PrimeField::Element> reduce(const SparseUnivariate<mpz_class>& p, const PrimeField& f) {
+	SparseUnivariate<PrimeField::Element> res(p.size());
+	for (std::size_t i = 0; i < p.size(); ++i) {
+		for (const auto& t: p[i]) {
+			PrimeField::Element c = f.reduce(t.second);
+			if (c != 0) res[i].emplace_back(t.first, c);
+		}
+	}
+	return res;
+}
+
+/**
+ * Computes the resultant of two polynomials of positive degree with integer coefficients in n variables.
+ *
+ * The degree of the resultant in every variable is bounded by the degrees of the rows of the sylvester matrix,
+ * which determines the number of evaluation points. The coefficients are bounded by the product of the one-norms
+ * of the rows. The images for different primes are lifted until the product of the primes exceeds twice this bound,
+ * or, as early termination, until the lifted result does not change for an additional prime.
+ */
+inline SparsePolynomial<mpz_class> resultant_integer(const SparseUnivariate<mpz_class>& a, const SparseUnivariate<mpz_class>& b, std::size_t n) {
+	std::size_t dega = a.size() - 1;
+	std::size_t degb = b.size() - 1;
+	std::vector<std::size_t> bounds(n, 0);
+	mpz_class norma;
+	mpz_class normb;
+	for (std::size_t i = 0; i < n; ++i) {
+		std::size_t maxa = 0;
+		for (const auto& c: a) for (const auto& t: c) maxa = std::max<std::size_t>(maxa, t.first[i]);
+		std::size_t maxb = 0;
+		for (const auto& c: b) for (const auto& t: c) maxb = std::max<std::size_t>(maxb, t.first[i]);
+		bounds[i] = degb * maxa + dega * maxb;
+	}
+	for (const auto& c: a) for (const auto& t: c) norma += abs(t.second);
+	for (const auto& c: b) for (const auto& t: c) normb += abs(t.second);
+	mpz_class limit = 2 * carl::pow(norma, degb) * carl::pow(normb, dega);
+
+	WordPrimeFactory primes;
+	std::map<ExponentVector, mpz_class, std::greater<ExponentVector>> lifted;
+	mpz_class modulus;
+	while (true) {
+		PrimeField f(primes.next_prime());
+		auto ap = reduce(a, f);
+		auto bp = reduce(b, f);
+		if (ap.back().empty() || bp.back().empty()) continue;
+		auto image = resultant_mod_p(ap, bp, n, bounds, f);
+		if (!image) continue;
+
+		bool changed = false;
+		if (lifted.empty() && carl::is_zero(modulus)) {
+			for (const auto& t: *image) {
+				lifted.emplace(t.first, mpz_class(f.symmetric(t.second)));
+			}
+			modulus = f.p();
+			changed = true;
+		} else {
+			// Chinese remaindering with symmetric representatives.
+			for (const auto& t: *image) lifted.try_emplace(t.first);
+			PrimeField::Element factor = f.inv(f.reduce(modulus));
+			mpz_class newmodulus = modulus * static_cast<unsigned long>(f.p());
+			mpz_class halfmodulus = newmodulus / 2;
+			auto img = image->begin();
+			for (auto it = lifted.begin(); it != lifted.end();) {
+				PrimeField::Element target = 0;
+				if (img != image->end() && img->first == it->first) {
+					target = img->second;
+					++img;
+				}
+				PrimeField::Element diff = f.mul(f.sub(target, f.reduce(it->second)), factor);
+				if (diff != 0) {
+					changed = true;
+					it->second += modulus * static_cast<unsigned long>(diff);
+					if (it->second > halfmodulus) it->second -= newmodulus;
+				}
+				if (carl::is_zero(it->second)) it = lifted.erase(it);
+				else ++it;
+			}
+			modulus = newmodulus;
+		}
+		if (!changed || modulus > limit) {
+			return SparsePolynomial<mpz_class>(lifted.begin(), lifted.end());
+		}
+	}
+}
+
+/// Converts the coefficients of p to sparse integer polynomials, after multiplication with the common denominator factor.
+template<typename C, typename O, typename P>
+SparseUnivariate<mpz_class> to_sparse(const UnivariatePolynomial<MultivariatePolynomial<C,O,P>>& p, const std::vector<Variable>& vars, C& factor) {
+	factor = C(1);
+	if constexpr (!is_integer_type<C>::value) {
+		for (const auto& c: p.coefficients()) {
+			factor = carl::lcm(get_num(factor), c.main_denom());
+		}
+	}
+	SparseUnivariate<mpz_class> res;
+	for (const auto& c: p.coefficients()) {
+		res.emplace_back(gcd_detail::to_sparse(MultivariatePolynomial<C,O,P>(c * factor), vars));
+	}
+	return res;
+}
+
+/**
+ * Computes the resultant of two polynomials of positive degree with integer or rational coefficients by the modular approach.
+ * Rational coefficients are made integral by multiplication with a common denominator, which is divided out afterwards.
+ */
+template<typename C, typename O, typename P>
+MultivariatePolynomial<C,O,P> resultant_modular(const UnivariatePolynomial<MultivariatePolynomial<C,O,P>>& p, const UnivariatePolynomial<MultivariatePolynomial<C,O,P>>& q) {
+	assert(p.degree() > 0 && q.degree() > 0);
+	carlVariables allvars;
+	for (const auto& c: p.coefficients()) variables(c, allvars);
+	for (const auto& c: q.coefficients()) variables(c, allvars);
+	const std::vector<Variable>& vars = allvars.as_vector();
+
+	C factorp;
+	C factorq;
+	auto sp = to_sparse(p, vars, factorp);
+	auto sq = to_sparse(q, vars, factorq);
+	auto res = gcd_detail::from_sparse<C,O,P>(resultant_integer(sp, sq, vars.size()), vars);
+	if constexpr (!is_integer_type<C>::value) {
+		// res(factorp * p, factorq * q) = factorp^deg(q) * factorq^deg(p) * res(p, q)
+		res /= carl::pow(factorp, q.degree()) * carl::pow(factorq, p.degree());
+	}
+	return res;
+}
+
+}
+}
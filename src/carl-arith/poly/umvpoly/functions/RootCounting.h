@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Evaluation.h"
+#include "Memoization.h"
 #include "SturmSequence.h"
 #include <carl-arith/core/Sign.h>
 #include "../UnivariatePolynomial.h"
@@ -28,6 +29,7 @@ int count_real_roots(const std::vector<UnivariatePolynomial<Coefficient>>& seq,
 
 /**
  * Count the number of real roots of p within the given interval using Sturm sequences.
+ * The Sturm sequence of p is memoized, see cached_sturm_sequence().
  * @param p The polynomial.
  * @param i Count roots within this interval.
  * @return Number of real roots within the interval.
@@ -37,7 +39,7 @@ int count_real_roots(const UnivariatePolynomial<Coefficient>& p, const Interval<
 	assert(!is_zero(p));
 	assert(!carl::is_root_of(p, i.lower()));
 	assert(!carl::is_root_of(p, i.upper()));
-	return count_real_roots(sturm_sequence(p), i);
+	return count_real_roots(*cached_sturm_sequence(p), i);
 }
 
 }
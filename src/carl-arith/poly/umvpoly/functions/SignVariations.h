@@ -4,6 +4,9 @@
 #include "../UnivariatePolynomial.h"
 #include <carl-arith/interval/Interval.h>
 
+#include <map>
+#include <vector>
+
 namespace carl {
 
 namespace detail_sign_variations {
@@ -59,6 +62,115 @@ UnivariatePolynomial<Coefficient> shift(const UnivariatePolynomial<Coefficient>&
 	return UnivariatePolynomial<Coefficient>(p.main_var(), std::move(next));
 }
 
+/**
+ * Shift the variable by one in place, i.e. apply \f$ x \rightarrow x + 1 \f$ to the coefficients (ordered by increasing degree).
+ * Only uses additions.
+ * @complexity O(n^2) additions
+ */
+template<typename Coefficient>
+void shift_by_one_classical(Coefficient* coeffs, std::size_t n) {
+	for (std::size_t i = 0; i + 1 < n; ++i) {
+		for (std::size_t j = n - 1; j > i; --j) {
+			coeffs[j - 1] += coeffs[j];
+		}
+	}
+}
+
+/**
+ * Multiplies two dense integer polynomials.
+ * For GMP integers, we use Kronecker substitution and thereby benefit from the subquadratic integer multiplication of GMP.
+ */
+template<typename Integer>
+std::vector<Integer> multiply_dense(const std::vector<Integer>& a, const std::vector<Integer>& b) {
+	assert(!a.empty() && !b.empty());
+	std::vector<Integer> res(a.size() + b.size() - 1, Integer(0));
+	if constexpr (std::is_same<Integer, mpz_class>::value) {
+		std::size_t bits_a = 0;
+		for (const auto& c: a) bits_a = std::max(bits_a, mpz_sizeinbase(c.get_mpz_t(), 2));
+		std::size_t bits_b = 0;
+		for (const auto& c: b) bits_b = std::max(bits_b, mpz_sizeinbase(c.get_mpz_t(), 2));
+		std::size_t bits = bits_a + bits_b + 2;
+		for (std::size_t len = std::min(a.size(), b.size()); len > 0; len >>= 1) ++bits;
+		auto pack = [bits](const std::vector<Integer>& p) {
+			mpz_class res = 0;
+			for (auto it = p.rbegin(); it != p.rend(); ++it) {
+				mpz_mul_2exp(res.get_mpz_t(), res.get_mpz_t(), bits);
+				res += *it;
+			}
+			return res;
+		};
+		mpz_class prod = pack(a) * pack(b);
+		mpz_class half;
+		mpz_ui_pow_ui(half.get_mpz_t(), 2, bits - 1);
+		for (auto& c: res) {
+			// Extract the lowest digit as a signed number in [-2^(bits-1), 2^(bits-1))
+			mpz_fdiv_r_2exp(c.get_mpz_t(), prod.get_mpz_t(), bits);
+			if (c >= half) c -= 2 * half;
+			prod -= c;
+			mpz_fdiv_q_2exp(prod.get_mpz_t(), prod.get_mpz_t(), bits);
+		}
+		assert(prod == 0);
+	} else {
+		for (std::size_t i = 0; i < a.size(); ++i) {
+			for (std::size_t j = 0; j < b.size(); ++j) {
+				res[i + j] += a[i] * b[j];
+			}
+		}
+	}
+	return res;
+}
+
+/// Below this number of coefficients, shift_by_one uses the classical algorithm.
+static constexpr std::size_t taylor_shift_threshold = 64;
+
+/**
+ * Divide and conquer Taylor shift by one on coeffs[0..n).
+ * We split \f$ p = p_l + x^m p_h \f$ where m is a power of two, shift both parts recursively and compute \f$ p(x+1) = p_l(x+1) + (x+1)^m p_h(x+1) \f$.
+ * The binomial coefficients of \f$ (x+1)^m \f$ are cached in binomials.
+ */
+template<typename Integer>
+void shift_by_one_dc(Integer* coeffs, std::size_t n, std::map<std::size_t, std::vector<Integer>>& binomials) {
+	if (n <= taylor_shift_threshold) {
+		shift_by_one_classical(coeffs, n);
+		return;
+	}
+	std::size_t m = 1;
+	while (2 * m < n) m *= 2;
+	shift_by_one_dc(coeffs, m, binomials);
+	shift_by_one_dc(coeffs + m, n - m, binomials);
+
+	auto it = binomials.find(m);
+	if (it == binomials.end()) {
+		std::vector<Integer> binom(m + 1, Integer(1));
+		for (std::size_t i = 1; i < m; ++i) {
+			binom[i] = carl::div(binom[i - 1] * Integer(m - i + 1), Integer(i));
+		}
+		it = binomials.emplace(m, std::move(binom)).first;
+	}
+	std::vector<Integer> high(coeffs + m, coeffs + n);
+	std::fill(coeffs + m, coeffs + n, Integer(0));
+	auto prod = multiply_dense(high, it->second);
+	assert(prod.size() == n);
+	for (std::size_t i = 0; i < n; ++i) {
+		coeffs[i] += prod[i];
+	}
+}
+
+/**
+ * Shift the variable by one in place, i.e. apply \f$ x \rightarrow x + 1 \f$ to the integer coefficients (ordered by increasing degree).
+ * Uses the classical algorithm for small degrees and a divide and conquer scheme otherwise.
+ * @complexity O(M(n) log n) where M(n) is the cost of multiplying two polynomials of degree n
+ */
+template<typename Integer>
+void shift_by_one(std::vector<Integer>& coeffs) {
+	if (coeffs.size() <= taylor_shift_threshold) {
+		shift_by_one_classical(coeffs.data(), coeffs.size());
+	} else {
+		std::map<std::size_t, std::vector<Integer>> binomials;
+		shift_by_one_dc(coeffs.data(), coeffs.size(), binomials);
+	}
+}
+
 }
 
 /**
@@ -86,7 +198,7 @@ uint sign_variations(const UnivariatePolynomial<Coefficient>& polynomial, const
 	p = detail_sign_variations::shift(p, interval.lower());
 	p = detail_sign_variations::scale(std::move(p), interval.diameter());
 	p = detail_sign_variations::reverse(std::move(p));
-	p = detail_sign_variations::shift(p, carl::constant_one<Coefficient>::get());
+	detail_sign_variations::shift_by_one_classical(p.coefficients().data(), p.coefficients().size());
 	p.strip_leading_zeroes();
 	assert(p.is_consistent());
 	auto res = carl::sign_variations(p.coefficients().begin(), p.coefficients().end(), [](const auto& c){ return carl::sgn(c); });
@@ -43,7 +43,7 @@ UnivariatePolynomial<MultivariatePolynomial<C,O,P>> to_univariate_polynomial(con
 			if (exponent >= coeffs.size()) {
 				coeffs.resize(exponent + 1);
 			}
-			std::shared_ptr<const carl::Monomial> tmp = mon->drop_variable(v);
+			carl::Monomial::Arg tmp = mon->drop_variable(v);
 			coeffs[exponent] += term.coeff() * tmp;
 		}
 	}
@@ -2,12 +2,13 @@
 
 #include <carl-arith/interval/Interval.h>
 #include <carl-arith/poly/umvpoly/functions/IntervalEvaluation.h>
+#include <carl-arith/poly/umvpoly/functions/IntervalEvaluator.h>
 #include <carl-arith/interval/Evaluation.h>
 #include <carl-arith/constraint/BasicConstraint.h>
 #include <carl-arith/constraint/Simplification.h>
 
 #include "Ran.h"
-#include "helper/AlgebraicSubstitution.h"
+#include "helper/AlgebraicSubstitutionCache.h"
 
 #include <boost/logic/tribool_io.hpp>
 #include <optional>
@@ -35,10 +36,7 @@ std::optional<IntRepRealAlgebraicNumber<Number>> evaluate(MultivariatePolynomial
 		if (!p.has(var)) continue;
 		if (refine_model) {
 			CARL_LOG_TRACE("carl.ran.interval", "Refine " << var << " = " << ran);
-			static Number min_width = Number(1) / (Number(1048576)); // 1/2^20, taken from libpoly
-			while (!ran.is_numeric() && ran.interval().diameter() > min_width) {
-				ran.refine();
-			}
+			ran.refine_to_precision(20); // 1/2^20, taken from libpoly
 		}
 		if (ran.is_numeric()) {
 			CARL_LOG_TRACE("carl.ran.interval", "Substitute " << var << " = " << ran);
@@ -83,18 +81,15 @@ std::optional<IntRepRealAlgebraicNumber<Number>> evaluate(MultivariatePolynomial
 	}
 
 	CARL_LOG_TRACE("carl.ran.interval", "Compute result polynomial");
-	static Variable v = fresh_real_variable();
-	std::vector<UnivariatePolynomial<MultivariatePolynomial<Number>>> algebraic_information;
+	auto& cache = ran::interval::algebraic_substitution_cache<Number>();
+	std::vector<Variable> algebraic_variables;
 	for (const auto& [var, ran] : m) {
 		if (var_to_interval.find(var) == var_to_interval.end()) continue;
 		assert(!ran.is_numeric());
-		algebraic_information.emplace_back(replace_main_variable(ran.polynomial_int(), var).template convert<MultivariatePolynomial<Number>>());
+		cache.set_defining_polynomial(var, ran.polynomial_int());
+		algebraic_variables.emplace_back(var);
 	}
-	// substitute RANs with low degrees first
-	std::sort(algebraic_information.begin(), algebraic_information.end(), [](const auto& a, const auto& b){ 
-		return a.degree() > b.degree();
-	});
-	auto res = ran::interval::algebraic_substitution(UnivariatePolynomial<MultivariatePolynomial<Number>>(v, {MultivariatePolynomial<Number>(-p), MultivariatePolynomial<Number>(1)}), algebraic_information);
+	auto res = cache.substitute(p, algebraic_variables);
 	if (!res) {
 		return std::nullopt;
 	}
@@ -107,14 +102,18 @@ std::optional<IntRepRealAlgebraicNumber<Number>> evaluate(MultivariatePolynomial
 	CARL_LOG_TRACE("carl.ran.interval", "-> " << interval);
 
 	CARL_LOG_TRACE("carl.ran.interval", "Compute sturm sequence");
-	auto sturm_seq = sturm_sequence(*res);
+	auto sturm_seq_ptr = cached_sturm_sequence(*res);
+	const auto& sturm_seq = *sturm_seq_ptr;
 	// the interval should include at least one root.
 	CARL_LOG_TRACE("carl.ran.interval", "Refine intervals");
 	assert(!carl::is_zero(*res));
 	assert(carl::is_root_of(*res, interval.lower()) || carl::is_root_of(*res, interval.upper()) || count_real_roots(sturm_seq, interval) >= 1);
+	// p is evaluated repeatedly and only changes if some variable becomes numeric
+	IntervalEvaluator<Number> evaluator(p);
 	while (!interval.is_point_interval() && (carl::is_root_of(*res, interval.lower()) || carl::is_root_of(*res, interval.upper()) || count_real_roots(sturm_seq, interval) != 1)) {
 		CARL_LOG_TRACE("carl.ran.interval", "Refinement step");
 		// refine the result interval until it isolates exactly one real root of the result polynomial
+		bool substituted = false;
 		for (const auto& [var, ran] : m) {
 			if (var_to_interval.find(var) == var_to_interval.end()) continue;
 			ran.refine();
@@ -123,12 +122,14 @@ std::optional<IntRepRealAlgebraicNumber<Number>> evaluate(MultivariatePolynomial
 				for (const auto& entry : m) {
 					if (!p.has(entry.first)) var_to_interval.erase(entry.first);
 				}
+				substituted = true;
 			} else {
 				var_to_interval[var] = ran.interval();
 			}
 		}
 		CARL_LOG_TRACE("carl.ran.interval", "Interval evaluation");
-		interval = carl::evaluate(p, var_to_interval);
+		if (substituted) evaluator = IntervalEvaluator<Number>(p);
+		interval = evaluator.evaluate(var_to_interval);
 	}
 	CARL_LOG_DEBUG("carl.ran.interval", "Result is " << *res << " " << interval);
 	if (interval.is_point_interval()) {
@@ -155,10 +156,7 @@ boost::tribool evaluate(const BasicConstraint<MultivariatePolynomial<Number>>& c
 		for (const auto& [var, ran] : m) {
 			if (!p.has(var)) continue;
 			if (refine_model) {
-				static Number min_width = Number(1) / (Number(1048576)); // 1/2^20, taken from libpoly
-				while (!ran.is_numeric() && ran.interval().diameter() > min_width) {
-					ran.refine();
-				}
+				ran.refine_to_precision(20); // 1/2^20, taken from libpoly
 			}
 			if (ran.is_numeric()) {
 				substitute_inplace(p, var, MultivariatePolynomial<Number>(ran.value()));
@@ -210,19 +208,16 @@ boost::tribool evaluate(const BasicConstraint<MultivariatePolynomial<Number>>& c
 			}
 		}
 
-		// compute the result polynomial	
-		static Variable v = fresh_real_variable();
-		std::vector<UnivariatePolynomial<MultivariatePolynomial<Number>>> algebraic_information;
+		// compute the result polynomial, which is shared by all constraints with the same left hand side at this sample point
+		auto& cache = ran::interval::algebraic_substitution_cache<Number>();
+		std::vector<Variable> algebraic_variables;
 		for (const auto& [var, ran] : m) {
 			if (var_to_interval.find(var) == var_to_interval.end()) continue;
 			assert(!ran.is_numeric());
-			algebraic_information.emplace_back(replace_main_variable(ran.polynomial_int(), var).template convert<MultivariatePolynomial<Number>>());
+			cache.set_defining_polynomial(var, ran.polynomial_int());
+			algebraic_variables.emplace_back(var);
 		}
-		// substitute RANs with low degrees first
-		std::sort(algebraic_information.begin(), algebraic_information.end(), [](const auto& a, const auto& b){ 
-			return a.degree() > b.degree();
-		});
-		auto res = ran::interval::algebraic_substitution(UnivariatePolynomial<MultivariatePolynomial<Number>>(v, {MultivariatePolynomial<Number>(-p), MultivariatePolynomial<Number>(1)}), algebraic_information);
+		auto res = cache.substitute(p, algebraic_variables);
 		// Note that res cannot be zero as v is a fresh variable in v-p.
 		if (!res) {
 			return boost::indeterminate;
@@ -270,7 +265,10 @@ boost::tribool evaluate(const BasicConstraint<MultivariatePolynomial<Number>>& c
 
 		// refine the interval until it is either positive or negative or is contained in (neg_ub,pos_lb)
 		CARL_LOG_DEBUG("carl.ran.interval", "Refine until interval is in (" << neg_ub << "," << pos_lb << ") or interval is positive or negative");
+		// p is evaluated repeatedly and only changes if some variable becomes numeric
+		IntervalEvaluator<Number> evaluator(p);
 		while (!((neg_ub < interval.lower() || neg_ub == 0) && (interval.upper() < pos_lb || pos_lb == 0))) {
+			bool substituted = false;
 			for (const auto& [var, ran] : m) {
 				if (var_to_interval.find(var) == var_to_interval.end()) continue;
 				ran.refine();
@@ -279,11 +277,13 @@ boost::tribool evaluate(const BasicConstraint<MultivariatePolynomial<Number>>& c
 					for (const auto& entry : m) {
 						if (!p.has(entry.first)) var_to_interval.erase(entry.first);
 					}
+					substituted = true;
 				} else {
 					var_to_interval[var] = ran.interval();
 				}
 			}
-			interval = carl::evaluate(p, var_to_interval);
+			if (substituted) evaluator = IntervalEvaluator<Number>(p);
+			interval = evaluator.evaluate(var_to_interval);
 			auto int_res = carl::evaluate(interval, constr.relation());
 			if (!indeterminate(int_res)) {
 				CARL_LOG_DEBUG("carl.ran.interval", "Got result");
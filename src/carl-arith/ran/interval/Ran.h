@@ -16,7 +16,12 @@
 #include "../common/Operations.h"
 #include "../common/NumberOperations.h"
 
+#include <carl-common/config.h>
+
+#include <atomic>
 #include <list>
+#include <memory>
+#include <type_traits>
 #include <boost/logic/tribool.hpp>
 
 namespace carl {
@@ -65,140 +70,320 @@ class IntRepRealAlgebraicNumber {
 	friend Sign sgn(const IntRepRealAlgebraicNumber<Num>& n, const UnivariatePolynomial<Num>& p);
 
 private:
+	/**
+	 * The state of a number. Once published, a content is never modified:
+	 * all modifications are performed on a private copy, see refine_shared().
+	 */
 	struct content {
-		std::optional<UnivariatePolynomial<Number>> polynomial;
+		std::shared_ptr<const UnivariatePolynomial<Number>> polynomial;
 		Interval<Number> interval;
 		/// Sign of polynomial at interval.lower()
 		Sign lower_sign;
+		/// Values of polynomial at the bounds of interval, if known.
+		std::optional<Number> lower_value;
+		std::optional<Number> upper_value;
+		/// Binary logarithm of the number of subintervals for the next step of quadratic interval refinement.
+		std::size_t qir_log_subintervals = 2;
 
 		content(const Interval<Number>& i)
-			: polynomial(std::nullopt), interval(i), lower_sign(Sign::ZERO) {}
+			: polynomial(nullptr), interval(i), lower_sign(Sign::ZERO) {}
 		content(UnivariatePolynomial<Number>&& p, const Interval<Number>& i)
-			: polynomial(std::move(p)), interval(i), lower_sign(Sign::ZERO) {}
-		content(const UnivariatePolynomial<Number>& p, const Interval<Number>& i)
-			: polynomial(p), interval(i), lower_sign(Sign::ZERO) {}
+			: polynomial(std::make_shared<const UnivariatePolynomial<Number>>(std::move(p))), interval(i), lower_sign(Sign::ZERO) {}
 		void simplify_to_point() {
 			assert(interval.is_point_interval());
-			polynomial = std::nullopt;
+			polynomial = nullptr;
 			lower_sign = Sign::ZERO;
+			reset_refinement();
+		}
+		void reset_refinement() {
+			lower_value = std::nullopt;
+			upper_value = std::nullopt;
+			qir_log_subintervals = 2;
 		}
-	};
 
-	mutable std::shared_ptr<content> m_content;
+		bool is_consistent() const {
+			if (interval.is_point_interval()) {
+				return !polynomial && lower_sign == Sign::ZERO;
+			} else {
+				if (interval.contains(0) || interval.contains_integer()) {
+					CARL_LOG_DEBUG("carl.ran.interval", "Interval contains 0 or integer");
+					return false;
+				}
+				if (polynomial->normalized() != carl::squareFreePart(*polynomial).normalized()) {
+					CARL_LOG_DEBUG("carl.ran.interval", "Poly is not square free: " << *polynomial);
+					return false;
+				}
+				auto lsgn = carl::sgn(carl::evaluate(*polynomial, interval.lower()));
+				auto usgn = carl::sgn(carl::evaluate(*polynomial, interval.upper()));
+				if (lsgn == Sign::ZERO || usgn == Sign::ZERO || lsgn == usgn) {
+					CARL_LOG_DEBUG("carl.ran.interval", "Interval does not define a zero");
+					return false;
+				}
+				if (lower_sign != lsgn) {
+					CARL_LOG_DEBUG("carl.ran.interval", "Lower sign does not match");
+					return false;
+				}
+				return true;
+			}
+		}
 
-	static UnivariatePolynomial<Number> replace_variable(const UnivariatePolynomial<Number>& p) {
-		return carl::replace_main_variable(p, auxVariable);
-	}
+		void set_polynomial(const UnivariatePolynomial<Number>& p, Sign sgn) {
+			assert(!interval.is_point_interval());
+			polynomial = std::make_shared<const UnivariatePolynomial<Number>>(replace_variable(p));
+			lower_sign = sgn;
+			reset_refinement();
+			assert(is_consistent());
+		}
 
-	bool is_consistent() const {
-		if (interval_int().is_point_interval()) {
-			return !m_content->polynomial && m_content->lower_sign == Sign::ZERO;
-		} else {
-			if (interval_int().contains(0) || interval_int().contains_integer()) {
-				CARL_LOG_DEBUG("carl.ran.interval", "Interval contains 0 or integer");
-				return false;
+		/**
+		 * Returns the sign of "interval - pivot":
+		 * Returns ZERO if pivot is equal to RAN.
+		 * Returns POSITIVE if pivot is less than RAN resp. the new lower bound.
+		 * Returns NEGATIVE if pivot is greater than RAN resp. the new upper bound.
+		 */
+		Sign refine_internal(const Number& pivot) {
+			assert(interval.contains(pivot));
+			assert(!interval.is_point_interval());
+			Number value = carl::evaluate(*polynomial, pivot);
+			auto psgn = carl::sgn(value);
+			if (psgn == Sign::ZERO) {
+				interval = Interval<Number>(pivot, pivot);
+				simplify_to_point();
+				return Sign::ZERO;
 			}
-			if (polynomial_int().normalized() != carl::squareFreePart(polynomial_int()).normalized()) {
-				CARL_LOG_DEBUG("carl.ran.interval", "Poly is not square free: " << polynomial_int());
-				return false;
+			if (psgn == lower_sign) {
+				interval.set_lower(pivot);
+				lower_value = std::move(value);
+				assert(interval.is_consistent());
+				return Sign::POSITIVE;
+			} else {
+				interval.set_upper(pivot);
+				upper_value = std::move(value);
+				assert(interval.is_consistent());
+				return Sign::NEGATIVE;
 			}
-			auto lsgn = carl::sgn(carl::evaluate(polynomial_int(), interval_int().lower()));
-			auto usgn = carl::sgn(carl::evaluate(polynomial_int(), interval_int().upper()));
-			if (lsgn == Sign::ZERO || usgn == Sign::ZERO || lsgn == usgn) {
-				CARL_LOG_DEBUG("carl.ran.interval", "Interval does not define a zero");
-				return false;
+		}
+
+		std::optional<Sign> refine_using(const Number& pivot) {
+			if (interval.contains(pivot)) {
+				if (interval.is_point_interval()) return Sign::ZERO;
+				else return refine_internal(pivot);
 			}
-			if (m_content->lower_sign != lsgn) {
-				CARL_LOG_DEBUG("carl.ran.interval", "Lower sign does not match");
-				return false;
+			return std::nullopt;
+		}
+
+		/// Returns the value of the polynomial at the given bound of the interval.
+		const Number& bound_value(bool upper) {
+			auto& value = upper ? upper_value : lower_value;
+			if (!value) {
+				value = carl::evaluate(*polynomial, upper ? interval.upper() : interval.lower());
 			}
-			return true;
+			return *value;
 		}
-	}
 
-	void set_polynomial(const UnivariatePolynomial<Number>& p, Sign lower_sign) const {
-		assert(!interval_int().is_point_interval());
-		polynomial_int() = replace_variable(p);
-		m_content->lower_sign = lower_sign;
-		assert(is_consistent());
-	}
+		/// Bisects the interval at a number with a small representation near its center.
+		void bisect() {
+			refine_internal(carl::sample(interval));
+		}
+
+		/**
+		 * Performs one step of quadratic interval refinement as described in @cite Abbott06.
+		 *
+		 * The interval is split into N subintervals of equal width. The root of the secant through the values at the bounds
+		 * is rounded to the nearest inner grid point and the polynomial is evaluated there and at the neighbouring grid point towards the root.
+		 * If the root lies in between, the interval shrinks by the factor N and N is squared for the next step.
+		 * Otherwise the interval still shrinks to the side of the root and N is reduced to its square root.
+		 * Once N drops below four, the interval is bisected instead.
+		 */
+		void refine_quadratic() {
+			if (interval.is_point_interval()) return;
+			if (qir_log_subintervals < 2) {
+				bisect();
+				if (!interval.is_point_interval()) qir_log_subintervals = 2;
+				return;
+			}
+			Number n = carl::pow(Number(2), static_cast<uint>(qir_log_subintervals));
+			Number lower = interval.lower();
+			Number width = (interval.upper() - lower) / n;
+			const Number& flower = bound_value(false);
+			Number position = flower / (flower - bound_value(true)) * n + Number(1) / Number(2);
+			Number index = carl::floor(position);
+			Number maxindex = n - 1;
+			if (index < 1) index = 1;
+			else if (index > maxindex) index = maxindex;
+			Number pivot = lower + index * width;
+			Sign psgn = refine_internal(pivot);
+			if (psgn == Sign::ZERO) return;
+			// The grid point next to pivot towards the root, unless it is a bound of the interval.
+			bool success = true;
+			if (psgn == Sign::POSITIVE && index < maxindex) {
+				success = refine_internal(pivot + width) != Sign::POSITIVE;
+			} else if (psgn == Sign::NEGATIVE && index > 1) {
+				success = refine_internal(pivot - width) != Sign::NEGATIVE;
+			}
+			if (interval.is_point_interval()) return;
+			if (success) {
+				qir_log_subintervals *= 2;
+			} else {
+				qir_log_subintervals /= 2;
+			}
+		}
+
+		/// Refines until the interval has at most the given width.
+		void refine_to_width(const Number& width) {
+			while (!interval.is_point_interval() && interval.diameter() > width) {
+				refine_quadratic();
+			}
+		}
+
+		/// Refines until the number is either numeric or the interval does not contain any integer.
+		void refine_to_integrality() {
+			while (!interval.is_point_interval() && interval.contains_integer()) {
+				bisect();
+			}
+		}
+	};
 
 	/**
-	 * Returns the sign of "interval_int() - pivot":
-	 * Returns ZERO if pivot is equal to RAN.
-	 * Returns POSITIVE if pivot is less than RAN resp. the new lower bound.
-	 * Returns NEGATIVE if pivot is greater than RAN resp. the new upper bound.
+	 * Holds the latest content of a number, which is shared by all its copies.
+	 * If THREAD_SAFE is set, the content is published atomically such that a number and its copies can be refined
+	 * from different threads: refinements are applied to a private copy, which is published with compare-and-swap.
+	 * Loading the content never blocks on a concurrent refinement.
+	 * Otherwise, the content is refined in place.
 	 */
-	Sign refine_internal(const Number& pivot) const {
-		// assert(is_consistent());
-		assert(interval_int().contains(pivot));
-		assert(!interval_int().is_point_interval());
-		auto psgn = carl::sgn(carl::evaluate(polynomial_int(), pivot));
-		if (psgn == Sign::ZERO) {
-			interval_int() = Interval<Number>(pivot, pivot);
-			m_content->simplify_to_point();
-			return Sign::ZERO;
+	class shared_content {
+#ifdef THREAD_SAFE
+		std::atomic<std::shared_ptr<const content>> m_published;
+	public:
+		explicit shared_content(content&& c)
+			: m_published(std::make_shared<const content>(std::move(c))) {}
+
+		std::shared_ptr<const content> load() const {
+			return m_published.load(std::memory_order_acquire);
 		}
-		if (psgn == m_content->lower_sign) {
-			interval_int().set_lower(pivot);
-			assert(interval_int().is_consistent());
-			return Sign::POSITIVE;
-		} else {
-			interval_int().set_upper(pivot);
-			assert(interval_int().is_consistent());
-			return Sign::NEGATIVE;
+
+		/**
+		 * Applies a modification to a private copy of the latest published content and publishes the result with compare-and-swap.
+		 * If a concurrent refinement was published in the meantime, the modification is repeated on the newer content.
+		 * As refinements only shrink the interval, the latest published content always has the tightest interval.
+		 * @return The result of f for the published content.
+		 */
+		template<typename F>
+		auto modify(F&& f) {
+			auto current = load();
+			std::shared_ptr<content> next;
+			while (true) {
+				if (next) *next = *current;
+				else next = std::make_shared<content>(*current);
+				if constexpr (std::is_void_v<std::invoke_result_t<F&, content&>>) {
+					f(*next);
+					if (m_published.compare_exchange_strong(current, next, std::memory_order_acq_rel, std::memory_order_acquire)) return;
+				} else {
+					auto res = f(*next);
+					if (m_published.compare_exchange_strong(current, next, std::memory_order_acq_rel, std::memory_order_acquire)) return res;
+				}
+			}
+		}
+#else
+		content m_content;
+	public:
+		explicit shared_content(content&& c)
+			: m_content(std::move(c)) {}
+
+		const content* load() const {
+			return &m_content;
 		}
+
+		template<typename F>
+		auto modify(F&& f) {
+			return f(m_content);
+		}
+#endif
+	};
+
+	std::shared_ptr<shared_content> m_shared;
+
+	static UnivariatePolynomial<Number> replace_variable(const UnivariatePolynomial<Number>& p) {
+		return carl::replace_main_variable(p, auxVariable);
+	}
+
+	/// Creates the content shared by all copies of this number.
+	void publish(content&& c) {
+		assert(c.is_consistent());
+		m_shared = std::make_shared<shared_content>(std::move(c));
+	}
+
+	/// Applies a refinement f to the content, see shared_content::modify().
+	template<typename F>
+	auto refine_shared(F&& f) const {
+		return m_shared->modify(std::forward<F>(f));
+	}
+
+	void set_polynomial(const UnivariatePolynomial<Number>& p, Sign lower_sign) const {
+		refine_shared([&p, lower_sign](content& c) {
+			if (!c.interval.is_point_interval()) c.set_polynomial(p, lower_sign);
+		});
 	}
 
 public:
+	/// Refines the interval using quadratic interval refinement, see content::refine_quadratic().
 	void refine() const {
 		if (is_numeric()) return;
-		Number pivot = carl::sample(interval_int());
-		refine_internal(pivot);
+		refine_shared([](content& c) { c.refine_quadratic(); });
 	}
 
-	std::optional<Sign> refine_using(const Number& pivot) const {
-		if (interval_int().contains(pivot)) {
-			if (is_numeric()) return Sign::ZERO;
-			else return refine_internal(pivot);
-		}
-		return std::nullopt;
+	/**
+	 * Refines the interval until its width is at most 2^-bits.
+	 * @param bits Requested precision in bits.
+	 */
+	void refine_to_precision(std::size_t bits) const {
+		Number width = Number(1) / carl::pow(Number(2), static_cast<uint>(bits));
+		auto cur = snapshot();
+		if (cur->interval.is_point_interval() || cur->interval.diameter() <= width) return;
+		refine_shared([&width](content& c) { c.refine_to_width(width); });
 	}
 
-private:
-	/// Refines until the number is either numeric or the interval does not contain any integer.
-	void refine_to_integrality() const {
-		while (!interval_int().is_point_interval() && interval_int().contains_integer()) {
-			refine();
-		}
+	std::optional<Sign> refine_using(const Number& pivot) const {
+		auto cur = snapshot();
+		// Intervals only shrink, hence the pivot is not contained in any later interval either.
+		if (!cur->interval.contains(pivot)) return std::nullopt;
+		if (cur->interval.is_point_interval()) return Sign::ZERO;
+		return refine_shared([&pivot](content& c) -> std::optional<Sign> {
+			// The pivot may lie outside of a tighter interval published concurrently.
+			if (auto res = c.refine_using(pivot)) return res;
+			return pivot < c.interval.lower() ? Sign::POSITIVE : Sign::NEGATIVE;
+		});
 	}
 
 public:
-	IntRepRealAlgebraicNumber()
-		: m_content(std::make_shared<content>(Interval<Number>(0))) {}
+	IntRepRealAlgebraicNumber() {
+		publish(content(Interval<Number>(0)));
+	}
 
-	IntRepRealAlgebraicNumber(const Number& n)
-		: m_content(std::make_shared<content>(Interval<Number>(n))) {}
+	IntRepRealAlgebraicNumber(const Number& n) {
+		publish(content(Interval<Number>(n)));
+	}
 
-	IntRepRealAlgebraicNumber(const UnivariatePolynomial<Number>& p, const Interval<Number>& i)
-		: m_content(std::make_shared<content>(replace_variable(p), i)) {
+	IntRepRealAlgebraicNumber(const UnivariatePolynomial<Number>& p, const Interval<Number>& i) {
 		CARL_LOG_DEBUG("carl.ran.interval", "Creating (" << p << "," << i << ")");
-		assert(!carl::is_zero(polynomial_int()) && polynomial_int().degree() > 0);
-		assert(interval_int().is_open_interval() || interval_int().is_point_interval());
-		// assert(interval_int().is_point_interval() || count_real_roots(sturm_sequence(), interval_int()) == 1);
-		if (interval_int().is_point_interval()) {
-			m_content->simplify_to_point();
-		} else if (polynomial_int().degree() == 1) {
-			Number a = polynomial_int().coefficients()[1];
-			Number b = polynomial_int().coefficients()[0];
-			interval_int() = Interval<Number>(Number(-b / a));
-			m_content->simplify_to_point();
+		content c(replace_variable(p), i);
+		assert(!carl::is_zero(*c.polynomial) && c.polynomial->degree() > 0);
+		assert(c.interval.is_open_interval() || c.interval.is_point_interval());
+		// assert(c.interval.is_point_interval() || count_real_roots(sturm_sequence(), c.interval) == 1);
+		if (c.interval.is_point_interval()) {
+			c.simplify_to_point();
+		} else if (c.polynomial->degree() == 1) {
+			Number a = c.polynomial->coefficients()[1];
+			Number b = c.polynomial->coefficients()[0];
+			c.interval = Interval<Number>(Number(-b / a));
+			c.simplify_to_point();
 		} else {
-			m_content->lower_sign = carl::sgn(carl::evaluate(polynomial_int(), interval_int().lower()));
-			if (interval_int().contains(0)) refine_using(0);
-			refine_to_integrality();
+			c.lower_value = carl::evaluate(*c.polynomial, c.interval.lower());
+			c.lower_sign = carl::sgn(*c.lower_value);
+			if (c.interval.contains(0)) c.refine_using(0);
+			c.refine_to_integrality();
 		}
-		assert(is_consistent());
+		publish(std::move(c));
 	}
 
 	IntRepRealAlgebraicNumber(const IntRepRealAlgebraicNumber& ran) = default;
@@ -211,29 +396,51 @@ public:
 		return IntRepRealAlgebraicNumber<Number>(carl::squareFreePart(p), i);
 	}
 
+	/**
+	 * Returns the latest content. All queries on a single snapshot are consistent, even if the number is refined concurrently.
+	 * If THREAD_SAFE is set, the snapshot stays valid while it is held.
+	 */
+	auto snapshot() const {
+		return m_shared->load();
+	}
+
 	bool is_numeric() const {
-		return interval_int().is_point_interval();
+		return snapshot()->interval.is_point_interval();
 	}
 
-	const auto& polynomial() const {
-		assert(!is_numeric());
-		return *(m_content->polynomial);
+#ifdef THREAD_SAFE
+	/// The accessors return copies, as a concurrent refinement may release the content they are read from.
+	using polynomial_type = UnivariatePolynomial<Number>;
+	using interval_type = Interval<Number>;
+	using value_type = Number;
+#else
+	using polynomial_type = const UnivariatePolynomial<Number>&;
+	using interval_type = const Interval<Number>&;
+	using value_type = const Number&;
+#endif
+
+	polynomial_type polynomial() const {
+		auto c = snapshot();
+		assert(!c->interval.is_point_interval());
+		return *(c->polynomial);
 	}
-	const auto& interval() const {
-		assert(!is_numeric());
-		return m_content->interval;
+	interval_type interval() const {
+		auto c = snapshot();
+		assert(!c->interval.is_point_interval());
+		return c->interval;
 	}
 
-	const auto& value() const {
-		assert(is_numeric());
-		return interval_int().lower();
+	value_type value() const {
+		auto c = snapshot();
+		assert(c->interval.is_point_interval());
+		return c->interval.lower();
 	}
 
-	auto& polynomial_int() const {
-		return *(m_content->polynomial);
+	polynomial_type polynomial_int() const {
+		return *(snapshot()->polynomial);
 	}
-	auto& interval_int() const {
-		return m_content->interval;
+	interval_type interval_int() const {
+		return snapshot()->interval;
 	}
 };
 
@@ -315,36 +522,39 @@ inline Number integer_below(const IntRepRealAlgebraicNumber<Number>& n) {
 
 template<typename Number>
 static IntRepRealAlgebraicNumber<Number> abs(const IntRepRealAlgebraicNumber<Number>& n) {
-	assert(!n.interval_int().contains(constant_zero<Number>::get()) || n.interval_int().is_point_interval());
-	if (n.interval_int().is_semi_positive()) {
+	auto c = n.snapshot();
+	assert(!c->interval.contains(constant_zero<Number>::get()) || c->interval.is_point_interval());
+	if (c->interval.is_semi_positive()) {
 		return n;
 	}
 	else {
-		if (n.is_numeric()) {
-			return IntRepRealAlgebraicNumber<Number>(carl::abs(n.value()));
+		if (c->interval.is_point_interval()) {
+			return IntRepRealAlgebraicNumber<Number>(carl::abs(c->interval.lower()));
 		} else {
-			return IntRepRealAlgebraicNumber<Number>(n.polynomial_int().negate_variable(), abs(n.interval_int()));
+			return IntRepRealAlgebraicNumber<Number>(c->polynomial->negate_variable(), abs(c->interval));
 		}
 	}
 }
 
 template<typename Number>
 std::size_t bitsize(const IntRepRealAlgebraicNumber<Number>& n) {
-	if (n.is_numeric()) {
-		return carl::bitsize(n.interval_int().lower()) + carl::bitsize(n.interval_int().upper());
+	auto c = n.snapshot();
+	if (c->interval.is_point_interval()) {
+		return carl::bitsize(c->interval.lower()) + carl::bitsize(c->interval.upper());
 	} else {
-		return carl::bitsize(n.interval_int().lower()) + carl::bitsize(n.interval_int().upper()) + n.polynomial_int().degree();
+		return carl::bitsize(c->interval.lower()) + carl::bitsize(c->interval.upper()) + c->polynomial->degree();
 	}
 }
 
 template<typename Number>
 Sign sgn(const IntRepRealAlgebraicNumber<Number>& n) {
-	if (n.interval_int().is_point_interval()) return carl::sgn(n.interval_int().lower());
-	assert(!n.interval_int().contains(constant_zero<Number>::get()));
-	if (n.interval_int().is_semi_positive())
+	auto c = n.snapshot();
+	if (c->interval.is_point_interval()) return carl::sgn(c->interval.lower());
+	assert(!c->interval.contains(constant_zero<Number>::get()));
+	if (c->interval.is_semi_positive())
 		return Sign::POSITIVE;
 	else {
-		assert(n.interval_int().is_semi_negative());
+		assert(c->interval.is_semi_negative());
 		return Sign::NEGATIVE;
 	}
 }
@@ -352,9 +562,10 @@ Sign sgn(const IntRepRealAlgebraicNumber<Number>& n) {
 template<typename Number>
 Sign sgn(const IntRepRealAlgebraicNumber<Number>& n, const UnivariatePolynomial<Number>& p) {
 	UnivariatePolynomial<Number> tmp = IntRepRealAlgebraicNumber<Number>::replace_variable(p);
-	if (n.polynomial_int() == tmp) return Sign::ZERO;
-	auto seq = carl::sturm_sequence(n.polynomial_int(), derivative(n.polynomial_int()) * tmp);
-	int variations = carl::count_real_roots(seq, n.interval_int());
+	auto c = n.snapshot();
+	if (*c->polynomial == tmp) return Sign::ZERO;
+	auto seq = carl::sturm_sequence(*c->polynomial, derivative(*c->polynomial) * tmp);
+	int variations = carl::count_real_roots(seq, c->interval);
 	assert((variations == -1) || (variations == 0) || (variations == 1));
 	switch (variations) {
 	case -1:
@@ -371,11 +582,11 @@ Sign sgn(const IntRepRealAlgebraicNumber<Number>& n, const UnivariatePolynomial<
 
 template<typename Number>
 bool contained_in(const IntRepRealAlgebraicNumber<Number>& n, const Interval<Number>& i) {
-	if (!n.is_numeric() && n.interval_int().contains(i.lower())) {
-		n.refine_internal(i.lower());
+	if (!n.is_numeric()) {
+		n.refine_using(i.lower());
 	}
-	if (!n.is_numeric() && n.interval_int().contains(i.upper())) {
-		n.refine_internal(i.upper());
+	if (!n.is_numeric()) {
+		n.refine_using(i.upper());
 	}
 	return i.contains(n.interval_int());
 }
@@ -384,19 +595,21 @@ template<typename Number>
 bool compare(const IntRepRealAlgebraicNumber<Number>& lhs, const IntRepRealAlgebraicNumber<Number>& rhs, const Relation relation) {
 	CARL_LOG_DEBUG("carl.ran.interval", "Compare " << lhs << " " << relation << " " << rhs);
 
-	if (lhs.m_content.get() == rhs.m_content.get()) {
+	if (lhs.m_shared.get() == rhs.m_shared.get()) {
 		CARL_LOG_TRACE("carl.ran.interval", "Contents are equal");
 		return evaluate(Sign::ZERO, relation);
 	}
 
-	if (lhs.interval_int().is_point_interval() && rhs.interval_int().is_point_interval()) {
+	auto l = lhs.snapshot();
+	auto r = rhs.snapshot();
+	if (l->interval.is_point_interval() && r->interval.is_point_interval()) {
 		CARL_LOG_TRACE("carl.ran.interval", "Point interval comparison");
-		return evaluate(lhs.interval_int().lower(), relation, rhs.interval_int().lower());
+		return evaluate(l->interval.lower(), relation, r->interval.lower());
 	}
 
-	if (carl::set_have_intersection(lhs.interval_int(), rhs.interval_int())) {
-		CARL_LOG_TRACE("carl.ran.interval", "Intervals " << lhs.interval_int() << " and " << rhs.interval_int() << " do intersect");
-		auto intersection = carl::set_intersection(lhs.interval_int(), rhs.interval_int());
+	if (carl::set_have_intersection(l->interval, r->interval)) {
+		CARL_LOG_TRACE("carl.ran.interval", "Intervals " << l->interval << " and " << r->interval << " do intersect");
+		auto intersection = carl::set_intersection(l->interval, r->interval);
 		assert(!intersection.is_empty());
 		lhs.refine_using(intersection.lower());
 		rhs.refine_using(intersection.lower());
@@ -404,22 +617,24 @@ bool compare(const IntRepRealAlgebraicNumber<Number>& lhs, const IntRepRealAlgeb
 			lhs.refine_using(intersection.upper());
 			rhs.refine_using(intersection.upper());
 		}
+		l = lhs.snapshot();
+		r = rhs.snapshot();
 	}
 	// now: intervals are either equal or disjoint
-	assert(!carl::set_have_intersection(lhs.interval_int(), rhs.interval_int()) || lhs.interval_int() == rhs.interval_int());
-	if (lhs.interval_int() == rhs.interval_int()) {
-		CARL_LOG_TRACE("carl.ran.interval", "Intervals " << lhs.interval_int() << " and " << rhs.interval_int() << " are equal");
-		if (lhs.is_numeric()) {
-			CARL_LOG_TRACE("carl.ran.interval", "Interval " << lhs.interval_int() << " is a point interval");
+	assert(!carl::set_have_intersection(l->interval, r->interval) || l->interval == r->interval);
+	if (l->interval == r->interval) {
+		CARL_LOG_TRACE("carl.ran.interval", "Intervals " << l->interval << " and " << r->interval << " are equal");
+		if (l->interval.is_point_interval()) {
+			CARL_LOG_TRACE("carl.ran.interval", "Interval " << l->interval << " is a point interval");
 			return evaluate(Sign::ZERO, relation);
 		}
-		if (lhs.polynomial_int() == rhs.polynomial_int()) {
-			CARL_LOG_TRACE("carl.ran.interval", "Polynomials " << lhs.polynomial_int() << " and " << rhs.polynomial_int() << " are equal");
+		if (*l->polynomial == *r->polynomial) {
+			CARL_LOG_TRACE("carl.ran.interval", "Polynomials " << *l->polynomial << " and " << *r->polynomial << " are equal");
 			return evaluate(Sign::ZERO, relation);
 		}
-		auto g = carl::gcd(lhs.polynomial_int(), rhs.polynomial_int());
-		auto lsgn = carl::sgn(carl::evaluate(g, lhs.interval_int().lower()));
-		auto usgn = carl::sgn(carl::evaluate(g, lhs.interval_int().upper()));
+		auto g = carl::gcd(*l->polynomial, *r->polynomial);
+		auto lsgn = carl::sgn(carl::evaluate(g, l->interval.lower()));
+		auto usgn = carl::sgn(carl::evaluate(g, l->interval.upper()));
 		if (lsgn != usgn) {
 			CARL_LOG_TRACE("carl.ran.interval", "gcd(lhs,rhs) has a zero in the common interval");
 			lhs.set_polynomial(g, lsgn);
@@ -430,19 +645,21 @@ bool compare(const IntRepRealAlgebraicNumber<Number>& lhs, const IntRepRealAlgeb
 			if (relation == Relation::EQ) return false;
 			if (relation == Relation::NEQ) return true;
 			CARL_LOG_TRACE("carl.ran.interval", "Refine until intervals become disjoint");
-			while (lhs.interval_int() == rhs.interval_int()) {
+			while (l->interval == r->interval) {
 				lhs.refine();
 				rhs.refine();
+				l = lhs.snapshot();
+				r = rhs.snapshot();
 			}
 		}
 	}
 	// now: intervals are disjoint
-	CARL_LOG_TRACE("carl.ran.interval", "Intervals " << lhs.interval_int() << " and " << rhs.interval_int() << " are disjoint");
-	assert(!carl::set_have_intersection(lhs.interval_int(), rhs.interval_int()));
-	if (lhs.interval_int().upper() <= rhs.interval_int().lower()) {
+	CARL_LOG_TRACE("carl.ran.interval", "Intervals " << l->interval << " and " << r->interval << " are disjoint");
+	assert(!carl::set_have_intersection(l->interval, r->interval));
+	if (l->interval.upper() <= r->interval.lower()) {
 		return relation == Relation::LESS || relation == Relation::LEQ;
 	}
-	if (lhs.interval_int().lower() >= rhs.interval_int().upper()) {
+	if (l->interval.lower() >= r->interval.upper()) {
 		return relation == Relation::GREATER || relation == Relation::GEQ;
 	}
 
@@ -461,9 +678,9 @@ bool compare(const IntRepRealAlgebraicNumber<Number>& lhs, const Number& rhs, co
 		else if (relation == Relation::NEQ)
 			return true;
 		else if (relation == Relation::LESS || relation == Relation::LEQ)
-			return lhs.interval_int().upper() <= rhs;
+			return lhs.snapshot()->interval.upper() <= rhs;
 		else if (relation == Relation::GREATER || relation == Relation::GEQ)
-			return lhs.interval_int().lower() >= rhs;
+			return lhs.snapshot()->interval.lower() >= rhs;
 	}
 	assert(false);
 	return false;
@@ -473,10 +690,11 @@ bool compare(const IntRepRealAlgebraicNumber<Number>& lhs, const Number& rhs, co
 
 template<typename Num>
 std::ostream& operator<<(std::ostream& os, const IntRepRealAlgebraicNumber<Num>& ran) {
-	if (!ran.is_numeric()) {
-		return os << "(IR " << ran.interval() << ", " << ran.polynomial() << ")";
+	auto c = ran.snapshot();
+	if (!c->interval.is_point_interval()) {
+		return os << "(IR " << c->interval << ", " << *c->polynomial << ")";
 	} else {
-		return os << "(NR " << ran.value() << ")";
+		return os << "(NR " << c->interval.lower() << ")";
 	}
 }
 
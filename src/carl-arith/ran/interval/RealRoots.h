@@ -19,18 +19,21 @@ namespace carl {
 
 /**
  * Find all real roots of a univariate 'polynomial' with numeric coefficients within a given 'interval'.
- * The roots are sorted in ascending order.
+ * The roots are isolated using the given 'strategy' and sorted in ascending order.
+ * If 'threads' is larger than one, bisection processes independent intervals in parallel.
  */
 template<typename Coeff, typename Number = typename UnderlyingNumberType<Coeff>::type, EnableIf<std::is_same<Coeff, Number>> = dummy>
 RealRootsResult<IntRepRealAlgebraicNumber<Number>> real_roots(
 		const UnivariatePolynomial<Coeff>& polynomial,
-		const Interval<Number>& interval = Interval<Number>::unbounded_interval()
+		const Interval<Number>& interval = Interval<Number>::unbounded_interval(),
+		RealRootIsolationStrategy strategy = RealRootIsolationStrategy::Default,
+		std::size_t threads = 1
 ) {
 	if (carl::is_zero(polynomial)) {
 		return RealRootsResult<IntRepRealAlgebraicNumber<Number>>::nullified_response();
 	}
 	CARL_LOG_DEBUG("carl.ran.interval", polynomial << " within " << interval);
-	carl::ran::interval::RealRootIsolation rri(polynomial, interval);
+	carl::ran::interval::RealRootIsolation rri(polynomial, interval, strategy, threads);
 	auto r = rri.get_roots();
 	CARL_LOG_DEBUG("carl.ran.interval", "-> " << r);
 	return RealRootsResult<IntRepRealAlgebraicNumber<Number>>::roots_response(std::move(r));
@@ -44,10 +47,12 @@ RealRootsResult<IntRepRealAlgebraicNumber<Number>> real_roots(
 template<typename Coeff, typename Number = typename UnderlyingNumberType<Coeff>::type, DisableIf<std::is_same<Coeff, Number>> = dummy>
 RealRootsResult<IntRepRealAlgebraicNumber<Number>> real_roots(
 		const UnivariatePolynomial<Coeff>& polynomial,
-		const Interval<Number>& interval = Interval<Number>::unbounded_interval()
+		const Interval<Number>& interval = Interval<Number>::unbounded_interval(),
+		RealRootIsolationStrategy strategy = RealRootIsolationStrategy::Default,
+		std::size_t threads = 1
 ) {
 	assert(polynomial.is_univariate());
-	return real_roots(polynomial.convert(std::function<Number(const Coeff&)>([](const Coeff& c){ return c.constant_part(); })), interval);
+	return real_roots(polynomial.convert(std::function<Number(const Coeff&)>([](const Coeff& c){ return c.constant_part(); })), interval, strategy, threads);
 }
 
 /**
@@ -116,7 +121,7 @@ RealRootsResult<IntRepRealAlgebraicNumber<Number>> real_roots(
 		OrderedAssignment<IntRepRealAlgebraicNumber<Number>> ord_ass;
 		for (const auto& ass : ir_map) ord_ass.emplace_back(ass);
 		std::sort(ord_ass.begin(), ord_ass.end(), [](const auto& a, const auto& b){ 
-			return a.second.polynomial().degree() > b.second.polynomial().degree();
+			return a.second.snapshot()->polynomial->degree() > b.second.snapshot()->polynomial->degree();
 		});
 
 		std::optional<UnivariatePolynomial<Number>> evaledpoly = ran::interval::substitute_rans_into_polynomial(polyCopy, ord_ass);
@@ -22,6 +22,7 @@
 #include <carl-arith/poly/umvpoly/CoCoAAdaptor.h>
 #endif
 
+#include <carl-arith/poly/umvpoly/functions/Memoization.h>
 #include <carl-arith/poly/umvpoly/functions/Remainder.h>
 #include <carl-arith/poly/umvpoly/functions/Resultant.h>
 #include <carl-arith/poly/umvpoly/functions/to_univariate_polynomial.h>
@@ -106,7 +107,7 @@ std::optional<UnivariatePolynomial<Number>> algebraic_substitution_resultant(
 		}
 		cur = pseudo_remainder(switch_main_variable(cur, poly.main_var()), poly);
 		CARL_LOG_DEBUG("carl.ran.interval", "Computing resultant of " << cur << " and " << poly);
-		cur = carl::resultant(cur, poly);
+		cur = carl::cached_resultant(cur, poly);
 		CARL_LOG_DEBUG("carl.ran.interval", "-> " << cur);
 	}
 	auto swpoly = switch_main_variable(cur, v);
@@ -0,0 +1,136 @@
+#pragma once
+
+/**
+ * @file AlgebraicSubstitutionCache.h
+ * This file contains carl::ran::interval::AlgebraicSubstitutionCache which stores the results of algebraic substitutions
+ * (see AlgebraicSubstitution.h) for the defining polynomials of a sample point.
+ */
+
+#include "AlgebraicSubstitution.h"
+
+#include <carl-common/datastructures/LRUCache.h>
+
+#include <algorithm>
+#include <map>
+#include <vector>
+
+namespace carl::ran::interval {
+
+/**
+ * Caches algebraic substitutions of the defining polynomials of a sample point into polynomials.
+ *
+ * When many constraints are evaluated at the same sample point, the same defining polynomials are substituted over and over.
+ * For every set of variables, the cache stores the chain of defining polynomials in the order in which they are eliminated,
+ * and the results of substituting them into polynomials p, i.e. the algebraic substitution into aux_variable() - p.
+ *
+ * The result only depends on the defining polynomials and not on the root they isolate.
+ * Hence entries stay valid until the defining polynomial of one of their variables changes, in which case only the entries involving this variable are dropped.
+ * For example, lifting a sample point in a cylindrical algebraic decomposition keeps the entries for the lower dimensions.
+ */
+template<typename Number>
+class AlgebraicSubstitutionCache {
+public:
+	using Polynomial = MultivariatePolynomial<Number>;
+	using Result = std::optional<UnivariatePolynomial<Number>>;
+
+	/// Default capacity of the results for a single set of variables, see LRUCache.
+	static constexpr std::size_t default_capacity = 1024;
+
+private:
+	struct Entry {
+		/// Defining polynomials of the variables, in the order in which they are substituted.
+		std::vector<UnivariatePolynomial<Polynomial>> chain;
+		/// Results of the substitution, keyed by the polynomial.
+		LRUCache<Polynomial, Result> results;
+		Entry(std::vector<UnivariatePolynomial<Polynomial>>&& c, std::size_t capacity): chain(std::move(c)), results(capacity) {}
+	};
+
+	/// Defining polynomial of every variable, as given to set_defining_polynomial().
+	std::map<Variable, UnivariatePolynomial<Number>> m_polynomials;
+	/// Entries by the (sorted) set of variables that are substituted.
+	std::map<std::vector<Variable>, Entry> m_entries;
+	std::size_t m_capacity;
+
+	Entry& entry(const std::vector<Variable>& variables) {
+		auto it = m_entries.find(variables);
+		if (it != m_entries.end()) return it->second;
+		std::vector<UnivariatePolynomial<Polynomial>> chain;
+		for (const auto& v: variables) {
+			chain.emplace_back(replace_main_variable(m_polynomials.at(v), v).template convert<Polynomial>());
+		}
+		// substitute RANs with low degrees first
+		std::sort(chain.begin(), chain.end(), [](const auto& a, const auto& b){
+			return a.degree() > b.degree();
+		});
+		return m_entries.try_emplace(variables, std::move(chain), m_capacity).first->second;
+	}
+
+public:
+	explicit AlgebraicSubstitutionCache(std::size_t capacity = default_capacity): m_capacity(capacity) {}
+	AlgebraicSubstitutionCache(const AlgebraicSubstitutionCache&) = delete;
+	AlgebraicSubstitutionCache& operator=(const AlgebraicSubstitutionCache&) = delete;
+
+	/// The main variable of the results.
+	static Variable aux_variable() {
+		static Variable v = fresh_real_variable();
+		return v;
+	}
+
+	/**
+	 * Sets the defining polynomial of the value of v. Its main variable is replaced by v.
+	 * If it differs from the previous one, all entries involving v are dropped.
+	 */
+	void set_defining_polynomial(Variable v, const UnivariatePolynomial<Number>& p) {
+		auto it = m_polynomials.find(v);
+		if (it == m_polynomials.end()) {
+			m_polynomials.emplace(v, p);
+			return;
+		}
+		if (it->second == p) return;
+		it->second = p;
+		for (auto eit = m_entries.begin(); eit != m_entries.end();) {
+			if (std::binary_search(eit->first.begin(), eit->first.end(), v)) {
+				eit = m_entries.erase(eit);
+			} else {
+				++eit;
+			}
+		}
+	}
+
+	/**
+	 * Substitutes the defining polynomials of the given variables into p.
+	 * @param p Polynomial.
+	 * @param variables Sorted variables to substitute, each must have a defining polynomial.
+	 * @return A univariate polynomial in aux_variable() that vanishes at the value of p, or std::nullopt if the substitution failed.
+	 */
+	Result substitute(const Polynomial& p, const std::vector<Variable>& variables) {
+		assert(std::is_sorted(variables.begin(), variables.end()));
+		Entry& e = entry(variables);
+		return e.results.get_or_compute(p,
+			[&p, &e]() {
+				return algebraic_substitution(UnivariatePolynomial<Polynomial>(aux_variable(), {Polynomial(-p), Polynomial(1)}), e.chain);
+			},
+			[](const Result& r) -> std::size_t {
+				return r ? r->coefficients().size() : 1;
+			}
+		);
+	}
+
+	/// Removes all defining polynomials and entries.
+	void clear() {
+		m_polynomials.clear();
+		m_entries.clear();
+	}
+};
+
+/**
+ * Returns the algebraic substitution cache of the current thread.
+ * Every thread evaluates at its own sample point, hence the caches are not shared between threads.
+ */
+template<typename Number>
+AlgebraicSubstitutionCache<Number>& algebraic_substitution_cache() {
+	thread_local AlgebraicSubstitutionCache<Number> cache;
+	return cache;
+}
+
+}
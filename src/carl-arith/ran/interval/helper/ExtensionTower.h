@@ -0,0 +1,190 @@
+#pragma once
+
+/**
+ * @file ExtensionTower.h
+ * This file contains carl::ran::interval::ExtensionTower, a persistent tower of field extensions that is shared between lifting computations.
+ */
+
+#include "FieldExtensions.h"
+#include <carl-arith/poly/umvpoly/functions/Quotient.h>
+#include <carl-arith/poly/umvpoly/functions/Substitution.h>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace carl::ran::interval {
+
+/**
+ * A level of a persistent tower of field extensions.
+ *
+ * Every level extends the number field of its parent by the value of a single variable, see FieldExtensions::extend().
+ * Levels are immutable once they are created and are shared: extending a level by the same variable and value twice yields the same child,
+ * as long as this child is still in use. Every level owns its parent, but not its children, hence a tower is released level by level
+ * once the evaluations using it are gone.
+ * In a cylindrical algebraic decomposition, sibling cells thus share all lower levels of the tower, and the (expensive) factorizations
+ * of the minimal polynomials are computed only once per sample point prefix.
+ *
+ * Additionally, every level caches the reduction of lifting polynomials (see LazardEvaluation) by its reductor,
+ * keyed by the polynomial as reduced by the parent level. Hence, reducing a polynomial modulo the triangular set is done incrementally,
+ * and lifting the same polynomial over several cells with a common prefix does the prefix work only once.
+ */
+template<typename Rational, typename Poly>
+class ExtensionTower: public std::enable_shared_from_this<ExtensionTower<Rational,Poly>> {
+public:
+	using Ptr = std::shared_ptr<const ExtensionTower>;
+	/// The result of FieldExtensions::extend(): whether the variable is substituted by a term, and the term or the new minimal polynomial.
+	using Reductor = std::pair<bool,Poly>;
+
+private:
+	Ptr mParent;
+	std::size_t mLevel = 0;
+	Variable mVariable = Variable::NO_VARIABLE;
+	std::optional<IntRepRealAlgebraicNumber<Rational>> mValue;
+	FieldExtensions<Rational,Poly> mFieldExtensions;
+	Reductor mReductor;
+
+	/// Protects mChildren and mReduced.
+	mutable std::mutex mMutex;
+	/// The children of this level that are still in use.
+	mutable std::vector<std::weak_ptr<const ExtensionTower>> mChildren;
+	/**
+	 * Reductions of lifting polynomials (reduced by the parent level) by this level, with and without dividing zero factors.
+	 * The memo is released together with the level, but a level close to the root may be used for a long time.
+	 * Hence it is cleared once it holds max_reduced entries.
+	 */
+	mutable std::map<std::pair<Poly,bool>,Poly> mReduced;
+	/// The maximal number of entries of mReduced.
+	static constexpr std::size_t max_reduced = 1024;
+
+	#ifdef THREAD_SAFE
+	#define EXTENSION_TOWER_LOCK_GUARD std::lock_guard<std::mutex> lock(mMutex);
+	#else
+	#define EXTENSION_TOWER_LOCK_GUARD
+	#endif
+
+	struct Private {};
+
+	Poly reduce_once(const Poly& p) const {
+		if (mReductor.first) {
+			return mFieldExtensions.embed(carl::substitute(p, mVariable, mReductor.second));
+		} else {
+			return mFieldExtensions.embed(carl::pseudo_remainder(p, mReductor.second, mVariable));
+		}
+	}
+	Poly divide_once(const Poly& p) const {
+		if (mReductor.first) {
+			return carl::quotient(p, mVariable - mReductor.second);
+		} else {
+			return carl::quotient(p, mReductor.second);
+		}
+	}
+
+public:
+	/// Creates the root of a tower, i.e. the rational numbers. Use root() instead.
+	explicit ExtensionTower(Private) {}
+	/// Creates a level of a tower. Use extend() instead.
+	ExtensionTower(Private, Ptr parent, Variable v, const IntRepRealAlgebraicNumber<Rational>& r):
+		mParent(std::move(parent)), mLevel(mParent->mLevel + 1), mVariable(v), mValue(r), mFieldExtensions(mParent->mFieldExtensions)
+	{
+		mReductor = mFieldExtensions.extend(v, r);
+	}
+
+	/// Creates a new tower that consists of the rational numbers only.
+	static Ptr root() {
+		return std::make_shared<const ExtensionTower>(Private());
+	}
+
+	/// The parent level, or nullptr for the root.
+	const Ptr& parent() const {
+		return mParent;
+	}
+	/// The number of extensions up to this level.
+	std::size_t level() const {
+		return mLevel;
+	}
+	/// The variable of this level. Must not be called on the root.
+	Variable variable() const {
+		assert(mLevel > 0);
+		return mVariable;
+	}
+	/// The value of the variable of this level. Must not be called on the root.
+	const IntRepRealAlgebraicNumber<Rational>& value() const {
+		assert(mLevel > 0);
+		return *mValue;
+	}
+	/// The reductor of this level, see FieldExtensions::extend(). Must not be called on the root.
+	const Reductor& reductor() const {
+		assert(mLevel > 0);
+		return mReductor;
+	}
+	/// The number field up to this level.
+	const FieldExtensions<Rational,Poly>& field_extensions() const {
+		return mFieldExtensions;
+	}
+
+	/**
+	 * Returns the level that extends this one by the value r of v.
+	 * If this level has been extended by v and r before and the child is still in use, the existing child is returned.
+	 */
+	Ptr extend(Variable v, const IntRepRealAlgebraicNumber<Rational>& r) const {
+		EXTENSION_TOWER_LOCK_GUARD
+		mChildren.erase(std::remove_if(mChildren.begin(), mChildren.end(), [](const auto& c){ return c.expired(); }), mChildren.end());
+		for (const auto& c: mChildren) {
+			Ptr child = c.lock();
+			if (child && child->mVariable == v && *child->mValue == r) {
+				CARL_LOG_TRACE("carl.lazard", "Reusing extension by " << v << " -> " << r << " on level " << mLevel);
+				return child;
+			}
+		}
+		auto child = std::make_shared<const ExtensionTower>(Private(), this->shared_from_this(), v, r);
+		mChildren.emplace_back(child);
+		return child;
+	}
+
+	/**
+	 * Reduces p, which is already reduced by all lower levels, by the reductor of this level and embeds it into the number field of this level.
+	 * If divideZeroFactors is set and the result is zero, the factors of p that vanish on this level are divided first.
+	 * Must not be called on the root.
+	 */
+	Poly reduce(const Poly& p, bool divideZeroFactors) const {
+		assert(mLevel > 0);
+		{
+			EXTENSION_TOWER_LOCK_GUARD
+			auto it = mReduced.find(std::make_pair(p, divideZeroFactors));
+			if (it != mReduced.end()) {
+				CARL_LOG_TRACE("carl.lazard", "Reusing reduction of " << p << " on level " << mLevel);
+				return it->second;
+			}
+		}
+		Poly divided = p;
+		Poly res = reduce_once(divided);
+		while (carl::is_zero(res) && divideZeroFactors) {
+			divided = divide_once(divided);
+			res = reduce_once(divided);
+			CARL_LOG_DEBUG("carl.lazard", "Reducing to " << divided);
+		}
+		EXTENSION_TOWER_LOCK_GUARD
+		if (mReduced.size() >= max_reduced) {
+			CARL_LOG_DEBUG("carl.lazard", "Clearing " << mReduced.size() << " reductions on level " << mLevel);
+			mReduced.clear();
+		}
+		mReduced.emplace(std::make_pair(p, divideZeroFactors), res);
+		return res;
+	}
+
+	/**
+	 * Reduces a polynomial that contains variables of all levels up to this one, i.e. applies reduce() on all levels starting at the root.
+	 */
+	Poly reduce_from_root(const Poly& p, bool divideZeroFactors) const {
+		if (mLevel == 0) return p;
+		return reduce(mParent->reduce_from_root(p, divideZeroFactors), divideZeroFactors);
+	}
+
+#undef EXTENSION_TOWER_LOCK_GUARD
+};
+
+}
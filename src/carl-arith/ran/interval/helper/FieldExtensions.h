@@ -2,6 +2,7 @@
 
 #include "../Evaluation.h"
 
+#include <carl-arith/poly/umvpoly/functions/Remainder.h>
 #include <carl-arith/poly/umvpoly/functions/Representation.h>
 
 #ifdef USE_COCOA
@@ -118,6 +119,23 @@ namespace detail_field_extensions {
 		}
 	};
 	#endif
+
+	/**
+	 * Reduces poly modulo a triangular set, given as pairs of a variable and a minimal polynomial in this variable over the previous ones.
+	 * Every minimal polynomial is applied as a univariate polynomial in its own variable, from the last one to the first one:
+	 * reducing with a minimal polynomial does not increase the degrees in the variables of later ones.
+	 * As pseudo remainders are used, the result equals poly up to a factor that is nonzero in the number field,
+	 * hence it is zero if and only if poly vanishes in the number field.
+	 */
+	template<typename Poly>
+	Poly embed(const Poly& poly, const std::vector<std::pair<Variable,Poly>>& minimalPolynomials) {
+		Poly res = poly;
+		for (auto it = minimalPolynomials.rbegin(); it != minimalPolynomials.rend(); ++it) {
+			if (carl::is_zero(res)) break;
+			res = carl::pseudo_remainder(res, it->second, it->first);
+		}
+		return res;
+	}
 }
 
 /**
@@ -128,6 +146,8 @@ template<typename Rational, typename Poly>
 class FieldExtensions {
 private:
 	std::map<Variable,IntRepRealAlgebraicNumber<Rational>> mModel;
+	/// Variables and minimal polynomials of the proper extensions, i.e. the triangular set defining the current number field.
+	std::vector<std::pair<Variable,Poly>> mMinimalPolynomials;
 
 	#ifdef USE_COCOA
 	CoCoA::ring mQ = CoCoA::RingQQ();
@@ -163,14 +183,15 @@ public:
 	 *
 	 * In the first case, we return true and the term to substitute with.
 	 * In the second case, we return false and the new minimal polynomial.
+	 * Only numeric values can be handled without CoCoALib.
 	 */
 	std::pair<bool,Poly> extend(Variable v, const IntRepRealAlgebraicNumber<Rational>& r) {
-		#ifdef USE_COCOA
 		mModel.emplace(v, r);
 		if (r.is_numeric()) {
 			CARL_LOG_DEBUG("carl.ran.interval", "Is numeric: " << v << " -> " << r);
 			return std::make_pair(true, Poly(r.value()));
 		}
+		#ifdef USE_COCOA
 		auto ci = buildPolyRing(v);
 		CoCoA::RingElem p = cc.convertUV(replace_main_variable(r.polynomial(), v), ci);
 		CARL_LOG_DEBUG("carl.ran.interval", "Factorization of " << p << " on " << ci);
@@ -184,7 +205,8 @@ public:
 					return std::make_pair(true, cc.convertMV<Poly>(cf));
 				} else {
 					extendRing(ci, f);
-					return std::make_pair(false, cc.convertMV<Poly>(f));
+					mMinimalPolynomials.emplace_back(v, cc.convertMV<Poly>(f));
+					return std::make_pair(false, mMinimalPolynomials.back().second);
 				}
 			}
 		}
@@ -198,17 +220,19 @@ public:
 		#endif
 	}
 
-	Poly embed(const Poly& poly) { // TODO not functional yet
-		#ifdef USE_COCOA
-		CARL_LOG_DEBUG("carl.ran.interval", "Embed " << poly << " into " << mQ);
-		auto f = cc.convertMV(poly, mQ);
-		CARL_LOG_DEBUG("carl.ran.interval", "Embedding is " << f);
-		return cc.convertMV<Poly>(f);
-		#else
-		CARL_LOG_ERROR("carl.ran.interval", "CoCoALib is not enabled");
-		assert(false);
-		return Poly();
-		#endif
+	/**
+	 * Embeds the given polynomial into the current number field by reducing it modulo the triangular set of minimal polynomials,
+	 * see detail_field_extensions::embed().
+	 */
+	Poly embed(const Poly& poly) const {
+		Poly res = detail_field_extensions::embed(poly, mMinimalPolynomials);
+		CARL_LOG_DEBUG("carl.ran.interval", "Embedded " << poly << " as " << res);
+		return res;
+	}
+
+	/// The variables and minimal polynomials of the proper extensions, in the order of the extensions.
+	const auto& minimal_polynomials() const {
+		return mMinimalPolynomials;
 	}
 };
 
@@ -1,50 +1,55 @@
 #pragma once
 
-#include "FieldExtensions.h"
-#include <carl-arith/poly/umvpoly/functions/Quotient.h>
-#include <carl-arith/poly/umvpoly/functions/Substitution.h>
+#include "ExtensionTower.h"
 
 namespace carl::ran::interval {
 
+/**
+ * Substitutes real algebraic numbers into a lifting polynomial one variable at a time, as used for Lazard's lifting.
+ *
+ * The field extensions are stored in an ExtensionTower. Evaluations that start at the same tower (by default a fresh one)
+ * and substitute the same values reuse the extensions and the reductions of earlier evaluations.
+ * To lift several cells with a common sample point prefix, create one evaluation and copy it for every child,
+ * or start the evaluations of the children from tower() of the parent.
+ */
 template<typename Rational, typename Poly>
 class LazardEvaluation {
+public:
+	using Tower = ExtensionTower<Rational,Poly>;
+
 private:
-	FieldExtensions<Rational,Poly> mFieldExtensions;
+	typename Tower::Ptr mTower;
 	Poly mLiftingPoly;
-	
+
 public:
-	LazardEvaluation(const Poly& p): mLiftingPoly(p) {}
-	
+	LazardEvaluation(const Poly& p): mTower(Tower::root()), mLiftingPoly(p) {}
+	/**
+	 * Starts an evaluation of p at the given tower, reducing p by all its levels.
+	 */
+	LazardEvaluation(const Poly& p, typename Tower::Ptr tower, bool divideZeroFactors = true):
+		mTower(std::move(tower)), mLiftingPoly(mTower->reduce_from_root(p, divideZeroFactors)) {}
+
 	auto substitute(Variable v, const IntRepRealAlgebraicNumber<Rational>& r, bool divideZeroFactors = true) {
-		auto red = mFieldExtensions.extend(v, r);
-		Poly newPoly;
+		mTower = mTower->extend(v, r);
+		const auto& red = mTower->reductor();
 		if (red.first) {
 			CARL_LOG_DEBUG("carl.lazard", "Substituting " << v << " by " << red.second);
-			newPoly = carl::substitute(mLiftingPoly, v, red.second);
 		} else {
 			CARL_LOG_DEBUG("carl.lazard", "Obtained reductor " << red.second);
-			newPoly = carl::remainder(mLiftingPoly, red.second);
 		}
-		// TODO newPoly = mFieldExtensions.embed(newPoly);
-		while (carl::is_zero(newPoly) && divideZeroFactors) {
-			if (red.first) {
-				mLiftingPoly = carl::quotient(mLiftingPoly, v - red.second);
-				newPoly = carl::substitute(mLiftingPoly, v, red.second);
-			} else {
-				mLiftingPoly = carl::quotient(mLiftingPoly, red.second);
-				newPoly = carl::remainder(mLiftingPoly, red.second);
-			}
-			// TODO newPoly = mFieldExtensions.embed(newPoly);
-			CARL_LOG_DEBUG("carl.lazard", "Reducing to " << mLiftingPoly);
-		}
-		mLiftingPoly = newPoly;
+		mLiftingPoly = mTower->reduce(mLiftingPoly, divideZeroFactors);
 		CARL_LOG_DEBUG("carl.lazard", "Remaining poly: " << mLiftingPoly);
 		return red;
 	}
-	
+
 	const auto& getLiftingPoly() const {
 		return mLiftingPoly;
 	}
+
+	/// The tower of field extensions of the values substituted so far.
+	const auto& tower() const {
+		return mTower;
+	}
 };
 
-}
\ No newline at end of file
+}
@@ -11,6 +11,30 @@
 #include <carl-arith/poly/umvpoly/functions/EigenWrapper.h>
 #include <carl-arith/poly/umvpoly/functions/Evaluation.h>
 #include <carl-arith/poly/umvpoly/functions/RootElimination.h>
+#include <carl-common/util/ThreadPool.h>
+
+#include <numeric>
+
+namespace carl {
+
+/// Algorithms for the isolation of real roots of univariate polynomials.
+enum class RealRootIsolationStrategy {
+	/// Bisection, using Descartes' rule of signs on the original polynomial for every interval.
+	Bisection,
+	/// Vincent-Collins-Akritas method on an integral transformation of the polynomial.
+	VCA,
+	Default = Bisection
+};
+
+inline std::ostream& operator<<(std::ostream& os, RealRootIsolationStrategy s) {
+	switch (s) {
+		case RealRootIsolationStrategy::Bisection: return os << "Bisection";
+		case RealRootIsolationStrategy::VCA: return os << "VCA";
+	}
+	return os << "Unknown strategy";
+}
+
+}
 
 namespace carl::ran::interval {
 
@@ -21,6 +45,7 @@ using carl::operator<<;
  * 
  * After some rather easy preprocessing (make polynomial square-free, eliminate zero roots, solve low-degree polynomial trivially, use root bounds to shrink the interval) 
  * we employ bisection which can optionally be initialized by approximations.
+ * Alternatively, the Vincent-Collins-Akritas method can be selected via RealRootIsolationStrategy::VCA.
  */
 template<typename Number>
 class RealRootIsolation {
@@ -35,20 +60,10 @@ class RealRootIsolation {
 	std::vector<IntRepRealAlgebraicNumber<Number>> mRoots;
 	/// The bounding interval.
 	Interval<Number> mInterval;
-	/// The sturm sequence for mPolynomial.
-	// std::optional<std::vector<UnivariatePolynomial<Number>>> mSturmSequence;
-
-	/// Return the sturm sequence for mPolynomial, create it if necessary.
-	// const auto& sturm_sequence() {
-	// 	if (!mSturmSequence) {
-	// 		mSturmSequence = carl::sturm_sequence(mPolynomial);
-	// 	}
-	// 	return *mSturmSequence;
-	// }
-	/// Reset the sturm sequence, used if the polynomial was modified.
-	// void reset_sturm_sequence() {
-	// 	mSturmSequence.reset();
-	// }
+	/// The isolation strategy.
+	RealRootIsolationStrategy mStrategy;
+	/// Number of threads used for bisection.
+	std::size_t mThreads;
 
 	/// Handle zero roots (p(0) == 0)
 	void eliminate_zero_roots() {
@@ -133,7 +148,6 @@ class RealRootIsolation {
 	void add_root(const Number& n) {
 		CARL_LOG_TRACE("carl.ran.interval", "Add root " << n);
 		assert(carl::is_root_of(mPolynomial, n));
-		// reset_sturm_sequence();
 		eliminate_root(mPolynomial, n);
 		mRoots.emplace_back(n);
 	}
@@ -265,6 +279,162 @@ class RealRootIsolation {
 		}
 	}
 
+	/**
+	 * Perform bisection on mThreads threads.
+	 *
+	 * The intervals from the bisection queue are processed as independent tasks of the work-stealing ThreadPool of the calling thread, which is reused across isolations.
+	 * As mPolynomial is shared, a rational root found at a pivot is only eliminated from a copy of the polynomial that is passed on to the two new intervals.
+	 * The results are collected and converted to real algebraic numbers afterwards in the order of the intervals, hence the result does not depend on the scheduling.
+	 */
+	void isolate_by_parallel_bisection() {
+		using Polynomial = std::shared_ptr<const UnivariatePolynomial<Number>>;
+		std::deque<Interval<Number>> queue;
+		if (initialize_bisection_by_approximation) {
+			bisect_by_approximation(queue);
+		} else {
+			queue.emplace_back(mInterval);
+		}
+
+		std::mutex mutex;
+		std::vector<std::pair<Interval<Number>, Polynomial>> isolated;
+		std::vector<Number> rational;
+		ThreadPool& pool = ThreadPool::local(mThreads);
+		std::function<void(const Interval<Number>&, Polynomial)> process = [&](const Interval<Number>& cur, Polynomial poly) {
+			auto variations = carl::sign_variations(*poly, cur);
+			if (variations == 0) {
+				return;
+			}
+			if (variations == 1) {
+				std::lock_guard<std::mutex> lock(mutex);
+				isolated.emplace_back(cur, std::move(poly));
+				return;
+			}
+			auto pivot = carl::sample(cur);
+			if (carl::is_root_of(*poly, pivot)) {
+				auto reduced = *poly;
+				eliminate_root(reduced, pivot);
+				poly = std::make_shared<const UnivariatePolynomial<Number>>(std::move(reduced));
+				std::lock_guard<std::mutex> lock(mutex);
+				rational.emplace_back(pivot);
+			}
+			Interval<Number> left(cur.lower(), BoundType::STRICT, pivot, BoundType::STRICT);
+			Interval<Number> right(pivot, BoundType::STRICT, cur.upper(), BoundType::STRICT);
+			pool.submit([&process, left, poly](){ process(left, poly); });
+			pool.submit([&process, right, poly](){ process(right, poly); });
+		};
+		auto poly = std::make_shared<const UnivariatePolynomial<Number>>(mPolynomial);
+		for (const auto& cur: queue) {
+			pool.submit([&process, cur, poly](){ process(cur, poly); });
+		}
+		pool.wait();
+
+		std::sort(rational.begin(), rational.end());
+		for (const auto& r: rational) {
+			CARL_LOG_DEBUG("carl.ran.interval", "Found root " << r);
+			mRoots.emplace_back(r);
+		}
+		std::sort(isolated.begin(), isolated.end(), [](const auto& a, const auto& b){ return a.first.lower() < b.first.lower(); });
+		for (const auto& i: isolated) {
+			CARL_LOG_DEBUG("carl.ran.interval", "A single root within " << i.first);
+			mRoots.emplace_back(*i.second, i.first);
+		}
+	}
+
+	using Integer = typename IntegralType<Number>::type;
+
+	/// Computes n * 2^e.
+	static void mul_2exp(Integer& n, std::size_t e) {
+		if constexpr (std::is_same<Integer, mpz_class>::value) {
+			mpz_mul_2exp(n.get_mpz_t(), n.get_mpz_t(), e);
+		} else {
+			n *= carl::pow(Integer(2), e);
+		}
+	}
+
+	/// Counts the sign variations of \f$ (x+1)^n q(1/(x+1)) \f$, an upper bound for the number of roots of q within (0,1).
+	static uint descartes_bound(const std::vector<Integer>& q) {
+		std::vector<Integer> tmp(q.rbegin(), q.rend());
+		detail_sign_variations::shift_by_one(tmp);
+		return carl::sign_variations(tmp.begin(), tmp.end(), [](const auto& c){ return carl::sgn(c); });
+	}
+
+	/// Divides q by x-1 in place, assuming that q(1) = 0.
+	static void divide_by_x_minus_one(std::vector<Integer>& q) {
+		Integer carry = 0;
+		for (std::size_t i = q.size() - 1; i > 0; --i) {
+			q[i] += carry;
+			carry = q[i];
+		}
+		assert(carl::is_zero(Integer(q[0] + carry)));
+		q.erase(q.begin());
+	}
+
+	/**
+	 * Perform root isolation using the Vincent-Collins-Akritas method.
+	 *
+	 * We map the open interval mInterval = (l, u) to (0,1) by \f$ q(x) = p(l + (u-l) x) \f$ and make q integral.
+	 * Every node of the search represents the interval \f$ (c/2^k, (c+1)/2^k) \f$ by a polynomial whose roots in (0,1) correspond to the roots of q in this interval.
+	 * The roots in (0,1) are bounded by Descartes' rule of signs and the children are obtained by \f$ q_l(x) = 2^n q(x/2) \f$ and \f$ q_r(x) = q_l(x+1) \f$.
+	 * All transformations are done in place on integer coefficients.
+	 */
+	void isolate_by_vca() {
+		if (mInterval.is_empty() || mInterval.is_point_interval()) return;
+		assert(mInterval.lower_bound_type() != BoundType::INFTY && mInterval.upper_bound_type() != BoundType::INFTY);
+		const Number lower = mInterval.lower();
+		const Number width = mInterval.diameter();
+		auto transformed = detail_sign_variations::scale(detail_sign_variations::shift(mPolynomial, lower), width);
+		std::vector<Integer> q = transformed.coprime_coefficients().coefficients();
+		// Roots on the (excluded) interval bounds
+		while (carl::is_zero(q.front())) q.erase(q.begin());
+		while (carl::is_zero(std::accumulate(q.begin(), q.end(), Integer(0)))) divide_by_x_minus_one(q);
+
+		struct Node {
+			std::vector<Integer> coeffs;
+			Integer c;
+			std::size_t k;
+		};
+		auto to_number = [&lower, &width](const Integer& c, std::size_t k) -> Number {
+			return lower + width * Number(c) / carl::pow(Number(2), k);
+		};
+		std::vector<Node> stack;
+		stack.push_back(Node{ std::move(q), Integer(0), 0 });
+		while (!stack.empty()) {
+			Node cur = std::move(stack.back());
+			stack.pop_back();
+			if (cur.coeffs.size() <= 1) continue;
+
+			auto variations = descartes_bound(cur.coeffs);
+			if (variations == 0) {
+				CARL_LOG_DEBUG("carl.ran.interval", "No root within " << cur.c << " / 2^" << cur.k);
+				continue;
+			}
+			if (variations == 1) {
+				Interval<Number> i(to_number(cur.c, cur.k), BoundType::STRICT, to_number(cur.c + 1, cur.k), BoundType::STRICT);
+				CARL_LOG_DEBUG("carl.ran.interval", "A single root within " << i);
+				assert(count_real_roots(mPolynomial, i) == 1);
+				add_root(i);
+				continue;
+			}
+
+			// Left child: 2^n q(x/2)
+			std::size_t n = cur.coeffs.size() - 1;
+			for (std::size_t i = 0; i < n; ++i) {
+				mul_2exp(cur.coeffs[i], n - i);
+			}
+			if (carl::is_zero(std::accumulate(cur.coeffs.begin(), cur.coeffs.end(), Integer(0)))) {
+				Number mid = to_number(2 * cur.c + 1, cur.k + 1);
+				// Remove the root from mPolynomial, so that it is not an endpoint of an isolating interval.
+				add_root(mid);
+				divide_by_x_minus_one(cur.coeffs);
+			}
+			// Right child: q_l(x+1)
+			std::vector<Integer> right = cur.coeffs;
+			detail_sign_variations::shift_by_one(right);
+			stack.push_back(Node{ std::move(right), 2 * cur.c + 1, cur.k + 1 });
+			stack.push_back(Node{ std::move(cur.coeffs), 2 * cur.c, cur.k + 1 });
+		}
+	}
+
 	/// Do actual root isolation.
 	void compute_roots() {
 		// Handle zero polynomial
@@ -288,12 +458,28 @@ class RealRootIsolation {
 			}
 		}
 
-		// Now do actual bisection
-		isolate_by_bisection();
+		// Now do actual isolation
+		switch (mStrategy) {
+			case RealRootIsolationStrategy::VCA:
+				isolate_by_vca();
+				break;
+			default:
+				if (mThreads > 1) {
+					isolate_by_parallel_bisection();
+				} else {
+					isolate_by_bisection();
+				}
+		}
 	}
 
 public:
-	RealRootIsolation(const UnivariatePolynomial<Number>& polynomial, const Interval<Number>& interval): mPolynomial(carl::squareFreePart(polynomial)), mInterval(interval) {
+	/**
+	 * @param polynomial Polynomial whose roots are isolated.
+	 * @param interval Only roots within this interval are isolated.
+	 * @param strategy Isolation algorithm.
+	 * @param threads Number of threads, only used for bisection.
+	 */
+	RealRootIsolation(const UnivariatePolynomial<Number>& polynomial, const Interval<Number>& interval, RealRootIsolationStrategy strategy = RealRootIsolationStrategy::Default, std::size_t threads = 1): mPolynomial(carl::squareFreePart(polynomial)), mInterval(interval), mStrategy(strategy), mThreads(threads) {
 		CARL_LOG_DEBUG("carl.ran.interval", "Reduced " << polynomial << " to " << mPolynomial);
 	}
 
@@ -307,7 +493,6 @@ public:
 				CARL_LOG_DEBUG("carl.ran.interval", "Coputing root of factor " << factor);
 				mPolynomial = factor.first;
 				mInterval = interval;
-				// reset_sturm_sequence();
 				compute_roots();
 			}
 		} else {
@@ -33,10 +33,7 @@ public:
 
 		for (const auto& [var, ran] : m) {
 			if (refine_model) {
-				static Number min_width = Number(1)/(Number(1048576)); // 1/2^20, taken from libpoly
-				while (!ran.is_numeric() && ran.interval().diameter() > min_width) {
-					ran.refine();
-				}
+				ran.refine_to_precision(20); // 1/2^20, taken from libpoly
 			}
 
 			if (ran.is_numeric()) {
@@ -63,10 +60,7 @@ public:
 		CARL_LOG_TRACE("carl.ran.interval", "Assign " << var << " -> " << ran);
 
 		if (refine_model) {
-			static Number min_width = Number(1)/(Number(1048576)); // 1/2^20, taken from libpoly
-			while (!ran.is_numeric() && ran.interval().diameter() > min_width) {
-				ran.refine();
-			}
+			ran.refine_to_precision(20); // 1/2^20, taken from libpoly
 		}
 
 		if (ran.is_numeric()) {
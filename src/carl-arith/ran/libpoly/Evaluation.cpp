@@ -43,15 +43,15 @@ inline auto lp_sign(carl::Relation rel) {
 	}
 }
 
-boost::tribool evaluate(const BasicConstraint<LPPolynomial>& constraint, const std::map<Variable, LPRealAlgebraicNumber>& evalMap) {
-	CARL_LOG_DEBUG("carl.ran.libpoly", " Evaluation constraint " << constraint << " for assignment " << evalMap);
-
+/**
+ * Evaluates the constraint with respect to the given libpoly assignment, which must correspond to evalMap.
+ */
+inline boost::tribool evaluate_constraint(const BasicConstraint<LPPolynomial>& constraint, const std::map<Variable, LPRealAlgebraicNumber>& evalMap, lp_assignment_t& assignment) {
 	if (is_constant(constraint.lhs())) {
 		return carl::evaluate(constraint.lhs().constant_part(), constraint.relation());
 	}
 
 	auto poly_pol = constraint.lhs().get_internal();
-	lp_assignment_t& assignment = LPAssignment::getInstance().get(evalMap);
 
 	for (const auto& v : carl::variables(constraint)) {
 		if (evalMap.find(v) == evalMap.end()) {
@@ -64,6 +64,25 @@ boost::tribool evaluate(const BasicConstraint<LPPolynomial>& constraint, const s
 	return lp_polynomial_constraint_evaluate(poly_pol, lp_sign(constraint.relation()), &assignment);
 }
 
+boost::tribool evaluate(const BasicConstraint<LPPolynomial>& constraint, const std::map<Variable, LPRealAlgebraicNumber>& evalMap) {
+	CARL_LOG_DEBUG("carl.ran.libpoly", " Evaluation constraint " << constraint << " for assignment " << evalMap);
+	if (is_constant(constraint.lhs())) {
+		return carl::evaluate(constraint.lhs().constant_part(), constraint.relation());
+	}
+	return evaluate_constraint(constraint, evalMap, LPAssignment::getInstance().get(evalMap));
+}
+
+std::vector<boost::tribool> evaluate(const std::vector<BasicConstraint<LPPolynomial>>& constraints, const std::map<Variable, LPRealAlgebraicNumber>& evalMap) {
+	CARL_LOG_DEBUG("carl.ran.libpoly", " Evaluation of " << constraints.size() << " constraints for assignment " << evalMap);
+	lp_assignment_t& assignment = LPAssignment::getInstance().get(evalMap);
+	std::vector<boost::tribool> res;
+	res.reserve(constraints.size());
+	for (const auto& c : constraints) {
+		res.emplace_back(evaluate_constraint(c, evalMap, assignment));
+	}
+	return res;
+}
+
 }
 
 
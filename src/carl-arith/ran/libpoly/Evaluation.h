@@ -6,11 +6,20 @@
 #include "LPRan.h"
 #include "carl-arith/poly/libpoly/LPPolynomial.h"
 
+#include <vector>
+
 namespace carl {
 
 std::optional<LPRealAlgebraicNumber> evaluate(const LPPolynomial& polynomial,const std::map<Variable, LPRealAlgebraicNumber>& evalMap);
 boost::tribool evaluate(const BasicConstraint<LPPolynomial>& constraint, const std::map<Variable, LPRealAlgebraicNumber>& evalMap);
 
+/**
+ * Evaluates all constraints with respect to the same assignment.
+ * The libpoly assignment is only updated once, passing LPAssignment::getInstance().assignment() avoids updating it at all.
+ * @return The results in the order of the constraints.
+ */
+std::vector<boost::tribool> evaluate(const std::vector<BasicConstraint<LPPolynomial>>& constraints, const std::map<Variable, LPRealAlgebraicNumber>& evalMap);
+
 } // namespace carl
 
 #endif
\ No newline at end of file
@@ -17,23 +17,74 @@ LPAssignment::~LPAssignment() {
     lp_assignment_destruct(&lp_assignment);
 }
 
+void LPAssignment::set(Variable v, const LPRealAlgebraicNumber* value) {
+    lp_assignment_set_value(&lp_assignment, LPVariables::getInstance().lp_variable(v), value ? value->get_internal() : nullptr);
+}
+
 lp_assignment_t& LPAssignment::get(const carl::Assignment<LPRealAlgebraicNumber>& ass) {
-    if (last_assignment == ass) {
+    if (&ass == &last_assignment) {
         return lp_assignment;
-    } else {
-        last_assignment = ass; 
-        if (lp_assignment.values) {
-            for (size_t i = 0; i < lp_assignment.size; ++ i) {
-                lp_assignment_set_value(&lp_assignment, i, 0);
-            }
+    }
+    m_stack.clear();
+    // Both maps are sorted, hence we can merge them.
+    bool changed = false;
+    auto it = last_assignment.begin();
+    for (const auto& entry : ass) {
+        while (it != last_assignment.end() && it->first < entry.first) {
+            set(it->first, nullptr);
+            it = last_assignment.erase(it);
+            changed = true;
         }
-        for (const auto& entry : ass) {
-            lp_assignment_set_value(&lp_assignment, LPVariables::getInstance().lp_variable(entry.first), entry.second.get_internal());
+        if (it != last_assignment.end() && it->first == entry.first) {
+            if (!(it->second == entry.second)) {
+                it->second = entry.second;
+                set(it->first, &it->second);
+                changed = true;
+            }
+        } else {
+            it = last_assignment.emplace_hint(it, entry);
+            set(it->first, &it->second);
+            changed = true;
         }
-        return lp_assignment;
+        ++it;
     }
+    while (it != last_assignment.end()) {
+        set(it->first, nullptr);
+        it = last_assignment.erase(it);
+        changed = true;
+    }
+    if (changed) ++m_version;
+    return lp_assignment;
 }
-    
+
+void LPAssignment::push(Variable v, const LPRealAlgebraicNumber& value) {
+    auto it = last_assignment.find(v);
+    if (it == last_assignment.end()) {
+        m_stack.emplace_back(v, std::nullopt);
+        it = last_assignment.emplace(v, value).first;
+    } else {
+        m_stack.emplace_back(v, it->second);
+        it->second = value;
+    }
+    set(v, &it->second);
+    ++m_version;
+}
+
+void LPAssignment::pop() {
+    assert(!m_stack.empty());
+    auto& [v, value] = m_stack.back();
+    if (value) {
+        auto& stored = last_assignment.at(v);
+        stored = std::move(*value);
+        set(v, &stored);
+    } else {
+        last_assignment.erase(v);
+        set(v, nullptr);
+    }
+    m_stack.pop_back();
+    ++m_version;
+}
+
 } // namespace carl
 
-#endif
\ No newline at end of file
+#endif
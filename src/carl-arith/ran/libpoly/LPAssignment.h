@@ -3,9 +3,9 @@
 #include <carl-common/config.h>
 #ifdef USE_LIBPOLY
 
-#include <carl-common/memory/Singleton.h>
 #include <map>
 #include <optional>
+#include <vector>
 #include "../../core/Variable.h"
 #include <poly/poly.h>
 #include <poly/polynomial_context.h>
@@ -16,18 +16,79 @@
 
 namespace carl {
 
-class LPAssignment : public Singleton<LPAssignment> {
-    friend Singleton<LPAssignment>;
-
+/**
+ * Manages the libpoly assignment that is used to evaluate polynomials and constraints.
+ *
+ * Every thread has its own instance (see getInstance()), hence evaluations can be done in parallel.
+ *
+ * The assignment can either be set as a whole by get(const carl::Assignment<LPRealAlgebraicNumber>&),
+ * which only updates the variables whose values have changed, or incrementally by push() and pop().
+ * The latter matches the lifting in the CAD where the assignment is extended and shrunk by one variable at a time.
+ * Every change increases version(), which allows to cache results that depend on the current assignment.
+ */
+class LPAssignment {
     lp_assignment_t lp_assignment;
+    /// The current assignment.
     carl::Assignment<LPRealAlgebraicNumber> last_assignment;
+    /// Variables set by push() together with their previous values.
+    std::vector<std::pair<Variable, std::optional<LPRealAlgebraicNumber>>> m_stack;
+    std::size_t m_version = 0;
 
-public:
     LPAssignment();
+    /// Sets the value of v in the libpoly assignment, nullptr unsets it.
+    void set(Variable v, const LPRealAlgebraicNumber* value);
+
+public:
     ~LPAssignment();
+    LPAssignment(const LPAssignment&) = delete;
+    LPAssignment& operator=(const LPAssignment&) = delete;
+
+    /**
+     * Returns the instance of the current thread.
+     */
+    static LPAssignment& getInstance() {
+        static thread_local LPAssignment instance;
+        return instance;
+    }
+
+    /**
+     * Sets the assignment to ass and returns the libpoly assignment.
+     * Only the variables whose values differ from the current assignment are updated.
+     * Passing assignment() is for free. Other assignments clear the stack of push().
+     */
     lp_assignment_t& get(const carl::Assignment<LPRealAlgebraicNumber>& ass);
+
+    /// Returns the current libpoly assignment.
+    lp_assignment_t& get() {
+        return lp_assignment;
+    }
+
+    /// Returns the current assignment.
+    const carl::Assignment<LPRealAlgebraicNumber>& assignment() const {
+        return last_assignment;
+    }
+
+    /**
+     * Assigns value to v, remembering the previous value of v.
+     */
+    void push(Variable v, const LPRealAlgebraicNumber& value);
+
+    /**
+     * Reverts the last push().
+     */
+    void pop();
+
+    /// Returns the number of push() that have not been reverted.
+    std::size_t depth() const {
+        return m_stack.size();
+    }
+
+    /// Returns a number that changes whenever the assignment is changed.
+    std::size_t version() const {
+        return m_version;
+    }
 };
-    
+
 } // namespace carl
 
-#endif
\ No newline at end of file
+#endif
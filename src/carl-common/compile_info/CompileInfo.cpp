@@ -0,0 +1,486 @@
+#include "CompileInfo.h"
+
+namespace carl {
+
+const std::string CompileInfo::SystemName = "Linux";
+const std::string CompileInfo::SystemVersion = "6.18.44-fc-v139";
+const std::string CompileInfo::BuildType = "RELEASE";
+const std::string CompileInfo::CXXCompiler = "/usr/bin/c++";
+const std::string CompileInfo::CXXCompilerVersion = "12.2.0";
+const std::string CompileInfo::GitRevisionSHA1 = "";
+
+std::ostream& operator<<(std::ostream& os, CMakeOptionPrinter cmop) {
+	auto print = [&os,&cmop](bool advanced, const std::string& type, const std::string& key, const std::string& value) {
+		if (advanced && !cmop.advanced) return;
+		if (type.empty()) return;
+		if (key.empty()) return;
+		if (key[0] == '_') return;
+		if (value.find('\n') == std::string::npos) {
+			os << key << " = " << value << std::endl;
+		} else {
+			os << key << " has multiple lines." << std::endl;
+		}
+	};
+
+	
+	print(false, "BOOL", "ALLWARNINGS", R"VAR(OFF)VAR");
+	print(false, "PATH", "BIN_INSTALL_DIR", R"VAR(/usr/local/lib)VAR");
+	print(false, "", "BOOST_COMPONENTS", R"VAR(system;program_options;unit_test_framework;timer;chrono;serialization)VAR");
+	print(false, "", "Boost_FOUND", R"VAR(TRUE)VAR");
+	print(false, "PATH", "Boost_INCLUDE_DIR", R"VAR(/usr/include)VAR");
+	print(false, "", "Boost_USE_DEBUG_RUNTIME", R"VAR(OFF)VAR");
+	print(false, "", "Boost_USE_STATIC_LIBS", R"VAR(ON)VAR");
+	print(false, "", "Boost_VERSION", R"VAR(1.74.0)VAR");
+	print(false, "", "Boost_VERSION_MAJOR", R"VAR(1)VAR");
+	print(false, "", "Boost_VERSION_MINOR", R"VAR(74)VAR");
+	print(false, "", "Boost_VERSION_PATCH", R"VAR(0)VAR");
+	print(false, "BOOL", "CARL_DEVOPTION_Checkpoints", R"VAR(OFF)VAR");
+	print(false, "BOOL", "CARL_DEVOPTION_Statistics", R"VAR(OFF)VAR");
+	print(false, "FILEPATH", "CLANG_FORMAT", R"VAR(CLANG_FORMAT-NOTFOUND)VAR");
+	print(false, "STRING", "CLANG_SANITIZER", R"VAR(none)VAR");
+	print(false, "FILEPATH", "CLANG_TIDY", R"VAR(CLANG_TIDY-NOTFOUND)VAR");
+	print(false, "BOOL", "CLANG_TIME_TRACE", R"VAR(OFF)VAR");
+	print(true, "FILEPATH", "CMAKE_ADDR2LINE", R"VAR(/usr/bin/addr2line)VAR");
+	print(true, "FILEPATH", "CMAKE_AR", R"VAR(/usr/bin/ar)VAR");
+	print(false, "", "CMAKE_AUTOGEN_ORIGIN_DEPENDS", R"VAR(ON)VAR");
+	print(false, "", "CMAKE_AUTOMOC_COMPILER_PREDEFINES", R"VAR(ON)VAR");
+	print(false, "", "CMAKE_AUTOMOC_MACRO_NAMES", R"VAR(Q_OBJECT;Q_GADGET;Q_NAMESPACE;Q_NAMESPACE_EXPORT)VAR");
+	print(false, "", "CMAKE_AUTOMOC_PATH_PREFIX", R"VAR(OFF)VAR");
+	print(false, "", "CMAKE_BASE_NAME", R"VAR(g++)VAR");
+	print(false, "", "CMAKE_BINARY_DIR", R"VAR(/root/repo/_gate_build)VAR");
+	print(false, "", "CMAKE_BUILD_TOOL", R"VAR(/usr/bin/gmake)VAR");
+	print(false, "STRING", "CMAKE_BUILD_TYPE", R"VAR(RELEASE)VAR");
+	print(false, "", "CMAKE_BUILD_WITH_INSTALL_RPATH", R"VAR(FALSE)VAR");
+	print(false, "INTERNAL", "CMAKE_CACHEFILE_DIR", R"VAR(/root/repo/_gate_build)VAR");
+	print(false, "INTERNAL", "CMAKE_CACHE_MAJOR_VERSION", R"VAR(3)VAR");
+	print(false, "INTERNAL", "CMAKE_CACHE_MINOR_VERSION", R"VAR(25)VAR");
+	print(false, "INTERNAL", "CMAKE_CACHE_PATCH_VERSION", R"VAR(1)VAR");
+	print(false, "", "CMAKE_CFG_INTDIR", R"VAR(.)VAR");
+	print(true, "BOOL", "CMAKE_COLOR_MAKEFILE", R"VAR(ON)VAR");
+	print(false, "INTERNAL", "CMAKE_COMMAND", R"VAR(/usr/bin/cmake)VAR");
+	print(false, "", "CMAKE_COMPILER_IS_GNUCXX", R"VAR(1)VAR");
+	print(false, "INTERNAL", "CMAKE_CPACK_COMMAND", R"VAR(/usr/bin/cpack)VAR");
+	print(false, "", "CMAKE_CROSSCOMPILING", R"VAR(FALSE)VAR");
+	print(false, "INTERNAL", "CMAKE_CTEST_COMMAND", R"VAR(/usr/bin/ctest)VAR");
+	print(false, "", "CMAKE_CURRENT_BINARY_DIR", R"VAR(/root/repo/_gate_build/src/carl-common/compile_info)VAR");
+	print(false, "", "CMAKE_CURRENT_LIST_DIR", R"VAR(/root/repo/src/carl-common/compile_info)VAR");
+	print(false, "", "CMAKE_CURRENT_LIST_FILE", R"VAR(/root/repo/src/carl-common/compile_info/CMakeLists.txt)VAR");
+	print(false, "", "CMAKE_CURRENT_SOURCE_DIR", R"VAR(/root/repo/src/carl-common/compile_info)VAR");
+	print(false, "", "CMAKE_CXX11_EXTENSION_COMPILE_OPTION", R"VAR(-std=gnu++11)VAR");
+	print(false, "", "CMAKE_CXX11_STANDARD_COMPILE_OPTION", R"VAR(-std=c++11)VAR");
+	print(false, "", "CMAKE_CXX11_STANDARD__HAS_FULL_SUPPORT", R"VAR(ON)VAR");
+	print(false, "", "CMAKE_CXX14_COMPILE_FEATURES", R"VAR(cxx_std_14;cxx_aggregate_default_initializers;cxx_attribute_deprecated;cxx_binary_literals;cxx_contextual_conversions;cxx_decltype_auto;cxx_digit_separators;cxx_generic_lambdas;cxx_lambda_init_captures;cxx_relaxed_constexpr;cxx_return_type_deduction;cxx_variable_templates)VAR");
+	print(false, "", "CMAKE_CXX14_EXTENSION_COMPILE_OPTION", R"VAR(-std=gnu++14)VAR");
+	print(false, "", "CMAKE_CXX14_STANDARD_COMPILE_OPTION", R"VAR(-std=c++14)VAR");
+	print(false, "", "CMAKE_CXX14_STANDARD__HAS_FULL_SUPPORT", R"VAR(ON)VAR");
+	print(false, "", "CMAKE_CXX17_COMPILE_FEATURES", R"VAR(cxx_std_17)VAR");
+	print(false, "", "CMAKE_CXX17_EXTENSION_COMPILE_OPTION", R"VAR(-std=gnu++17)VAR");
+	print(false, "", "CMAKE_CXX17_STANDARD_COMPILE_OPTION", R"VAR(-std=c++17)VAR");
+	print(false, "", "CMAKE_CXX20_COMPILE_FEATURES", R"VAR(cxx_std_20)VAR");
+	print(false, "", "CMAKE_CXX20_EXTENSION_COMPILE_OPTION", R"VAR(-std=gnu++20)VAR");
+	print(false, "", "CMAKE_CXX20_STANDARD_COMPILE_OPTION", R"VAR(-std=c++20)VAR");
+	print(false, "", "CMAKE_CXX23_COMPILE_FEATURES", R"VAR(cxx_std_23)VAR");
+	print(false, "", "CMAKE_CXX23_EXTENSION_COMPILE_OPTION", R"VAR(-std=gnu++23)VAR");
+	print(false, "", "CMAKE_CXX23_STANDARD_COMPILE_OPTION", R"VAR(-std=c++23)VAR");
+	print(false, "", "CMAKE_CXX98_COMPILE_FEATURES", R"VAR(cxx_std_98;cxx_template_template_parameters)VAR");
+	print(false, "", "CMAKE_CXX98_EXTENSION_COMPILE_OPTION", R"VAR(-std=gnu++98)VAR");
+	print(false, "", "CMAKE_CXX98_STANDARD_COMPILE_OPTION", R"VAR(-std=c++98)VAR");
+	print(false, "", "CMAKE_CXX98_STANDARD__HAS_FULL_SUPPORT", R"VAR(ON)VAR");
+	print(false, "", "CMAKE_CXX_ABI_COMPILED", R"VAR(TRUE)VAR");
+	print(false, "", "CMAKE_CXX_ARCHIVE_APPEND", R"VAR(<CMAKE_AR> q <TARGET> <LINK_FLAGS> <OBJECTS>)VAR");
+	print(false, "", "CMAKE_CXX_ARCHIVE_APPEND_IPO", R"VAR("/usr/bin/gcc-ar-12" r <TARGET> <LINK_FLAGS> <OBJECTS>)VAR");
+	print(false, "", "CMAKE_CXX_ARCHIVE_CREATE", R"VAR(<CMAKE_AR> qc <TARGET> <LINK_FLAGS> <OBJECTS>)VAR");
+	print(false, "", "CMAKE_CXX_ARCHIVE_CREATE_IPO", R"VAR("/usr/bin/gcc-ar-12" cr <TARGET> <LINK_FLAGS> <OBJECTS>)VAR");
+	print(false, "", "CMAKE_CXX_ARCHIVE_FINISH", R"VAR(<CMAKE_RANLIB> <TARGET>)VAR");
+	print(false, "", "CMAKE_CXX_ARCHIVE_FINISH_IPO", R"VAR("/usr/bin/gcc-ranlib-12" <TARGET>)VAR");
+	print(false, "", "CMAKE_CXX_BYTE_ORDER", R"VAR(LITTLE_ENDIAN)VAR");
+	print(false, "", "CMAKE_CXX_CL_SHOWINCLUDES_PREFIX", R"VAR()VAR");
+	print(true, "FILEPATH", "CMAKE_CXX_COMPILER", R"VAR(/usr/bin/c++)VAR");
+	print(false, "", "CMAKE_CXX_COMPILER_ABI", R"VAR(ELF)VAR");
+	print(true, "FILEPATH", "CMAKE_CXX_COMPILER_AR", R"VAR(/usr/bin/gcc-ar-12)VAR");
+	print(false, "", "CMAKE_CXX_COMPILER_ARG1", R"VAR()VAR");
+	print(false, "", "CMAKE_CXX_COMPILER_ENV_VAR", R"VAR(CXX)VAR");
+	print(false, "", "CMAKE_CXX_COMPILER_FRONTEND_VARIANT", R"VAR()VAR");
+	print(false, "", "CMAKE_CXX_COMPILER_ID", R"VAR(GNU)VAR");
+	print(false, "", "CMAKE_CXX_COMPILER_ID_RUN", R"VAR(1)VAR");
+	print(false, "", "CMAKE_CXX_COMPILER_LOADED", R"VAR(1)VAR");
+	print(false, "", "CMAKE_CXX_COMPILER_PREDEFINES_COMMAND", R"VAR(/usr/bin/c++;-dM;-E;-c;/usr/share/cmake-3.25/Modules/CMakeCXXCompilerABI.cpp)VAR");
+	print(true, "FILEPATH", "CMAKE_CXX_COMPILER_RANLIB", R"VAR(/usr/bin/gcc-ranlib-12)VAR");
+	print(false, "", "CMAKE_CXX_COMPILER_VERSION", R"VAR(12.2.0)VAR");
+	print(false, "", "CMAKE_CXX_COMPILER_VERSION_INTERNAL", R"VAR()VAR");
+	print(false, "", "CMAKE_CXX_COMPILER_WORKS", R"VAR(TRUE)VAR");
+	print(false, "", "CMAKE_CXX_COMPILER_WRAPPER", R"VAR()VAR");
+	print(false, "", "CMAKE_CXX_COMPILE_OBJECT", R"VAR(<CMAKE_CXX_COMPILER> <DEFINES> <INCLUDES> <FLAGS> -o <OBJECT> -c <SOURCE>)VAR");
+	print(false, "", "CMAKE_CXX_COMPILE_OPTIONS_COLOR_DIAGNOSTICS", R"VAR(-fdiagnostics-color=always)VAR");
+	print(false, "", "CMAKE_CXX_COMPILE_OPTIONS_COLOR_DIAGNOSTICS_OFF", R"VAR(-fno-diagnostics-color)VAR");
+	print(false, "", "CMAKE_CXX_COMPILE_OPTIONS_CREATE_PCH", R"VAR(-x;c++-header;-include;<PCH_HEADER>)VAR");
+	print(false, "", "CMAKE_CXX_COMPILE_OPTIONS_EXPLICIT_LANGUAGE", R"VAR(-x;c++)VAR");
+	print(false, "", "CMAKE_CXX_COMPILE_OPTIONS_INVALID_PCH", R"VAR(-Winvalid-pch)VAR");
+	print(false, "", "CMAKE_CXX_COMPILE_OPTIONS_IPO", R"VAR(-flto=auto;-fno-fat-lto-objects)VAR");
+	print(false, "", "CMAKE_CXX_COMPILE_OPTIONS_PIC", R"VAR(-fPIC)VAR");
+	print(false, "", "CMAKE_CXX_COMPILE_OPTIONS_PIE", R"VAR(-fPIE)VAR");
+	print(false, "", "CMAKE_CXX_COMPILE_OPTIONS_SYSROOT", R"VAR(--sysroot=)VAR");
+	print(false, "", "CMAKE_CXX_COMPILE_OPTIONS_USE_PCH", R"VAR(-include;<PCH_HEADER>)VAR");
+	print(false, "", "CMAKE_CXX_COMPILE_OPTIONS_VISIBILITY", R"VAR(-fvisibility=)VAR");
+	print(false, "", "CMAKE_CXX_COMPILE_OPTIONS_VISIBILITY_INLINES_HIDDEN", R"VAR(-fvisibility-inlines-hidden)VAR");
+	print(false, "", "CMAKE_CXX_COMPILE_OPTIONS_WARNING_AS_ERROR", R"VAR(-Werror)VAR");
+	print(false, "", "CMAKE_CXX_CREATE_ASSEMBLY_SOURCE", R"VAR(<CMAKE_CXX_COMPILER> <DEFINES> <INCLUDES> <FLAGS> -S <SOURCE> -o <ASSEMBLY_SOURCE>)VAR");
+	print(false, "", "CMAKE_CXX_CREATE_PREPROCESSED_SOURCE", R"VAR(<CMAKE_CXX_COMPILER> <DEFINES> <INCLUDES> <FLAGS> -E <SOURCE> > <PREPROCESSED_SOURCE>)VAR");
+	print(false, "", "CMAKE_CXX_CREATE_SHARED_LIBRARY", R"VAR(<CMAKE_CXX_COMPILER> <CMAKE_SHARED_LIBRARY_CXX_FLAGS> <LANGUAGE_COMPILE_FLAGS> <LINK_FLAGS> <CMAKE_SHARED_LIBRARY_CREATE_CXX_FLAGS> <SONAME_FLAG><TARGET_SONAME> -o <TARGET> <OBJECTS> <LINK_LIBRARIES>)VAR");
+	print(false, "", "CMAKE_CXX_CREATE_SHARED_MODULE", R"VAR(<CMAKE_CXX_COMPILER> <CMAKE_SHARED_LIBRARY_CXX_FLAGS> <LANGUAGE_COMPILE_FLAGS> <LINK_FLAGS> <CMAKE_SHARED_LIBRARY_CREATE_CXX_FLAGS> <SONAME_FLAG><TARGET_SONAME> -o <TARGET> <OBJECTS> <LINK_LIBRARIES>)VAR");
+	print(false, "", "CMAKE_CXX_DEPENDS_USE_COMPILER", R"VAR(TRUE)VAR");
+	print(false, "", "CMAKE_CXX_DEPFILE_FORMAT", R"VAR(gcc)VAR");
+	print(false, "", "CMAKE_CXX_EXTENSIONS_COMPUTED_DEFAULT", R"VAR(ON)VAR");
+	print(false, "", "CMAKE_CXX_EXTENSIONS_DEFAULT", R"VAR(ON)VAR");
+	print(true, "STRING", "CMAKE_CXX_FLAGS", R"VAR( -Wunknown-pragmas -pthread -fmax-errors=5 -fdiagnostics-color=auto)VAR");
+	print(true, "STRING", "CMAKE_CXX_FLAGS_DEBUG", R"VAR(-g -O1 -gdwarf-4)VAR");
+	print(false, "", "CMAKE_CXX_FLAGS_DEBUG_INIT", R"VAR( -g)VAR");
+	print(false, "", "CMAKE_CXX_FLAGS_INIT", R"VAR(  )VAR");
+	print(true, "STRING", "CMAKE_CXX_FLAGS_MINSIZEREL", R"VAR(-Os -DNDEBUG)VAR");
+	print(false, "", "CMAKE_CXX_FLAGS_MINSIZEREL_INIT", R"VAR( -Os -DNDEBUG)VAR");
+	print(true, "STRING", "CMAKE_CXX_FLAGS_RELEASE", R"VAR(-O3 -DNDEBUG -O3)VAR");
+	print(false, "", "CMAKE_CXX_FLAGS_RELEASE_INIT", R"VAR( -O3 -DNDEBUG)VAR");
+	print(true, "STRING", "CMAKE_CXX_FLAGS_RELWITHDEBINFO", R"VAR(-O2 -g -DNDEBUG)VAR");
+	print(false, "", "CMAKE_CXX_FLAGS_RELWITHDEBINFO_INIT", R"VAR( -O2 -g -DNDEBUG)VAR");
+	print(false, "", "CMAKE_CXX_IGNORE_EXTENSIONS", R"VAR(inl;h;hpp;HPP;H;o;O;obj;OBJ;def;DEF;rc;RC)VAR");
+	print(false, "", "CMAKE_CXX_IMPLICIT_INCLUDE_DIRECTORIES", R"VAR(/usr/include/c++/12;/usr/include/x86_64-linux-gnu/c++/12;/usr/include/c++/12/backward;/usr/lib/gcc/x86_64-linux-gnu/12/include;/usr/local/include;/usr/include/x86_64-linux-gnu;/usr/include)VAR");
+	print(false, "", "CMAKE_CXX_IMPLICIT_LINK_DIRECTORIES", R"VAR(/usr/lib/gcc/x86_64-linux-gnu/12;/usr/lib/x86_64-linux-gnu;/usr/lib;/lib/x86_64-linux-gnu;/lib)VAR");
+	print(false, "", "CMAKE_CXX_IMPLICIT_LINK_FRAMEWORK_DIRECTORIES", R"VAR()VAR");
+	print(false, "", "CMAKE_CXX_IMPLICIT_LINK_LIBRARIES", R"VAR(stdc++;m;gcc_s;gcc;c;gcc_s;gcc)VAR");
+	print(false, "", "CMAKE_CXX_INFORMATION_LOADED", R"VAR(1)VAR");
+	print(false, "", "CMAKE_CXX_LIBRARY_ARCHITECTURE", R"VAR(x86_64-linux-gnu)VAR");
+	print(false, "", "CMAKE_CXX_LINKER_PREFERENCE", R"VAR(30)VAR");
+	print(false, "", "CMAKE_CXX_LINKER_PREFERENCE_PROPAGATES", R"VAR(1)VAR");
+	print(false, "", "CMAKE_CXX_LINKER_WRAPPER_FLAG", R"VAR(-Wl,)VAR");
+	print(false, "", "CMAKE_CXX_LINKER_WRAPPER_FLAG_SEP", R"VAR(,)VAR");
+	print(false, "", "CMAKE_CXX_LINK_EXECUTABLE", R"VAR(<CMAKE_CXX_COMPILER> <FLAGS> <CMAKE_CXX_LINK_FLAGS> <LINK_FLAGS> <OBJECTS> -o <TARGET> <LINK_LIBRARIES>)VAR");
+	print(false, "", "CMAKE_CXX_LINK_OPTIONS_NO_PIE", R"VAR(-no-pie)VAR");
+	print(false, "", "CMAKE_CXX_LINK_OPTIONS_PIE", R"VAR(-fPIE;-pie)VAR");
+	print(false, "", "CMAKE_CXX_LINK_WHAT_YOU_USE_FLAG", R"VAR(LINKER:--no-as-needed)VAR");
+	print(false, "", "CMAKE_CXX_OUTPUT_EXTENSION", R"VAR(.o)VAR");
+	print(false, "", "CMAKE_CXX_PLATFORM_ID", R"VAR(Linux)VAR");
+	print(false, "", "CMAKE_CXX_SIMULATE_ID", R"VAR()VAR");
+	print(false, "", "CMAKE_CXX_SIMULATE_VERSION", R"VAR()VAR");
+	print(false, "", "CMAKE_CXX_SIZEOF_DATA_PTR", R"VAR(8)VAR");
+	print(false, "", "CMAKE_CXX_SOURCE_FILE_EXTENSIONS", R"VAR(C;M;c++;cc;cpp;cxx;m;mm;mpp;CPP;ixx;cppm)VAR");
+	print(false, "", "CMAKE_CXX_STANDARD", R"VAR(20)VAR");
+	print(false, "", "CMAKE_CXX_STANDARD_COMPUTED_DEFAULT", R"VAR(17)VAR");
+	print(false, "", "CMAKE_CXX_STANDARD_DEFAULT", R"VAR(17)VAR");
+	print(false, "", "CMAKE_CXX_STANDARD_REQUIRED", R"VAR(20)VAR");
+	print(false, "", "CMAKE_CXX_VERBOSE_FLAG", R"VAR(-v)VAR");
+	print(false, "", "CMAKE_DEPFILE_FLAGS_CXX", R"VAR(-MD -MT <DEP_TARGET> -MF <DEP_FILE>)VAR");
+	print(false, "", "CMAKE_DISABLE_IN_SOURCE_BUILD", R"VAR(ON)VAR");
+	print(true, "FILEPATH", "CMAKE_DLLTOOL", R"VAR(CMAKE_DLLTOOL-NOTFOUND)VAR");
+	print(false, "", "CMAKE_DL_LIBS", R"VAR(dl)VAR");
+	print(false, "", "CMAKE_EFFECTIVE_SYSTEM_NAME", R"VAR(Linux)VAR");
+	print(false, "INTERNAL", "CMAKE_EXECUTABLE_FORMAT", R"VAR(ELF)VAR");
+	print(false, "", "CMAKE_EXECUTABLE_RPATH_LINK_CXX_FLAG", R"VAR(-Wl,-rpath-link,)VAR");
+	print(false, "", "CMAKE_EXECUTABLE_RUNTIME_CXX_FLAG", R"VAR(-Wl,-rpath,)VAR");
+	print(false, "", "CMAKE_EXECUTABLE_RUNTIME_CXX_FLAG_SEP", R"VAR(:)VAR");
+	print(false, "", "CMAKE_EXECUTABLE_SUFFIX", R"VAR()VAR");
+	print(false, "", "CMAKE_EXE_EXPORTS_CXX_FLAG", R"VAR(-Wl,--export-dynamic)VAR");
+	print(false, "", "CMAKE_EXE_EXPORTS_C_FLAG", R"VAR(-Wl,--export-dynamic)VAR");
+	print(true, "STRING", "CMAKE_EXE_LINKER_FLAGS", R"VAR()VAR");
+	print(true, "STRING", "CMAKE_EXE_LINKER_FLAGS_DEBUG", R"VAR()VAR");
+	print(false, "", "CMAKE_EXE_LINKER_FLAGS_INIT", R"VAR( )VAR");
+	print(true, "STRING", "CMAKE_EXE_LINKER_FLAGS_MINSIZEREL", R"VAR()VAR");
+	print(true, "STRING", "CMAKE_EXE_LINKER_FLAGS_RELEASE", R"VAR()VAR");
+	print(true, "STRING", "CMAKE_EXE_LINKER_FLAGS_RELWITHDEBINFO", R"VAR()VAR");
+	print(false, "", "CMAKE_EXE_LINK_DYNAMIC_CXX_FLAGS", R"VAR(-Wl,-Bdynamic)VAR");
+	print(false, "", "CMAKE_EXE_LINK_DYNAMIC_C_FLAGS", R"VAR(-Wl,-Bdynamic)VAR");
+	print(false, "", "CMAKE_EXE_LINK_STATIC_CXX_FLAGS", R"VAR(-Wl,-Bstatic)VAR");
+	print(false, "", "CMAKE_EXE_LINK_STATIC_C_FLAGS", R"VAR(-Wl,-Bstatic)VAR");
+	print(true, "BOOL", "CMAKE_EXPORT_COMPILE_COMMANDS", R"VAR(ON)VAR");
+	print(false, "INTERNAL", "CMAKE_EXTRA_GENERATOR", R"VAR()VAR");
+	print(false, "", "CMAKE_FILES_DIRECTORY", R"VAR(/CMakeFiles)VAR");
+	print(false, "", "CMAKE_FIND_FRAMEWORK", R"VAR(LAST)VAR");
+	print(false, "", "CMAKE_FIND_LIBRARY_PREFIXES", R"VAR(lib)VAR");
+	print(false, "", "CMAKE_FIND_LIBRARY_SUFFIXES", R"VAR(.a;.so)VAR");
+	print(false, "STATIC", "CMAKE_FIND_PACKAGE_REDIRECTS_DIR", R"VAR(/root/repo/_gate_build/CMakeFiles/pkgRedirects)VAR");
+	print(false, "INTERNAL", "CMAKE_GENERATOR", R"VAR(Unix Makefiles)VAR");
+	print(false, "INTERNAL", "CMAKE_GENERATOR_INSTANCE", R"VAR()VAR");
+	print(false, "INTERNAL", "CMAKE_GENERATOR_PLATFORM", R"VAR()VAR");
+	print(false, "INTERNAL", "CMAKE_GENERATOR_TOOLSET", R"VAR()VAR");
+	print(false, "INTERNAL", "CMAKE_HAVE_LIBC_PTHREAD", R"VAR(1)VAR");
+	print(false, "INTERNAL", "CMAKE_HOME_DIRECTORY", R"VAR(/root/repo)VAR");
+	print(false, "", "CMAKE_HOST_LINUX", R"VAR(1)VAR");
+	print(false, "", "CMAKE_HOST_SYSTEM", R"VAR(Linux-6.18.44-fc-v139)VAR");
+	print(false, "", "CMAKE_HOST_SYSTEM_NAME", R"VAR(Linux)VAR");
+	print(false, "", "CMAKE_HOST_SYSTEM_PROCESSOR", R"VAR(x86_64)VAR");
+	print(false, "", "CMAKE_HOST_SYSTEM_VERSION", R"VAR(6.18.44-fc-v139)VAR");
+	print(false, "", "CMAKE_HOST_UNIX", R"VAR(1)VAR");
+	print(false, "", "CMAKE_INCLUDE_FLAG_C", R"VAR(-I)VAR");
+	print(false, "", "CMAKE_INCLUDE_FLAG_CXX", R"VAR(-I)VAR");
+	print(false, "", "CMAKE_INCLUDE_SYSTEM_FLAG_CXX", R"VAR(-isystem )VAR");
+	print(true, "PATH", "CMAKE_INSTALL_BINDIR", R"VAR(bin)VAR");
+	print(true, "PATH", "CMAKE_INSTALL_DATADIR", R"VAR()VAR");
+	print(true, "PATH", "CMAKE_INSTALL_DATAROOTDIR", R"VAR(share)VAR");
+	print(false, "", "CMAKE_INSTALL_DEFAULT_COMPONENT_NAME", R"VAR(Unspecified)VAR");
+	print(false, "PATH", "CMAKE_INSTALL_DIR", R"VAR(/usr/local/lib/cmake/carl)VAR");
+	print(true, "PATH", "CMAKE_INSTALL_DOCDIR", R"VAR()VAR");
+	print(true, "PATH", "CMAKE_INSTALL_INCLUDEDIR", R"VAR(include)VAR");
+	print(true, "PATH", "CMAKE_INSTALL_INFODIR", R"VAR()VAR");
+	print(true, "PATH", "CMAKE_INSTALL_LIBDIR", R"VAR(lib)VAR");
+	print(true, "PATH", "CMAKE_INSTALL_LIBEXECDIR", R"VAR(libexec)VAR");
+	print(true, "PATH", "CMAKE_INSTALL_LOCALEDIR", R"VAR()VAR");
+	print(true, "PATH", "CMAKE_INSTALL_LOCALSTATEDIR", R"VAR(var)VAR");
+	print(true, "PATH", "CMAKE_INSTALL_MANDIR", R"VAR()VAR");
+	print(true, "PATH", "CMAKE_INSTALL_OLDINCLUDEDIR", R"VAR(/usr/include)VAR");
+	print(false, "PATH", "CMAKE_INSTALL_PREFIX", R"VAR(/usr/local)VAR");
+	print(false, "", "CMAKE_INSTALL_RPATH", R"VAR(/usr/local/lib)VAR");
+	print(false, "", "CMAKE_INSTALL_RPATH_USE_LINK_PATH", R"VAR(TRUE)VAR");
+	print(true, "PATH", "CMAKE_INSTALL_RUNSTATEDIR", R"VAR()VAR");
+	print(true, "PATH", "CMAKE_INSTALL_SBINDIR", R"VAR(sbin)VAR");
+	print(true, "PATH", "CMAKE_INSTALL_SHAREDSTATEDIR", R"VAR(com)VAR");
+	print(false, "INTERNAL", "CMAKE_INSTALL_SO_NO_EXE", R"VAR(1)VAR");
+	print(true, "PATH", "CMAKE_INSTALL_SYSCONFDIR", R"VAR(etc)VAR");
+	print(false, "", "CMAKE_INTERNAL_PLATFORM_ABI", R"VAR(ELF)VAR");
+	print(false, "", "CMAKE_LIBRARY_ARCHITECTURE", R"VAR(x86_64-linux-gnu)VAR");
+	print(false, "", "CMAKE_LIBRARY_ARCHITECTURE_REGEX", R"VAR([a-z0-9_]+(-[a-z0-9_]+)?-linux-gnu[a-z0-9_]*)VAR");
+	print(false, "", "CMAKE_LIBRARY_PATH_FLAG", R"VAR(-L)VAR");
+	print(false, "", "CMAKE_LIBRARY_PATH_TERMINATOR", R"VAR()VAR");
+	print(true, "FILEPATH", "CMAKE_LINKER", R"VAR(/usr/bin/ld)VAR");
+	print(false, "", "CMAKE_LINK_GROUP_USING_RESCAN", R"VAR(LINKER:--start-group;LINKER:--end-group)VAR");
+	print(false, "", "CMAKE_LINK_GROUP_USING_RESCAN_SUPPORTED", R"VAR(TRUE)VAR");
+	print(false, "", "CMAKE_LINK_LIBRARY_FLAG", R"VAR(-l)VAR");
+	print(false, "", "CMAKE_LINK_LIBRARY_SUFFIX", R"VAR()VAR");
+	print(false, "", "CMAKE_LINK_LIBRARY_USING_DEFAULT_SUPPORTED", R"VAR(TRUE)VAR");
+	print(false, "", "CMAKE_LINK_LIBRARY_USING_WHOLE_ARCHIVE", R"VAR(LINKER:--push-state,--whole-archive;<LINK_ITEM>;LINKER:--pop-state)VAR");
+	print(false, "", "CMAKE_LINK_LIBRARY_USING_WHOLE_ARCHIVE_SUPPORTED", R"VAR(TRUE)VAR");
+	print(false, "", "CMAKE_LINK_WHAT_YOU_USE_CHECK", R"VAR(ldd;-u;-r)VAR");
+	print(false, "", "CMAKE_MAJOR_VERSION", R"VAR(3)VAR");
+	print(true, "FILEPATH", "CMAKE_MAKE_PROGRAM", R"VAR($(MAKE))VAR");
+	print(false, "", "CMAKE_MATCH_0", R"VAR()VAR");
+	print(false, "", "CMAKE_MATCH_1", R"VAR()VAR");
+	print(false, "", "CMAKE_MATCH_COUNT", R"VAR(0)VAR");
+	print(false, "", "CMAKE_MINIMUM_REQUIRED_VERSION", R"VAR(3.7)VAR");
+	print(false, "", "CMAKE_MINOR_VERSION", R"VAR(25)VAR");
+	print(true, "STRING", "CMAKE_MODULE_LINKER_FLAGS", R"VAR()VAR");
+	print(true, "STRING", "CMAKE_MODULE_LINKER_FLAGS_DEBUG", R"VAR()VAR");
+	print(false, "", "CMAKE_MODULE_LINKER_FLAGS_INIT", R"VAR( )VAR");
+	print(true, "STRING", "CMAKE_MODULE_LINKER_FLAGS_MINSIZEREL", R"VAR()VAR");
+	print(true, "STRING", "CMAKE_MODULE_LINKER_FLAGS_RELEASE", R"VAR()VAR");
+	print(true, "STRING", "CMAKE_MODULE_LINKER_FLAGS_RELWITHDEBINFO", R"VAR()VAR");
+	print(false, "", "CMAKE_MODULE_PATH", R"VAR(/root/repo/cmake)VAR");
+	print(false, "", "CMAKE_MT", R"VAR()VAR");
+	print(true, "FILEPATH", "CMAKE_NM", R"VAR(/usr/bin/nm)VAR");
+	print(false, "INTERNAL", "CMAKE_NUMBER_OF_MAKEFILES", R"VAR(32)VAR");
+	print(true, "FILEPATH", "CMAKE_OBJCOPY", R"VAR(/usr/bin/objcopy)VAR");
+	print(true, "FILEPATH", "CMAKE_OBJDUMP", R"VAR(/usr/bin/objdump)VAR");
+	print(false, "", "CMAKE_PARENT_LIST_FILE", R"VAR(/root/repo/src/carl-common/compile_info/CMakeLists.txt)VAR");
+	print(false, "", "CMAKE_PATCH_VERSION", R"VAR(1)VAR");
+	print(false, "", "CMAKE_PCH_EXTENSION", R"VAR(.gch)VAR");
+	print(false, "", "CMAKE_PCH_PROLOGUE", R"VAR(#pragma GCC system_header)VAR");
+	print(false, "", "CMAKE_PLATFORM_IMPLICIT_LINK_DIRECTORIES", R"VAR(/lib;/lib32;/lib64;/usr/lib;/usr/lib32;/usr/lib64)VAR");
+	print(false, "", "CMAKE_PLATFORM_INFO_DIR", R"VAR(/root/repo/_gate_build/CMakeFiles/3.25.1)VAR");
+	print(false, "INTERNAL", "CMAKE_PLATFORM_INFO_INITIALIZED", R"VAR(1)VAR");
+	print(false, "", "CMAKE_PLATFORM_USES_PATH_WHEN_NO_SONAME", R"VAR(1)VAR");
+	print(false, "", "CMAKE_POSITION_INDEPENDENT_CODE", R"VAR(ON)VAR");
+	print(false, "STATIC", "CMAKE_PROJECT_DESCRIPTION", R"VAR()VAR");
+	print(false, "STATIC", "CMAKE_PROJECT_HOMEPAGE_URL", R"VAR()VAR");
+	print(false, "STATIC", "CMAKE_PROJECT_NAME", R"VAR(carl)VAR");
+	print(true, "FILEPATH", "CMAKE_RANLIB", R"VAR(/usr/bin/ranlib)VAR");
+	print(true, "FILEPATH", "CMAKE_READELF", R"VAR(/usr/bin/readelf)VAR");
+	print(false, "INTERNAL", "CMAKE_ROOT", R"VAR(/usr/share/cmake-3.25)VAR");
+	print(false, "", "CMAKE_SHARED_LIBRARY_CREATE_CXX_FLAGS", R"VAR(-shared)VAR");
+	print(false, "", "CMAKE_SHARED_LIBRARY_CREATE_C_FLAGS", R"VAR(-shared)VAR");
+	print(false, "", "CMAKE_SHARED_LIBRARY_CXX_FLAGS", R"VAR(-fPIC)VAR");
+	print(false, "", "CMAKE_SHARED_LIBRARY_C_FLAGS", R"VAR()VAR");
+	print(false, "", "CMAKE_SHARED_LIBRARY_LINK_CXX_FLAGS", R"VAR(-rdynamic)VAR");
+	print(false, "", "CMAKE_SHARED_LIBRARY_LINK_C_FLAGS", R"VAR()VAR");
+	print(false, "", "CMAKE_SHARED_LIBRARY_LINK_DYNAMIC_CXX_FLAGS", R"VAR(-Wl,-Bdynamic)VAR");
+	print(false, "", "CMAKE_SHARED_LIBRARY_LINK_DYNAMIC_C_FLAGS", R"VAR(-Wl,-Bdynamic)VAR");
+	print(false, "", "CMAKE_SHARED_LIBRARY_LINK_STATIC_CXX_FLAGS", R"VAR(-Wl,-Bstatic)VAR");
+	print(false, "", "CMAKE_SHARED_LIBRARY_LINK_STATIC_C_FLAGS", R"VAR(-Wl,-Bstatic)VAR");
+	print(false, "", "CMAKE_SHARED_LIBRARY_PREFIX", R"VAR(lib)VAR");
+	print(false, "", "CMAKE_SHARED_LIBRARY_RPATH_LINK_CXX_FLAG", R"VAR(-Wl,-rpath-link,)VAR");
+	print(false, "", "CMAKE_SHARED_LIBRARY_RPATH_LINK_C_FLAG", R"VAR(-Wl,-rpath-link,)VAR");
+	print(false, "", "CMAKE_SHARED_LIBRARY_RPATH_ORIGIN_TOKEN", R"VAR($ORIGIN)VAR");
+	print(false, "", "CMAKE_SHARED_LIBRARY_RUNTIME_CXX_FLAG", R"VAR(-Wl,-rpath,)VAR");
+	print(false, "", "CMAKE_SHARED_LIBRARY_RUNTIME_CXX_FLAG_SEP", R"VAR(:)VAR");
+	print(false, "", "CMAKE_SHARED_LIBRARY_RUNTIME_C_FLAG", R"VAR(-Wl,-rpath,)VAR");
+	print(false, "", "CMAKE_SHARED_LIBRARY_RUNTIME_C_FLAG_SEP", R"VAR(:)VAR");
+	print(false, "", "CMAKE_SHARED_LIBRARY_SONAME_CXX_FLAG", R"VAR(-Wl,-soname,)VAR");
+	print(false, "", "CMAKE_SHARED_LIBRARY_SONAME_C_FLAG", R"VAR(-Wl,-soname,)VAR");
+	print(false, "", "CMAKE_SHARED_LIBRARY_SUFFIX", R"VAR(.so)VAR");
+	print(true, "STRING", "CMAKE_SHARED_LINKER_FLAGS", R"VAR()VAR");
+	print(true, "STRING", "CMAKE_SHARED_LINKER_FLAGS_DEBUG", R"VAR()VAR");
+	print(false, "", "CMAKE_SHARED_LINKER_FLAGS_INIT", R"VAR( )VAR");
+	print(true, "STRING", "CMAKE_SHARED_LINKER_FLAGS_MINSIZEREL", R"VAR()VAR");
+	print(true, "STRING", "CMAKE_SHARED_LINKER_FLAGS_RELEASE", R"VAR()VAR");
+	print(true, "STRING", "CMAKE_SHARED_LINKER_FLAGS_RELWITHDEBINFO", R"VAR()VAR");
+	print(false, "", "CMAKE_SHARED_MODULE_CREATE_CXX_FLAGS", R"VAR(-shared)VAR");
+	print(false, "", "CMAKE_SHARED_MODULE_CXX_FLAGS", R"VAR(-fPIC)VAR");
+	print(false, "", "CMAKE_SHARED_MODULE_LINK_DYNAMIC_CXX_FLAGS", R"VAR(-Wl,-Bdynamic)VAR");
+	print(false, "", "CMAKE_SHARED_MODULE_LINK_DYNAMIC_C_FLAGS", R"VAR(-Wl,-Bdynamic)VAR");
+	print(false, "", "CMAKE_SHARED_MODULE_LINK_STATIC_CXX_FLAGS", R"VAR(-Wl,-Bstatic)VAR");
+	print(false, "", "CMAKE_SHARED_MODULE_LINK_STATIC_C_FLAGS", R"VAR(-Wl,-Bstatic)VAR");
+	print(false, "", "CMAKE_SHARED_MODULE_PREFIX", R"VAR(lib)VAR");
+	print(false, "", "CMAKE_SHARED_MODULE_SUFFIX", R"VAR(.so)VAR");
+	print(false, "", "CMAKE_SIZEOF_VOID_P", R"VAR(8)VAR");
+	print(false, "", "CMAKE_SKIP_BUILD_RPATH", R"VAR(FALSE)VAR");
+	print(true, "BOOL", "CMAKE_SKIP_INSTALL_RPATH", R"VAR(NO)VAR");
+	print(true, "BOOL", "CMAKE_SKIP_RPATH", R"VAR(NO)VAR");
+	print(false, "", "CMAKE_SOURCE_DIR", R"VAR(/root/repo)VAR");
+	print(false, "", "CMAKE_STATIC_LIBRARY_PREFIX", R"VAR(lib)VAR");
+	print(false, "", "CMAKE_STATIC_LIBRARY_SUFFIX", R"VAR(.a)VAR");
+	print(true, "STRING", "CMAKE_STATIC_LINKER_FLAGS", R"VAR()VAR");
+	print(true, "STRING", "CMAKE_STATIC_LINKER_FLAGS_DEBUG", R"VAR()VAR");
+	print(true, "STRING", "CMAKE_STATIC_LINKER_FLAGS_MINSIZEREL", R"VAR()VAR");
+	print(true, "STRING", "CMAKE_STATIC_LINKER_FLAGS_RELEASE", R"VAR()VAR");
+	print(true, "STRING", "CMAKE_STATIC_LINKER_FLAGS_RELWITHDEBINFO", R"VAR()VAR");
+	print(true, "FILEPATH", "CMAKE_STRIP", R"VAR(/usr/bin/strip)VAR");
+	print(false, "", "CMAKE_SYSTEM", R"VAR(Linux-6.18.44-fc-v139)VAR");
+	print(false, "", "CMAKE_SYSTEM_INCLUDE_PATH", R"VAR(/usr/include/X11)VAR");
+	print(false, "", "CMAKE_SYSTEM_INFO_FILE", R"VAR(Platform/Linux)VAR");
+	print(false, "", "CMAKE_SYSTEM_LIBRARY_PATH", R"VAR(/usr/lib/X11)VAR");
+	print(false, "", "CMAKE_SYSTEM_LOADED", R"VAR(1)VAR");
+	print(false, "", "CMAKE_SYSTEM_NAME", R"VAR(Linux)VAR");
+	print(false, "", "CMAKE_SYSTEM_PREFIX_PATH", R"VAR(/usr/local;/usr;/;/usr;/usr/local;/usr/X11R6;/usr/pkg;/opt)VAR");
+	print(false, "", "CMAKE_SYSTEM_PROCESSOR", R"VAR(x86_64)VAR");
+	print(false, "", "CMAKE_SYSTEM_SPECIFIC_INFORMATION_LOADED", R"VAR(1)VAR");
+	print(false, "", "CMAKE_SYSTEM_SPECIFIC_INITIALIZE_LOADED", R"VAR(1)VAR");
+	print(false, "", "CMAKE_SYSTEM_VERSION", R"VAR(6.18.44-fc-v139)VAR");
+	print(false, "", "CMAKE_TESTING_ENABLED", R"VAR(1)VAR");
+	print(false, "", "CMAKE_THREAD_LIBS_INIT", R"VAR()VAR");
+	print(false, "", "CMAKE_TWEAK_VERSION", R"VAR(0)VAR");
+	print(false, "INTERNAL", "CMAKE_UNAME", R"VAR(/usr/bin/uname)VAR");
+	print(false, "", "CMAKE_USE_PTHREADS_INIT", R"VAR(1)VAR");
+	print(true, "BOOL", "CMAKE_VERBOSE_MAKEFILE", R"VAR(FALSE)VAR");
+	print(false, "", "CMAKE_VERSION", R"VAR(3.25.1)VAR");
+	print(false, "BOOL", "COVERAGE", R"VAR(OFF)VAR");
+	print(false, "", "CPATH", R"VAR()VAR");
+	print(false, "", "DEF_INSTALL_CMAKE_DIR", R"VAR(lib/cmake/carl)VAR");
+	print(false, "BOOL", "DEVELOPER", R"VAR(OFF)VAR");
+	print(false, "", "DOT", R"VAR(DOXYGEN_DOT_EXECUTABLE-NOTFOUND)VAR");
+	print(false, "", "DOXYGEN", R"VAR(DOXYGEN_EXECUTABLE-NOTFOUND)VAR");
+	print(true, "FILEPATH", "DOXYGEN_DOT_EXECUTABLE", R"VAR(DOXYGEN_DOT_EXECUTABLE-NOTFOUND)VAR");
+	print(false, "", "DOXYGEN_DOT_FOUND", R"VAR(NO)VAR");
+	print(true, "FILEPATH", "DOXYGEN_EXECUTABLE", R"VAR(DOXYGEN_EXECUTABLE-NOTFOUND)VAR");
+	print(false, "", "DOXYGEN_FIND_QUIETLY", R"VAR(TRUE)VAR");
+	print(false, "", "DOXYGEN_FOUND", R"VAR(NO)VAR");
+	print(false, "", "DYNAMIC_EXT", R"VAR(.so)VAR");
+	print(false, "", "Doxygen_FOUND", R"VAR(FALSE)VAR");
+	print(false, "", "Doxygen_dot_FOUND", R"VAR(FALSE)VAR");
+	print(false, "", "Doxygen_doxygen_FOUND", R"VAR(FALSE)VAR");
+	print(false, "", "EIGEN3_FOUND", R"VAR(TRUE)VAR");
+	print(true, "PATH", "EIGEN3_INCLUDE_DIR", R"VAR(/usr/include/eigen3)VAR");
+	print(false, "", "EIGEN3_MAJOR_VERSION", R"VAR(4)VAR");
+	print(false, "", "EIGEN3_MINOR_VERSION", R"VAR(0)VAR");
+	print(false, "", "EIGEN3_VERSION", R"VAR(3.4.0)VAR");
+	print(false, "", "EIGEN3_VERSION_OK", R"VAR(TRUE)VAR");
+	print(false, "", "EIGEN3_WORLD_VERSION", R"VAR(3)VAR");
+	print(false, "BOOL", "ENABLE_PACKAGING", R"VAR(OFF)VAR");
+	print(false, "PATH", "EXECUTABLE_OUTPUT_PATH", R"VAR(/root/repo/_gate_build/bin)VAR");
+	print(false, "", "EXPORTED_OPTIONS", R"VAR(LOGGING;CARL_DEVOPTION_Statistics;FORCE_SHIPPED_RESOURCES;FORCE_SHIPPED_GMP;USE_LIBPOLY;USE_GINAC;USE_CLN_NUMBERS;USE_COCOA;USE_BLISS;USE_MPFR_FLOAT;THREAD_SAFE;INTERVAL_FPU_ROUNDING)VAR");
+	print(false, "BOOL", "EXPORT_TO_CMAKE", R"VAR(ON)VAR");
+	print(false, "BOOL", "FORCE_SHIPPED_GMP", R"VAR(OFF)VAR");
+	print(false, "BOOL", "FORCE_SHIPPED_RESOURCES", R"VAR(OFF)VAR");
+	print(true, "UNINITIALIZED", "GBCORE_STATIC", R"VAR()VAR");
+	print(true, "UNINITIALIZED", "GBENCHMARK_FOUND", R"VAR(TRUE)VAR");
+	print(false, "", "GBENCHMARK_VERSION", R"VAR(1.7.1)VAR");
+	print(true, "UNINITIALIZED", "GBMAIN_STATIC", R"VAR()VAR");
+	print(true, "FILEPATH", "GIT_EXECUTABLE", R"VAR(/usr/bin/git)VAR");
+	print(true, "UNINITIALIZED", "GMPXX_FOUND", R"VAR(TRUE)VAR");
+	print(true, "PATH", "GMPXX_INCLUDE_DIR", R"VAR(/usr/include)VAR");
+	print(true, "UNINITIALIZED", "GMP_FOUND", R"VAR(TRUE)VAR");
+	print(true, "PATH", "GMP_INCLUDE_DIR", R"VAR(/usr/include/x86_64-linux-gnu)VAR");
+	print(true, "FILEPATH", "GMP_LIBRARY", R"VAR(/usr/lib/x86_64-linux-gnu/libgmp.so)VAR");
+	print(false, "", "GMP_LIB_PATH", R"VAR(/usr/lib/x86_64-linux-gnu)VAR");
+	print(true, "UNINITIALIZED", "GMP_VERSION", R"VAR(6.2.1)VAR");
+	print(false, "", "GTEST_FOUND", R"VAR(TRUE)VAR");
+	print(true, "PATH", "GTEST_INCLUDE_DIR", R"VAR(/usr/include)VAR");
+	print(true, "FILEPATH", "GTEST_LIB", R"VAR(/usr/lib/x86_64-linux-gnu/libgtest.a)VAR");
+	print(true, "FILEPATH", "GTEST_MAIN_LIBRARIES", R"VAR(/usr/lib/x86_64-linux-gnu/libgtest_main.a)VAR");
+	print(false, "", "GTEST_VERSION", R"VAR(1.12.1)VAR");
+	print(false, "", "GTEST_ZIPHASH", R"VAR(973e464e8936d4b79bb24f27b058aaef4150b06e)VAR");
+	print(false, "", "GTest_FOUND_SYSTEM", R"VAR(TRUE)VAR");
+	print(false, "PATH", "INCLUDE_INSTALL_DIR", R"VAR(/usr/local/include)VAR");
+	print(false, "BOOL", "INTERVAL_FPU_ROUNDING", R"VAR(OFF)VAR");
+	print(false, "", "LIBNAME", R"VAR(EIGEN3)VAR");
+	print(false, "", "LIBRARY_PATH", R"VAR()VAR");
+	print(false, "", "LIB_FILESYSTEM", R"VAR(stdc++fs)VAR");
+	print(false, "PATH", "LIB_INSTALL_DIR", R"VAR(/usr/local/lib)VAR");
+	print(false, "", "LINUX", R"VAR(1)VAR");
+	print(false, "BOOL", "LOGGING", R"VAR(OFF)VAR");
+	print(false, "BOOL", "LOGGING_DISABLE_INEFFICIENT", R"VAR(OFF)VAR");
+	print(false, "", "PROJECT_BINARY_DIR", R"VAR(/root/repo/_gate_build)VAR");
+	print(false, "", "PROJECT_DESCRIPTION", R"VAR(Computer ARithmetic Library)VAR");
+	print(false, "", "PROJECT_FULLNAME", R"VAR(carl)VAR");
+	print(false, "", "PROJECT_HOMEPAGE_URL", R"VAR()VAR");
+	print(false, "", "PROJECT_IS_TOP_LEVEL", R"VAR(ON)VAR");
+	print(false, "", "PROJECT_NAME", R"VAR(carl)VAR");
+	print(false, "", "PROJECT_SOURCE_DIR", R"VAR(/root/repo)VAR");
+	print(false, "", "PROJECT_VERSION", R"VAR(25.04)VAR");
+	print(false, "", "PROJECT_VERSION_FULL", R"VAR(25.04)VAR");
+	print(false, "", "PROJECT_VERSION_LIB", R"VAR(25.04)VAR");
+	print(false, "", "PROJECT_VERSION_MAJOR", R"VAR(25)VAR");
+	print(false, "", "PROJECT_VERSION_MINOR", R"VAR(04)VAR");
+	print(false, "", "PTHREAD_C_CXX_TEST_SOURCE", R"VAR(#include <pthread.h>
+
+static void* test_func(void* data)
+{
+  return data;
+}
+
+int main(void)
+{
+  pthread_t thread;
+  pthread_create(&thread, NULL, test_func, NULL);
+  pthread_detach(thread);
+  pthread_cancel(thread);
+  pthread_join(thread, NULL);
+  pthread_atfork(NULL, NULL, NULL);
+  pthread_exit(NULL);
+
+  return 0;
+}
+)VAR");
+	print(false, "", "RUN_CONFIGURE", R"VAR(ON)VAR");
+	print(false, "", "STATIC_EXT", R"VAR(.a)VAR");
+	print(false, "", "THREADS_FOUND", R"VAR(TRUE)VAR");
+	print(false, "BOOL", "THREAD_SAFE", R"VAR(OFF)VAR");
+	print(false, "STATIC", "TestCommon_LIB_DEPENDS", R"VAR(general;carl-arith-shared;general;GTESTCORE_STATIC;general;GTESTMAIN_STATIC;general;pthread;general;dl;)VAR");
+	print(false, "", "Threads_FOUND", R"VAR(TRUE)VAR");
+	print(false, "", "UNIX", R"VAR(1)VAR");
+	print(false, "BOOL", "USE_BLISS", R"VAR(OFF)VAR");
+	print(false, "BOOL", "USE_CLN_NUMBERS", R"VAR(OFF)VAR");
+	print(false, "BOOL", "USE_COCOA", R"VAR(OFF)VAR");
+	print(false, "BOOL", "USE_GINAC", R"VAR(OFF)VAR");
+	print(false, "BOOL", "USE_LIBPOLY", R"VAR(OFF)VAR");
+	print(false, "BOOL", "USE_MPFR_FLOAT", R"VAR(OFF)VAR");
+	print(false, "STATIC", "carl-arith-shared_LIB_DEPENDS", R"VAR(general;carl-common-shared;general;carl-logging-shared;general;GMPXX_SHARED;general;GMP_SHARED;general;Boost_system_SHARED;general;dl;general;stdc++fs;general;pthread;)VAR");
+	print(false, "STATIC", "carl-arith-static_LIB_DEPENDS", R"VAR(general;carl-common-static;general;carl-logging-static;general;GMPXX_STATIC;general;GMP_STATIC;general;Boost_system_STATIC;general;dl;general;stdc++fs;general;pthread;)VAR");
+	print(false, "STATIC", "carl-common-shared_LIB_DEPENDS", R"VAR(general;Boost_system_SHARED;general;dl;general;stdc++fs;general;pthread;)VAR");
+	print(false, "STATIC", "carl-common-static_LIB_DEPENDS", R"VAR(general;Boost_system_STATIC;general;dl;general;stdc++fs;general;pthread;)VAR");
+	print(false, "STATIC", "carl-covering-shared_LIB_DEPENDS", R"VAR(general;carl-arith-shared;)VAR");
+	print(false, "STATIC", "carl-covering-static_LIB_DEPENDS", R"VAR(general;carl-arith-static;)VAR");
+	print(false, "STATIC", "carl-extpolys-shared_LIB_DEPENDS", R"VAR(general;carl-arith-shared;)VAR");
+	print(false, "STATIC", "carl-extpolys-static_LIB_DEPENDS", R"VAR(general;carl-arith-static;)VAR");
+	print(false, "STATIC", "carl-formula-shared_LIB_DEPENDS", R"VAR(general;carl-arith-shared;)VAR");
+	print(false, "STATIC", "carl-formula-static_LIB_DEPENDS", R"VAR(general;carl-arith-static;)VAR");
+	print(false, "STATIC", "carl-io-shared_LIB_DEPENDS", R"VAR(general;carl-arith-shared;general;carl-formula-shared;)VAR");
+	print(false, "STATIC", "carl-io-static_LIB_DEPENDS", R"VAR(general;carl-arith-static;general;carl-formula-static;)VAR");
+	print(false, "STATIC", "carl-logging-shared_LIB_DEPENDS", R"VAR(general;carl-common-shared;)VAR");
+	print(false, "STATIC", "carl-logging-static_LIB_DEPENDS", R"VAR(general;carl-common-static;)VAR");
+	print(false, "STATIC", "carl-settings-shared_LIB_DEPENDS", R"VAR(general;Boost_program_options_SHARED;general;stdc++fs;)VAR");
+	print(false, "STATIC", "carl-settings-static_LIB_DEPENDS", R"VAR(general;Boost_program_options_STATIC;general;stdc++fs;)VAR");
+	print(false, "STATIC", "carl-statistics-shared_LIB_DEPENDS", R"VAR(general;carl-common-shared;)VAR");
+	print(false, "STATIC", "carl-statistics-static_LIB_DEPENDS", R"VAR(general;carl-common-static;)VAR");
+	print(false, "STATIC", "carl_BINARY_DIR", R"VAR(/root/repo/_gate_build)VAR");
+	print(false, "", "carl_DESCRIPTION", R"VAR()VAR");
+	print(false, "", "carl_HOMEPAGE_URL", R"VAR()VAR");
+	print(false, "STATIC", "carl_IS_TOP_LEVEL", R"VAR(ON)VAR");
+	print(false, "", "carl_LIBRARIES_DYNAMIC", R"VAR(pthread;dl)VAR");
+	print(false, "STATIC", "carl_SOURCE_DIR", R"VAR(/root/repo)VAR");
+	print(false, "", "component", R"VAR()VAR");
+	print(false, "", "install_dir", R"VAR(/root/repo/_gate_build/resources)VAR");
+	print(false, "", "lang", R"VAR()VAR");
+	print(false, "", "p", R"VAR()VAR");
+	print(false, "", "type", R"VAR()VAR");
+	print(false, "", "var", R"VAR(CMAKE_INSTALL_DIR)VAR");
+
+	return os;
+}
+
+}
@@ -0,0 +1,16 @@
+/**
+ * Auto generated file config.h from config.h.in.
+ */ 
+#pragma once
+
+#define CARL_BUILD_RELEASE
+/* #undef THREAD_SAFE */
+/* #undef INTERVAL_FPU_ROUNDING */
+
+/* #undef USE_BLISS */
+/* #undef USE_COCOA */
+/* #undef USE_GINAC */
+/* #undef USE_LIBPOLY */
+
+/* #undef USE_CLN_NUMBERS */
+/* #undef USE_MPFR_FLOAT */
@@ -0,0 +1,174 @@
+/**
+ * @file LRUCache.h
+ *
+ * A bounded cache with least-recently-used eviction.
+ */
+
+#pragma once
+
+#include <carl-common/config.h>
+
+#include <cassert>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
+#ifdef THREAD_SAFE
+#define LRUCACHE_LOCK_GUARD std::lock_guard<std::mutex> lock(mMutex);
+#else
+#define LRUCACHE_LOCK_GUARD
+#endif
+
+namespace carl {
+
+/**
+ * A cache that maps keys to values and evicts the least recently used entries once the accumulated size exceeds the capacity.
+ *
+ * Every entry is stored together with a size given by the user, e.g. the number of coefficients of a polynomial.
+ * Entries are looked up by hash and compared by equality, hence the keys themselves (and not only their hashes) are stored.
+ * Values are returned by copy, such that evicting an entry never invalidates a result. Expensive values should be stored as `std::shared_ptr<const T>`.
+ *
+ * If THREAD_SAFE is set, all operations are protected by a mutex.
+ */
+template<typename Key, typename Value, typename Hash = std::hash<Key>, typename Equal = std::equal_to<Key>>
+class LRUCache {
+private:
+	struct Entry {
+		Key key;
+		Value value;
+		std::size_t size;
+	};
+	using List = std::list<Entry>;
+
+	/// Entries ordered by their last access, most recent first.
+	List mEntries;
+	/// Maps keys (stored in mEntries) to their entries.
+	std::unordered_map<std::reference_wrapper<const Key>, typename List::iterator, Hash, Equal> mIndex;
+	std::size_t mCapacity;
+	std::size_t mSize = 0;
+	std::size_t mHits = 0;
+	std::size_t mMisses = 0;
+	std::size_t mEvictions = 0;
+	mutable std::mutex mMutex;
+
+	void evict() {
+		while (mSize > mCapacity && !mEntries.empty()) {
+			const Entry& e = mEntries.back();
+			mSize -= e.size;
+			mIndex.erase(std::cref(e.key));
+			mEntries.pop_back();
+			++mEvictions;
+		}
+	}
+
+public:
+	/**
+	 * Creates an empty cache.
+	 * @param capacity Maximum accumulated size of all entries.
+	 */
+	explicit LRUCache(std::size_t capacity): mCapacity(capacity) {}
+	LRUCache(const LRUCache&) = delete;
+	LRUCache& operator=(const LRUCache&) = delete;
+
+	/**
+	 * Looks up the value for the given key and marks it as recently used.
+	 * @return The value, or std::nullopt if key is not cached.
+	 */
+	std::optional<Value> get(const Key& key) {
+		LRUCACHE_LOCK_GUARD
+		auto it = mIndex.find(std::cref(key));
+		if (it == mIndex.end()) {
+			++mMisses;
+			return std::nullopt;
+		}
+		++mHits;
+		mEntries.splice(mEntries.begin(), mEntries, it->second);
+		return it->second->value;
+	}
+
+	/**
+	 * Stores a value for the given key, replacing a previous value.
+	 * Evicts the least recently used entries if necessary.
+	 * Entries that are larger than the capacity are not stored at all.
+	 * @param key Key.
+	 * @param value Value.
+	 * @param size Size of this entry.
+	 */
+	void put(const Key& key, Value value, std::size_t size = 1) {
+		LRUCACHE_LOCK_GUARD
+		if (size > mCapacity) return;
+		auto it = mIndex.find(std::cref(key));
+		if (it != mIndex.end()) {
+			mSize -= it->second->size;
+			it->second->value = std::move(value);
+			it->second->size = size;
+			mEntries.splice(mEntries.begin(), mEntries, it->second);
+		} else {
+			mEntries.push_front(Entry{ key, std::move(value), size });
+			mIndex.emplace(std::cref(mEntries.front().key), mEntries.begin());
+		}
+		mSize += size;
+		evict();
+	}
+
+	/**
+	 * Returns the cached value for key or computes, stores and returns it.
+	 * The computation is done without holding the lock, hence the value may be computed multiple times concurrently.
+	 * @param key Key.
+	 * @param compute Computes the value.
+	 * @param size Computes the size of the value.
+	 */
+	template<typename Compute, typename Size>
+	Value get_or_compute(const Key& key, Compute&& compute, Size&& size) {
+		if (auto res = get(key)) return *res;
+		Value res = compute();
+		put(key, res, size(res));
+		return res;
+	}
+
+	/// Removes all entries, the counters are kept.
+	void clear() {
+		LRUCACHE_LOCK_GUARD
+		mIndex.clear();
+		mEntries.clear();
+		mSize = 0;
+	}
+
+	/// Changes the capacity, evicting entries if necessary.
+	void set_capacity(std::size_t capacity) {
+		LRUCACHE_LOCK_GUARD
+		mCapacity = capacity;
+		evict();
+	}
+
+	/// Returns the capacity.
+	std::size_t capacity() const {
+		return mCapacity;
+	}
+	/// Returns the accumulated size of all entries.
+	std::size_t size() const {
+		LRUCACHE_LOCK_GUARD
+		return mSize;
+	}
+	/// Returns the number of entries.
+	std::size_t entries() const {
+		LRUCACHE_LOCK_GUARD
+		return mEntries.size();
+	}
+	/// Returns the number of successful lookups.
+	std::size_t hits() const {
+		return mHits;
+	}
+	/// Returns the number of failed lookups.
+	std::size_t misses() const {
+		return mMisses;
+	}
+	/// Returns the number of evicted entries.
+	std::size_t evictions() const {
+		return mEvictions;
+	}
+};
+
+}
@@ -0,0 +1,191 @@
+/**
+ * @file ThreadPool.h
+ *
+ * A simple work-stealing thread pool.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace carl {
+
+/**
+ * A thread pool where every worker owns a queue of tasks.
+ *
+ * Tasks submitted from within a worker are put into the queue of this worker, other tasks are distributed in a round-robin fashion.
+ * A worker processes its own queue in LIFO order and, if it is empty, steals the oldest task from the queues of the other workers.
+ * This keeps recursively spawned tasks local while still balancing the load.
+ *
+ * If a task throws, the exception is caught by the worker and the first one is rethrown by wait().
+ *
+ * All tasks must have finished when the pool is destroyed, i.e. wait() should be called before.
+ */
+class ThreadPool {
+public:
+	using Task = std::function<void()>;
+private:
+	struct Queue {
+		std::mutex mutex;
+		std::deque<Task> tasks;
+	};
+
+	/// One queue per worker.
+	std::vector<std::unique_ptr<Queue>> mQueues;
+	/// The workers.
+	std::vector<std::thread> mThreads;
+	/// Protects waiting for new tasks and for completion.
+	std::mutex mMutex;
+	std::condition_variable mWakeup;
+	std::condition_variable mDone;
+	/// Number of tasks that are queued but not yet taken by a worker.
+	std::atomic<std::size_t> mQueued = 0;
+	/// Number of tasks that have been submitted but not yet finished.
+	std::atomic<std::size_t> mPending = 0;
+	/// Target queue for the next task submitted from outside the pool.
+	std::atomic<std::size_t> mNext = 0;
+	bool mStop = false;
+	/// The first exception thrown by a task since the last wait(), protected by mMutex.
+	std::exception_ptr mException;
+
+	/// The pool the current thread works for.
+	static inline thread_local const ThreadPool* tlsPool = nullptr;
+	/// The index of the worker of the current thread.
+	static inline thread_local std::size_t tlsWorker = 0;
+
+	bool pop(std::size_t worker, Task& task) {
+		auto& q = *mQueues[worker];
+		std::lock_guard<std::mutex> lock(q.mutex);
+		if (q.tasks.empty()) return false;
+		task = std::move(q.tasks.back());
+		q.tasks.pop_back();
+		--mQueued;
+		return true;
+	}
+
+	bool steal(std::size_t worker, Task& task) {
+		for (std::size_t i = 1; i < mQueues.size(); ++i) {
+			auto& q = *mQueues[(worker + i) % mQueues.size()];
+			std::lock_guard<std::mutex> lock(q.mutex);
+			if (q.tasks.empty()) continue;
+			task = std::move(q.tasks.front());
+			q.tasks.pop_front();
+			--mQueued;
+			return true;
+		}
+		return false;
+	}
+
+	void run(std::size_t worker) {
+		tlsPool = this;
+		tlsWorker = worker;
+		Task task;
+		while (true) {
+			if (pop(worker, task) || steal(worker, task)) {
+				try {
+					task();
+				} catch (...) {
+					std::lock_guard<std::mutex> lock(mMutex);
+					if (!mException) mException = std::current_exception();
+				}
+				task = nullptr;
+				if (--mPending == 0) {
+					std::lock_guard<std::mutex> lock(mMutex);
+					mDone.notify_all();
+				}
+				continue;
+			}
+			std::unique_lock<std::mutex> lock(mMutex);
+			mWakeup.wait(lock, [this](){ return mStop || mQueued > 0; });
+			if (mStop && mQueued == 0) return;
+		}
+	}
+
+public:
+	/**
+	 * Starts the given number of workers.
+	 * @param threads Number of workers, zero means std::thread::hardware_concurrency().
+	 */
+	explicit ThreadPool(std::size_t threads = 0) {
+		if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+		for (std::size_t i = 0; i < threads; ++i) {
+			mQueues.emplace_back(std::make_unique<Queue>());
+		}
+		for (std::size_t i = 0; i < threads; ++i) {
+			mThreads.emplace_back([this, i](){ run(i); });
+		}
+	}
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	~ThreadPool() {
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			mStop = true;
+		}
+		mWakeup.notify_all();
+		for (auto& t: mThreads) t.join();
+	}
+
+	/// Returns the number of workers.
+	std::size_t size() const {
+		return mThreads.size();
+	}
+
+	/// Adds a task. May be called from within a task.
+	void submit(Task task) {
+		std::size_t worker = (tlsPool == this) ? tlsWorker : (mNext++ % mQueues.size());
+		++mPending;
+		{
+			// Count the task before it becomes visible, so that mQueued never underflows.
+			std::lock_guard<std::mutex> lock(mMutex);
+			++mQueued;
+		}
+		{
+			auto& q = *mQueues[worker];
+			std::lock_guard<std::mutex> lock(q.mutex);
+			q.tasks.emplace_back(std::move(task));
+		}
+		mWakeup.notify_one();
+	}
+
+	/**
+	 * Blocks until all submitted tasks (including the ones submitted by tasks) have finished. Must not be called from within a task.
+	 * Rethrows the first exception thrown by one of these tasks.
+	 */
+	void wait() {
+		std::unique_lock<std::mutex> lock(mMutex);
+		mDone.wait(lock, [this](){ return mPending == 0; });
+		if (mException) {
+			std::exception_ptr e;
+			std::swap(e, mException);
+			std::rethrow_exception(e);
+		}
+	}
+
+	/**
+	 * Returns a pool with the given number of workers that belongs to the calling thread and is reused by all calls from this thread.
+	 * Avoids starting new threads for every parallel computation. As every thread has its own pool,
+	 * wait() only waits for the tasks of the caller, and the pool can also be used from within tasks of another pool.
+	 * @param threads Number of workers, zero means std::thread::hardware_concurrency().
+	 */
+	static ThreadPool& local(std::size_t threads) {
+		if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+		static thread_local std::unique_ptr<ThreadPool> pool;
+		if (!pool || pool->size() != threads) {
+			pool = std::make_unique<ThreadPool>(threads);
+		}
+		return *pool;
+	}
+};
+
+}
@@ -2,6 +2,7 @@
 
 #include <carl-logging/carl-logging.h>
 
+#include <atomic>
 #include <iostream>
 #include <variant>
 
@@ -160,8 +161,13 @@ namespace carl {
             size_t mId = 0;
             /// The activity for this formula, which means, how much is this formula involved in the solving procedure.
             mutable double mActivity = 0.0;
-            /// The number of formulas existing with this content.
-            mutable size_t mUsages = 0;
+            #ifdef THREAD_SAFE
+            using UsageCount = std::atomic<std::size_t>;
+            #else
+            using UsageCount = std::size_t;
+            #endif
+            /// The number of formulas existing with this content, see FormulaPool::reg().
+            mutable UsageCount mUsages = 0;
             /// The type of this formula.
             FormulaType mType;
             /// The content of this formula.
@@ -98,7 +98,7 @@ namespace carl
             {
                 std::cout << "Formula pool contains:" << std::endl;
                 for (const auto& ele: mPool) {
-                    std::cout << ele->mId << " @ " << static_cast<const void*>(ele) << " [usages=" << ele->mUsages << "]: " << *ele << ", negation " << static_cast<const void*>(ele->mNegation) << std::endl;
+                    std::cout << ele->mId << " @ " << static_cast<const void*>(ele) << " [usages=" << usages_of(ele) << "]: " << *ele << ", negation " << static_cast<const void*>(ele->mNegation) << std::endl;
                 }
                 std::cout << "Tseitin variables:" << std::endl;
                 for( const auto& tvVar : mTseitinVars )
@@ -470,15 +470,28 @@ namespace carl
                 }
 			}
 
+            /**
+             * Releases a usage of the given formula, see reg().
+             * Only dropping the last usage besides the one of the pool takes the pool lock, which then removes the formula from the pool.
+             */
             void free( const FormulaContent<Pol>* _elem )
             {
-                FORMULA_POOL_LOCK_GUARD
                 const FormulaContent<Pol>* tmp = getBaseFormula(_elem);
 				assert(tmp == getBaseFormula(tmp));
 				assert(isBaseFormula(tmp));
+                #ifdef THREAD_SAFE
+                std::size_t usages = tmp->mUsages.load(std::memory_order_relaxed);
+                while (usages > 2) {
+                    if (tmp->mUsages.compare_exchange_weak(usages, usages - 1, std::memory_order_release, std::memory_order_relaxed)) {
+                        CARL_LOG_TRACE("carl.formula", "Usage of " << static_cast<const void*>(tmp) << " / " << static_cast<const void*>(tmp->mNegation) << " (coming from " << static_cast<const void*>(_elem) << "): " << (usages - 1));
+                        return;
+                    }
+                }
+                #endif
+                FORMULA_POOL_LOCK_GUARD
                 assert( tmp->mUsages > 0 );
                 --tmp->mUsages;
-				CARL_LOG_TRACE("carl.formula", "Usage of " << static_cast<const void*>(tmp) << " / " << static_cast<const void*>(tmp->mNegation) << " (coming from " << static_cast<const void*>(_elem) << "): " << tmp->mUsages);
+				CARL_LOG_TRACE("carl.formula", "Usage of " << static_cast<const void*>(tmp) << " / " << static_cast<const void*>(tmp->mNegation) << " (coming from " << static_cast<const void*>(_elem) << "): " << usages_of(tmp));
                 if( tmp->mUsages == 1 )
                 {
 					CARL_LOG_DEBUG("carl.formula", "Actually freeing " << *tmp << " from pool");
@@ -552,19 +565,50 @@ namespace carl
                 return stillStoredAsTseitinVariable;
             }
 
+            /**
+             * Registers a usage of the given formula.
+             * The usages are counted on the base formula only, see getBaseFormula(). Besides the usages of the formula objects,
+             * the pool holds one usage: for constraint-like formulas it is added on the first registration,
+             * for all other formulas the negation holds the formula as its sub-formula.
+             * Hence a formula with less than two usages is only referenced by the pool.
+             *
+             * If THREAD_SAFE is set, usages of formulas that are already in use are counted lock-free,
+             * such that copying formulas does not contend on the pool lock.
+             * Leaving and entering the state where only the pool references a formula is done while holding the pool lock,
+             * which synchronizes it with the removal from the pool in free().
+             */
             void reg( const FormulaContent<Pol>* _elem ) const
             {
-                FORMULA_POOL_LOCK_GUARD
                 const FormulaContent<Pol>* tmp = getBaseFormula(_elem);
                 //const FormulaContent<Pol>* tmp = _elem->mType == FormulaType::NOT ? _elem->mNegation : _elem;
                 assert( tmp != nullptr );
+                #ifdef THREAD_SAFE
+                std::size_t usages = tmp->mUsages.load(std::memory_order_relaxed);
+                while (usages >= 2) {
+                    assert( usages < std::numeric_limits<size_t>::max() );
+                    if (tmp->mUsages.compare_exchange_weak(usages, usages + 1, std::memory_order_relaxed)) {
+                        CARL_LOG_TRACE("carl.formula", "Increased usage of " << static_cast<const void*>(tmp) << " / " << static_cast<const void*>(tmp->mNegation) << "(based on " << static_cast<const void*>(_elem) << ")" << " to " << (usages + 1));
+                        return;
+                    }
+                }
+                #endif
+                FORMULA_POOL_LOCK_GUARD
                 assert( tmp->mUsages < std::numeric_limits<size_t>::max() );
                 ++tmp->mUsages;
                 if (tmp->mUsages == 1 && (tmp->mType == FormulaType::CONSTRAINT || tmp->mType == FormulaType::UEQ || tmp->mType == FormulaType::VARCOMPARE || tmp->mType == FormulaType::VARASSIGN)) {
                     CARL_LOG_TRACE("carl.formula", "Is a constraint, increasing again");
                     ++tmp->mUsages;
                 }
-				CARL_LOG_TRACE("carl.formula", "Increased usage of " << static_cast<const void*>(tmp) << " / " << static_cast<const void*>(tmp->mNegation) << "(based on " << static_cast<const void*>(_elem) << ")" << " to " << tmp->mUsages);
+				CARL_LOG_TRACE("carl.formula", "Increased usage of " << static_cast<const void*>(tmp) << " / " << static_cast<const void*>(tmp->mNegation) << "(based on " << static_cast<const void*>(_elem) << ")" << " to " << usages_of(tmp));
+            }
+
+            static std::size_t usages_of( const FormulaContent<Pol>* _elem )
+            {
+                #ifdef THREAD_SAFE
+                return _elem->mUsages.load(std::memory_order_relaxed);
+                #else
+                return _elem->mUsages;
+                #endif
             }
 
         public:
@@ -5,6 +5,8 @@
 #include "Negations.h"
 #include "aux.h"
 
+#include <unordered_set>
+
 namespace carl {
 namespace formula_to_cnf {
 
@@ -44,10 +46,16 @@ Formula<Poly> to_cnf_or(const Formula<Poly>& f, bool keep_constraints, bool simp
 	Formulas<Poly> subformulas;
 	// Queue of subformulas to process
 	std::vector<Formula<Poly>> subformula_queue = { f };
+	// Formulas from the queue that have been processed already, kept alive such that recreating them yields the same formula
+	std::unordered_set<Formula<Poly>> processed;
 	while (!subformula_queue.empty()) {
 		auto current = subformula_queue.back();
 		CARL_LOG_DEBUG("carl.formula.cnf", "Processing " << current << " from " << subformula_queue);
 		subformula_queue.pop_back();
+		if (!processed.insert(current).second) {
+			// Shared subformulas contribute the same subformulas (and tseitin constraints) every time
+			continue;
+		}
 
 		switch (current.type()) {
 			case FormulaType::TRUE:
@@ -183,10 +191,16 @@ Formula<Poly> to_cnf(const Formula<Poly>& f, bool keep_constraints = true, bool
 	Formulas<Poly> subformulas;
 	// Queue of subformulas to process
 	std::vector<Formula<Poly>> subformula_queue = { f };
+	// Formulas from the queue that have been processed already, kept alive such that recreating them yields the same formula
+	std::unordered_set<Formula<Poly>> processed;
 	while (!subformula_queue.empty()) {
 		auto current = subformula_queue.back();
 		CARL_LOG_DEBUG("carl.formula.cnf", "Processing " << current << " from " << subformula_queue);
 		subformula_queue.pop_back();
+		if (!processed.insert(current).second) {
+			// Shared subformulas contribute the same subformulas (and tseitin constraints) every time
+			continue;
+		}
 
 		switch (current.type()) {
 			case FormulaType::TRUE:
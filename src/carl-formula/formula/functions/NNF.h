@@ -3,10 +3,53 @@
 #include "Negations.h"
 #include "aux.h"
 
+#include <unordered_map>
+#include <vector>
+
 namespace carl {
+namespace formula_to_nnf {
 
+/**
+ * Returns the formulas whose negation normal forms are combined to the negation normal form of the given formula, see combine().
+ */
 template<typename Poly>
-Formula<Poly> to_nnf(const Formula<Poly>& formula) {
+Formulas<Poly> dependencies(const Formula<Poly>& formula) {
+    if (formula.type() == carl::FormulaType::TRUE || formula.type() == carl::FormulaType::FALSE || formula.is_atom() || formula.is_literal()) {
+        return {};
+    }
+    switch(formula.type()){
+        case carl::FormulaType::NOT:
+            return { resolve_negation(formula, false) };
+        case carl::FormulaType::IMPLIES:
+            return { formula.premise().negated(), formula.conclusion() };
+        case carl::FormulaType::IFF: {
+            Formulas<Poly> res;
+            for (const auto& f : formula.subformulas()) {
+                res.emplace_back(f);
+                res.emplace_back(f.negated());
+            }
+            return res;
+        }
+        case carl::FormulaType::XOR: {
+            auto lhs = formula::aux::connectPrecedingSubformulas(formula);
+            const auto& rhs = formula.subformulas().back();
+            return { lhs, rhs, !lhs, !rhs };
+        }
+        case carl::FormulaType::ITE:
+            return { !formula.condition(), formula.first_case(), formula.condition(), formula.second_case() };
+        case carl::FormulaType::OR:
+        case carl::FormulaType::AND:
+            return formula.subformulas();
+        default:
+            return {};
+    }
+}
+
+/**
+ * Combines the negation normal forms of the dependencies() of the given formula to its negation normal form.
+ */
+template<typename Poly>
+Formula<Poly> combine(const Formula<Poly>& formula, Formulas<Poly>&& nnfs) {
     if(formula.type() == carl::FormulaType::TRUE || formula.type() == carl::FormulaType::FALSE){
         return formula;
     }
@@ -19,54 +62,80 @@ Formula<Poly> to_nnf(const Formula<Poly>& formula) {
 
     switch(formula.type()){
         case carl::FormulaType::NOT:
-            return to_nnf(resolve_negation(formula, false));
-        case carl::FormulaType::IMPLIES: {
-            auto premise = to_nnf(formula.premise().negated());
-            auto conclusion = to_nnf(formula.conclusion());
-            return Formula<Poly>(carl::FormulaType::OR, Formulas<Poly>{ premise, conclusion});
-        }
+            return nnfs.front();
+        case carl::FormulaType::IMPLIES:
+            return Formula<Poly>(carl::FormulaType::OR, Formulas<Poly>{ nnfs[0], nnfs[1] });
         case carl::FormulaType::IFF: {
             Formulas<Poly> poss;
             Formulas<Poly> negs;
-            for (const auto& f : formula.subformulas()) {
-                poss.emplace_back(to_nnf(f));
-                negs.emplace_back(to_nnf(f.negated()));
+            for (std::size_t i = 0; i < nnfs.size(); i += 2) {
+                poss.emplace_back(std::move(nnfs[i]));
+                negs.emplace_back(std::move(nnfs[i+1]));
             }
             Formula<Poly> pos(carl::FormulaType::AND, std::move(poss));
             Formula<Poly> neg(carl::FormulaType::AND, std::move(negs));
             return Formula<Poly>(carl::FormulaType::OR, Formulas<Poly>({ pos, neg }));
         }
         case carl::FormulaType::XOR: {
-            auto lhs = formula::aux::connectPrecedingSubformulas(formula);
-            const auto& rhs = formula.subformulas().back();
-            Formula<Poly> pos(FormulaType::OR, { to_nnf(lhs), to_nnf(rhs) });
-            Formula<Poly> neg(FormulaType::OR, { to_nnf(!lhs), to_nnf(!rhs) });
+            Formula<Poly> pos(FormulaType::OR, { nnfs[0], nnfs[1] });
+            Formula<Poly> neg(FormulaType::OR, { nnfs[2], nnfs[3] });
             return Formula<Poly>(carl::FormulaType::AND, Formulas<Poly>({ pos, neg }));
         }
         case carl::FormulaType::ITE: {
-			Formula<Poly> first(FormulaType::OR, {to_nnf(!formula.condition()), to_nnf(formula.first_case())});
-			Formula<Poly> second(FormulaType::OR, {to_nnf(formula.condition()), to_nnf(formula.second_case())});
+            Formula<Poly> first(FormulaType::OR, { nnfs[0], nnfs[1] });
+            Formula<Poly> second(FormulaType::OR, { nnfs[2], nnfs[3] });
             return Formula<Poly>(carl::FormulaType::AND, Formulas<Poly>({ first, second }));
         }
-        case carl::FormulaType::OR:{
-            Formulas<Poly> disjunctions;
-            for(const auto& subformula : formula.subformulas()){
-                disjunctions.push_back(to_nnf(subformula));
-            }
-            return Formula<Poly>(carl::FormulaType::OR, std::move(disjunctions));
-        }
-        case carl::FormulaType::AND:{
-            Formulas<Poly> conjunctions;
-            for(const auto& subformula : formula.subformulas()){
-                conjunctions.push_back(to_nnf(subformula));
-            }
-            return Formula<Poly>(carl::FormulaType::AND, std::move(conjunctions));
-        }
+        case carl::FormulaType::OR:
+            return Formula<Poly>(carl::FormulaType::OR, std::move(nnfs));
+        case carl::FormulaType::AND:
+            return Formula<Poly>(carl::FormulaType::AND, std::move(nnfs));
         default:
             assert(false);
             return Formula<Poly>(carl::FormulaType::FALSE);
     }
+}
 
 }
 
-}
\ No newline at end of file
+/**
+ * Transforms the given formula to negation normal form.
+ * Every distinct formula is transformed only once, and the transformation uses an explicit stack instead of recursion.
+ */
+template<typename Poly>
+Formula<Poly> to_nnf(const Formula<Poly>& formula) {
+    struct Task {
+        Formula<Poly> formula;
+        Formulas<Poly> dependencies;
+        bool expanded;
+    };
+    // Keyed by formulas instead of ids to keep the dependencies alive, which are mostly temporary formulas
+    std::unordered_map<Formula<Poly>,Formula<Poly>> results;
+    auto done = [&results](const Formula<Poly>& f) { return results.find(f) != results.end(); };
+    std::vector<Task> stack;
+    stack.push_back(Task{ formula, {}, false });
+    while (!stack.empty()) {
+        Task& task = stack.back();
+        if (done(task.formula)) {
+            stack.pop_back();
+        } else if (task.expanded) {
+            Formulas<Poly> nnfs;
+            for (const auto& d: task.dependencies) {
+                nnfs.emplace_back(results.at(d));
+            }
+            results.emplace(task.formula, formula_to_nnf::combine(task.formula, std::move(nnfs)));
+            stack.pop_back();
+        } else {
+            task.expanded = true;
+            task.dependencies = formula_to_nnf::dependencies(task.formula);
+            // Copy as pushing invalidates task.
+            Formulas<Poly> deps = task.dependencies;
+            for (auto it = deps.rbegin(); it != deps.rend(); ++it) {
+                if (!done(*it)) stack.push_back(Task{ *it, {}, false });
+            }
+        }
+    }
+    return results.at(formula);
+}
+
+}
@@ -27,8 +27,19 @@ inline std::ostream& operator<<(std::ostream& os, const Quantifier& type) {
 
 using QuantifierPrefix = std::vector<std::pair<Quantifier, carl::Variable>>;
 
+namespace formula_to_pnf {
+/// Results of to_pnf() for quantifier-free formulas, keyed by the formula and whether it is negated.
 template<typename Poly>
-Formula<Poly> to_pnf(const Formula<Poly>& f, QuantifierPrefix& reverse_prefix, boost::container::flat_set<Variable>& used_vars, bool negated = false) {
+using Cache = std::map<std::pair<Formula<Poly>,bool>,Formula<Poly>>;
+}
+
+template<typename Poly>
+Formula<Poly> to_pnf(const Formula<Poly>& f, QuantifierPrefix& reverse_prefix, boost::container::flat_set<Variable>& used_vars, formula_to_pnf::Cache<Poly>& cache, bool negated = false);
+
+namespace formula_to_pnf {
+
+template<typename Poly>
+Formula<Poly> transform(const Formula<Poly>& f, QuantifierPrefix& reverse_prefix, boost::container::flat_set<Variable>& used_vars, Cache<Poly>& cache, bool negated) {
 	switch (f.type()) {
 		case FormulaType::AND:
 		case FormulaType::IFF:
@@ -37,13 +48,13 @@ Formula<Poly> to_pnf(const Formula<Poly>& f, QuantifierPrefix& reverse_prefix, b
 			if (!negated) {
 				Formulas<Poly> subs;
 				for (auto& sub : f.subformulas()) {
-					subs.push_back(to_pnf(sub, reverse_prefix, used_vars, false));
+					subs.push_back(to_pnf(sub, reverse_prefix, used_vars, cache, false));
 				}
 				return Formula<Poly>(f.type(), std::move(subs));
 			} else if (f.type() == FormulaType::AND || f.type() == FormulaType::OR) {
 				Formulas<Poly> subs;
 				for (auto& sub : f.subformulas()) {
-					subs.push_back(to_pnf(sub, reverse_prefix, used_vars, true));
+					subs.push_back(to_pnf(sub, reverse_prefix, used_vars, cache, true));
 				}
 				if (f.type() == FormulaType::AND) {
 					return Formula<Poly>(FormulaType::OR, std::move(subs));
@@ -54,13 +65,13 @@ Formula<Poly> to_pnf(const Formula<Poly>& f, QuantifierPrefix& reverse_prefix, b
 				Formulas<Poly> sub1;
 				Formulas<Poly> sub2;
 				for (auto& sub : f.subformulas()) {
-					sub1.push_back(to_pnf(sub, reverse_prefix, used_vars, true));
-					sub2.push_back(to_pnf(sub, reverse_prefix, used_vars, false));
+					sub1.push_back(to_pnf(sub, reverse_prefix, used_vars, cache, true));
+					sub2.push_back(to_pnf(sub, reverse_prefix, used_vars, cache, false));
 				}
 				return Formula<Poly>(FormulaType::AND, {Formula<Poly>(FormulaType::OR, std::move(sub1)), Formula<Poly>(FormulaType::OR, std::move(sub2))});
 			} else if (f.type() == FormulaType::XOR) {
-				auto lhs = to_pnf(f, reverse_prefix, used_vars, false);
-				auto rhs = to_pnf(formula::aux::connectPrecedingSubformulas(f), reverse_prefix, used_vars, false);
+				auto lhs = to_pnf(f, reverse_prefix, used_vars, cache, false);
+				auto rhs = to_pnf(formula::aux::connectPrecedingSubformulas(f), reverse_prefix, used_vars, cache, false);
 				return Formula<Poly>(FormulaType::IFF, std::vector<Formula<Poly>>({lhs, rhs}));
 			}
 			assert(false);
@@ -96,7 +107,7 @@ Formula<Poly> to_pnf(const Formula<Poly>& f, QuantifierPrefix& reverse_prefix, b
 				}
 			}
 
-			auto subres = to_pnf(sub, reverse_prefix, used_vars, negated);
+			auto subres = to_pnf(sub, reverse_prefix, used_vars, cache, negated);
 			for (auto v : new_qvars) {
 				if (subres.variables().find(v) != subres.variables().end()) {
 					reverse_prefix.push_back(std::make_pair(q, v));
@@ -123,7 +134,7 @@ Formula<Poly> to_pnf(const Formula<Poly>& f, QuantifierPrefix& reverse_prefix, b
 				}
 			}
 
-			auto subres = carl::Formula(carl::FormulaType::AND, sub_aux, to_pnf(sub, reverse_prefix, used_vars, negated));
+			auto subres = carl::Formula(carl::FormulaType::AND, sub_aux, to_pnf(sub, reverse_prefix, used_vars, cache, negated));
 			for (auto v : new_qvars) {
 				if (subres.variables().find(v) != subres.variables().end()) {
 					reverse_prefix.push_back(std::make_pair(q, v));
@@ -133,22 +144,56 @@ Formula<Poly> to_pnf(const Formula<Poly>& f, QuantifierPrefix& reverse_prefix, b
 		}
 		case FormulaType::IMPLIES:
 			if (negated) {
-				return Formula<Poly>(FormulaType::AND, {to_pnf(f.premise(), reverse_prefix, used_vars, false), to_pnf(f.conclusion(), reverse_prefix, used_vars, true)});
+				return Formula<Poly>(FormulaType::AND, {to_pnf(f.premise(), reverse_prefix, used_vars, cache, false), to_pnf(f.conclusion(), reverse_prefix, used_vars, cache, true)});
 			} else {
-				return Formula<Poly>(FormulaType::OR, {to_pnf(f.premise(), reverse_prefix, used_vars, true), to_pnf(f.conclusion(), reverse_prefix, used_vars, false)});
+				return Formula<Poly>(FormulaType::OR, {to_pnf(f.premise(), reverse_prefix, used_vars, cache, true), to_pnf(f.conclusion(), reverse_prefix, used_vars, cache, false)});
 			}
 		case FormulaType::ITE:
-			return Formula<Poly>(FormulaType::ITE, {to_pnf(f.condition(), reverse_prefix, used_vars, negated), to_pnf(f.first_case(), reverse_prefix, used_vars, negated), to_pnf(f.second_case(), reverse_prefix, used_vars, negated)});
+			return Formula<Poly>(FormulaType::ITE, {to_pnf(f.condition(), reverse_prefix, used_vars, cache, negated), to_pnf(f.first_case(), reverse_prefix, used_vars, cache, negated), to_pnf(f.second_case(), reverse_prefix, used_vars, cache, negated)});
 		case FormulaType::NOT:
-			return to_pnf(f.subformula(), reverse_prefix, used_vars, !negated);
+			return to_pnf(f.subformula(), reverse_prefix, used_vars, cache, !negated);
 		default:
 			assert(false);
 			return Formula<Poly>(FormulaType::FALSE);
 	}
 }
 
+}
+
+/**
+ * Transforms f to prenex normal form, see to_pnf(const Formula<Poly>&).
+ * Quantifier-free subformulas do not affect the prefix, hence their results are cached and shared subformulas are transformed only once.
+ */
+template<typename Poly>
+Formula<Poly> to_pnf(const Formula<Poly>& f, QuantifierPrefix& reverse_prefix, boost::container::flat_set<Variable>& used_vars, formula_to_pnf::Cache<Poly>& cache, bool negated) {
+	if (f.property_holds(PROP_CONTAINS_QUANTIFIER_EXISTS) || f.property_holds(PROP_CONTAINS_QUANTIFIER_FORALL)) {
+		return formula_to_pnf::transform(f, reverse_prefix, used_vars, cache, negated);
+	}
+	auto key = std::make_pair(f, negated);
+	auto it = cache.find(key);
+	if (it != cache.end()) return it->second;
+	auto res = formula_to_pnf::transform(f, reverse_prefix, used_vars, cache, negated);
+	cache.emplace(key, res);
+	return res;
+}
+
+template<typename Poly>
+Formula<Poly> to_pnf(const Formula<Poly>& f, QuantifierPrefix& reverse_prefix, boost::container::flat_set<Variable>& used_vars, bool negated = false) {
+	formula_to_pnf::Cache<Poly> cache;
+	return to_pnf(f, reverse_prefix, used_vars, cache, negated);
+}
+
 template<typename Poly>
 void free_variables(const Formula<Poly>& f, boost::container::flat_set<Variable>& current_quantified_vars, boost::container::flat_set<Variable>& free_vars) {
+	if (!f.property_holds(PROP_CONTAINS_QUANTIFIER_EXISTS) && !f.property_holds(PROP_CONTAINS_QUANTIFIER_FORALL) && f.type() != FormulaType::VARASSIGN) {
+		// Visits shared subformulas only once.
+		for (auto v : variables(f)) {
+			if (!current_quantified_vars.contains(v)) {
+				free_vars.insert(v);
+			}
+		}
+		return;
+	}
 	switch (f.type()) {
 		case FormulaType::AND:
 		case FormulaType::IFF:
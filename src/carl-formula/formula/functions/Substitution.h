@@ -70,22 +70,22 @@ Formula<Pol> substitute(const Formula<Pol>& formula, const Source& source, const
 template<typename Pol>
 Formula<Pol> substitute(const Formula<Pol>& formula, const std::map<Formula<Pol>,Formula<Pol>>& replacements) {
 	helper::Substitutor<Pol> subs(replacements);
-	return visit_result(formula, std::function<Formula<Pol>(Formula<Pol>)>(subs));
+	return memoized_visit_result(formula, subs);
 }
 template<typename Pol>
 Formula<Pol> substitute(const Formula<Pol>& formula, const std::map<Variable,typename Formula<Pol>::PolynomialType>& replacements) {
 	helper::PolynomialSubstitutor<Pol> subs(replacements);
-	return visit_result(formula, std::function<Formula<Pol>(Formula<Pol>)>(subs));
+	return memoized_visit_result(formula, subs);
 }
 template<typename Pol>
 Formula<Pol> substitute(const Formula<Pol>& formula, const std::map<BVVariable,BVTerm>& replacements) {
 	helper::BitvectorSubstitutor<Pol> subs(replacements);
-	return visit_result(formula, std::function<Formula<Pol>(Formula<Pol>)>(subs));
+	return memoized_visit_result(formula, subs);
 }
 template<typename Pol>
 Formula<Pol> substitute(const Formula<Pol>& formula, const std::map<UVariable,UFInstance>& replacements) {
 	helper::UninterpretedSubstitutor<Pol> subs(replacements);
-	return visit_result(formula, std::function<Formula<Pol>(Formula<Pol>)>(subs));
+	return memoized_visit_result(formula, subs);
 }
 
 }
\ No newline at end of file
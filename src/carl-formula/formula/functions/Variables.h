@@ -7,7 +7,7 @@ namespace carl{
 
 template<typename Pol>
 void variables(const Formula<Pol>& f, carlVariables& vars) {
-    carl::visit(f,
+    carl::memoized_visit(f,
         [&vars](const Formula<Pol>& f) {
             switch (f.type()) {
                 case FormulaType::BOOL:
@@ -41,7 +41,7 @@ void variables(const Formula<Pol>& f, carlVariables& vars) {
 
 template<typename Pol>
 void uninterpreted_functions(const Formula<Pol>& f, std::set<UninterpretedFunction>& ufs) {
-    carl::visit(f,
+    carl::memoized_visit(f,
         [&ufs](const Formula<Pol>& f) {
             if (f.type() == FormulaType::UEQ) {
                 f.u_equality().gatherUFs(ufs);
@@ -52,7 +52,7 @@ void uninterpreted_functions(const Formula<Pol>& f, std::set<UninterpretedFuncti
 
 template<typename Pol>
 void uninterpreted_variables(const Formula<Pol>& f, std::set<UVariable>& uvs) {
-    carl::visit(f,
+    carl::memoized_visit(f,
         [&uvs](const Formula<Pol>& f) {
             if (f.type() == FormulaType::UEQ) {
                 f.u_equality().gatherUVariables(uvs);
@@ -63,7 +63,7 @@ void uninterpreted_variables(const Formula<Pol>& f, std::set<UVariable>& uvs) {
 
 template<typename Pol>
 void bitvector_variables(const Formula<Pol>& f, std::set<BVVariable>& bvvs) {
-    carl::visit(f,
+    carl::memoized_visit(f,
         [&bvvs](const Formula<Pol>& f) {
             if (f.type() == FormulaType::BITVECTOR) {
                 f.bv_constraint().gatherBVVariables(bvvs);
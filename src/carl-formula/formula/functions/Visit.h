@@ -1,15 +1,19 @@
 #pragma once
 
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
 namespace carl {
 
+namespace formula_visit {
 
 /**
- * Recursively calls func on every subformula.
- * @param formula Formula to visit.
- * @param func Function to call.
+ * Calls func on every direct subformula of the given formula, in the order in which they are visited.
  */
-template<typename Pol, typename Visitor>
-void visit(const Formula<Pol>& formula, /*std::function<void(const Formula<Pol>&)>&*/ Visitor func) {
+template<typename Pol, typename Func>
+void for_each_subformula(const Formula<Pol>& formula, Func&& func) {
 	switch (formula.type()) {
 		case AND:
 		case OR:
@@ -17,10 +21,10 @@ void visit(const Formula<Pol>& formula, /*std::function<void(const Formula<Pol>&
 		case XOR:
 		case IMPLIES:
 		case ITE:
-			for (const auto& cur: formula.subformulas()) visit(cur, func);
+			for (const auto& cur: formula.subformulas()) func(cur);
 			break;
 		case NOT:
-			visit(formula.subformula(), func);
+			func(formula.subformula());
 			break;
 		case BOOL:
 		case CONSTRAINT:
@@ -33,63 +37,60 @@ void visit(const Formula<Pol>& formula, /*std::function<void(const Formula<Pol>&
 			break;
 		case EXISTS:
 		case FORALL:
-			visit(formula.quantified_formula(), func);
+			func(formula.quantified_formula());
 			break;
 		case AUX_EXISTS:
-			visit(formula.quantified_formula(), func);
-			visit(formula.quantified_aux_formula(), func);
+			func(formula.quantified_formula());
+			func(formula.quantified_aux_formula());
 			break;
 	}
-	func(formula);
 }
+
 /**
- * Recursively calls func on every subformula and return a new formula.
- * On every call of func, the passed formula is replaced by the result.
- * @param formula Formula to visit.
- * @param func Function to call.
- * @return New formula.
+ * Replaces every direct subformula of the given formula by the result of func.
+ * The subformulas are passed to func in the order of for_each_subformula().
+ * @return The new formula, or the given formula if no subformula changed.
  */
-template<typename Pol, typename Visitor>
-Formula<Pol> visit_result(const Formula<Pol>& formula, /*std::function<Formula<Pol>(const Formula<Pol>&)>&*/ Visitor func) {
-	Formula<Pol> newFormula = formula;
+template<typename Pol, typename Func>
+Formula<Pol> replace_subformulas(const Formula<Pol>& formula, Func&& func) {
 	switch (formula.type()) {
 		case AND:
 		case OR:
 		case IFF:
 		case XOR: {
-			Formulas<typename Formula<Pol>::PolynomialType> newSubformulas;
+			Formulas<Pol> newSubformulas;
 			bool changed = false;
 			for (const auto& cur: formula.subformulas()) {
-				Formula newCur = visit_result(cur, func);
+				Formula<Pol> newCur = func(cur);
 				if (newCur != cur) changed = true;
 				newSubformulas.push_back(newCur);
 			}
 			if (changed) {
-				newFormula = Formula(formula.type(), std::move(newSubformulas));
+				return Formula<Pol>(formula.type(), std::move(newSubformulas));
 			}
 			break;
 		}
 		case NOT: {
-			Formula<Pol> cur = visit_result(formula.subformula(), func);
+			Formula<Pol> cur = func(formula.subformula());
 			if (cur != formula.subformula()) {
-				newFormula = !cur;
+				return !cur;
 			}
 			break;
 		}
 		case IMPLIES: {
-			Formula<Pol> prem = visit_result(formula.premise(), func);
-			Formula<Pol> conc = visit_result(formula.conclusion(), func);
+			Formula<Pol> prem = func(formula.premise());
+			Formula<Pol> conc = func(formula.conclusion());
 			if ((prem != formula.premise()) || (conc != formula.conclusion())) {
-				newFormula = Formula(IMPLIES, {prem, conc});
+				return Formula<Pol>(IMPLIES, {prem, conc});
 			}
 			break;
 		}
 		case ITE: {
-			Formula<Pol> cond = visit_result(formula.condition(), func);
-			Formula<Pol> fCase = visit_result(formula.first_case(), func);
-			Formula<Pol> sCase = visit_result(formula.second_case(), func);
+			Formula<Pol> cond = func(formula.condition());
+			Formula<Pol> fCase = func(formula.first_case());
+			Formula<Pol> sCase = func(formula.second_case());
 			if ((cond != formula.condition()) || (fCase != formula.first_case()) || (sCase != formula.second_case())) {
-				newFormula = Formula(ITE, {cond, fCase, sCase});
+				return Formula<Pol>(ITE, {cond, fCase, sCase});
 			}
 			break;
 		}
@@ -104,23 +105,113 @@ Formula<Pol> visit_result(const Formula<Pol>& formula, /*std::function<Formula<P
 			break;
 		case EXISTS:
 		case FORALL: {
-			Formula<Pol> sub = visit_result(formula.quantified_formula(), func);
+			Formula<Pol> sub = func(formula.quantified_formula());
 			if (sub != formula.quantified_formula()) {
-				newFormula = Formula<Pol>(formula.type(), formula.quantified_variables(), sub);
+				return Formula<Pol>(formula.type(), formula.quantified_variables(), sub);
 			}
 			break;
 		}
 		case AUX_EXISTS: {
-			Formula<Pol> sub = visit_result(formula.quantified_formula(), func);
-			Formula<Pol> sub_aux = visit_result(formula.quantified_aux_formula(), func);
+			Formula<Pol> sub = func(formula.quantified_formula());
+			Formula<Pol> sub_aux = func(formula.quantified_aux_formula());
 			if (sub != formula.quantified_formula() || sub_aux != formula.quantified_aux_formula()) {
-				newFormula = Formula<Pol>(formula.type(), formula.quantified_variables(), sub_aux, sub);
+				return Formula<Pol>(formula.type(), formula.quantified_variables(), sub_aux, sub);
 			}
 			break;
 		}
 	}
-	return func(newFormula);
+	return formula;
 }
 
+/**
+ * Pushes the direct subformulas of formula that are not skipped onto the stack such that they are popped in the order of for_each_subformula().
+ */
+template<typename Pol, typename Skip>
+void push_subformulas(std::vector<std::pair<const Formula<Pol>*,bool>>& stack, const Formula<Pol>& formula, Skip&& skip) {
+	std::size_t size = stack.size();
+	for_each_subformula(formula, [&](const Formula<Pol>& sub) {
+		if (!skip(sub)) stack.emplace_back(&sub, false);
+	});
+	std::reverse(stack.begin() + static_cast<std::ptrdiff_t>(size), stack.end());
+}
+
+}
 
-}
\ No newline at end of file
+/**
+ * Recursively calls func on every subformula.
+ * @param formula Formula to visit.
+ * @param func Function to call.
+ */
+template<typename Pol, typename Visitor>
+void visit(const Formula<Pol>& formula, /*std::function<void(const Formula<Pol>&)>&*/ Visitor func) {
+	formula_visit::for_each_subformula(formula, [&func](const Formula<Pol>& sub) { visit(sub, func); });
+	func(formula);
+}
+
+/**
+ * Calls func on every distinct subformula exactly once, after it has been called on its subformulas.
+ * As formulas are shared in the pool, this is linear in the number of distinct subformulas while visit() may take exponential time.
+ * The traversal uses an explicit stack and thus also works for deeply nested formulas.
+ * @param formula Formula to visit.
+ * @param func Function to call.
+ */
+template<typename Pol, typename Visitor>
+void memoized_visit(const Formula<Pol>& formula, Visitor&& func) {
+	std::unordered_set<std::size_t> visited;
+	std::vector<std::pair<const Formula<Pol>*,bool>> stack = {{&formula, false}};
+	while (!stack.empty()) {
+		auto [current, expanded] = stack.back();
+		if (expanded) {
+			stack.pop_back();
+			func(*current);
+		} else if (!visited.insert(current->id()).second) {
+			stack.pop_back();
+		} else {
+			stack.back().second = true;
+			formula_visit::push_subformulas(stack, *current, [&visited](const Formula<Pol>& sub) { return visited.count(sub.id()) > 0; });
+		}
+	}
+}
+
+/**
+ * Recursively calls func on every subformula and return a new formula.
+ * On every call of func, the passed formula is replaced by the result.
+ * @param formula Formula to visit.
+ * @param func Function to call.
+ * @return New formula.
+ */
+template<typename Pol, typename Visitor>
+Formula<Pol> visit_result(const Formula<Pol>& formula, /*std::function<Formula<Pol>(const Formula<Pol>&)>&*/ Visitor func) {
+	return func(formula_visit::replace_subformulas(formula, [&func](const Formula<Pol>& sub) { return visit_result(sub, func); }));
+}
+
+/**
+ * Like visit_result(), but calls func only once for every distinct subformula and reuses the result for all its occurrences.
+ * Hence func must only depend on the passed formula.
+ * The traversal uses an explicit stack and thus also works for deeply nested formulas.
+ * @param formula Formula to visit.
+ * @param func Function to call.
+ * @return New formula.
+ */
+template<typename Pol, typename Visitor>
+Formula<Pol> memoized_visit_result(const Formula<Pol>& formula, Visitor&& func) {
+	std::unordered_map<std::size_t,Formula<Pol>> results;
+	std::vector<std::pair<const Formula<Pol>*,bool>> stack = {{&formula, false}};
+	auto done = [&results](const Formula<Pol>& f) { return results.find(f.id()) != results.end(); };
+	while (!stack.empty()) {
+		auto [current, expanded] = stack.back();
+		if (done(*current)) {
+			stack.pop_back();
+		} else if (expanded) {
+			stack.pop_back();
+			Formula<Pol> res = func(formula_visit::replace_subformulas(*current, [&results](const Formula<Pol>& sub) { return results.at(sub.id()); }));
+			results.emplace(current->id(), std::move(res));
+		} else {
+			stack.back().second = true;
+			formula_visit::push_subformulas(stack, *current, done);
+		}
+	}
+	return results.at(formula.id());
+}
+
+}
@@ -122,6 +122,7 @@ namespace carl
 		}
 		template<typename T>
 		void assign(const typename Map::key_type& key, const T& t) {
+			resetCaches();
 			auto it = mData.find(key);
 			if (it == mData.end()) mData.emplace(key, t);
 			else it->second = t;
@@ -0,0 +1,198 @@
+#pragma once
+
+#include "ModelEvaluation.h"
+#include <carl-formula/formula/functions/Variables.h>
+
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace carl {
+namespace model {
+
+/**
+ * Substitutes a fixed model into formulas and caches the results.
+ *
+ * As formulas are shared in the formula pool, every distinct subformula is substituted only once,
+ * no matter how often it occurs within or across the formulas passed to substitute().
+ * Additionally, the substitution into the left-hand sides of constraints is cached per polynomial,
+ * such that for example p < 0 and p = 0 share it.
+ *
+ * The results remain valid as long as the model does not change.
+ * After the value of a variable has changed, invalidate() has to be called for this variable.
+ * It only discards the results that depend on the variable, that is the atoms that contain it and all formulas containing these atoms.
+ * Hence, substituting into the same formulas after a (small) change of the model only recomputes the affected part.
+ */
+template<typename Rational, typename Poly>
+class EvaluationContext {
+	struct Entry {
+		Formula<Poly> result;
+		/// Formulas whose results have been computed from this result.
+		std::set<Formula<Poly>> parents;
+	};
+
+	const Model<Rational,Poly>& mModel;
+	std::unordered_map<Formula<Poly>,Entry> mFormulas;
+	std::unordered_map<Poly,Poly> mPolynomials;
+	/// Atoms and polynomials whose results depend on the value of a variable.
+	std::unordered_map<Variable,std::set<Formula<Poly>>> mAtomsOf;
+	std::unordered_map<Variable,std::unordered_set<Poly>> mPolynomialsOf;
+
+	static Variable as_variable(const ModelVariable& var) {
+		if (var.is_variable()) return var.asVariable();
+		if (var.isBVVariable()) return var.asBVVariable().variable();
+		assert(var.isUVariable());
+		return var.asUVariable().variable();
+	}
+
+	static bool is_connective(const Formula<Poly>& f) {
+		switch (f.type()) {
+			case FormulaType::AND:
+			case FormulaType::OR:
+			case FormulaType::XOR:
+			case FormulaType::IFF:
+			case FormulaType::IMPLIES:
+			case FormulaType::ITE:
+			case FormulaType::NOT:
+				return true;
+			default:
+				return false;
+		}
+	}
+
+	Formula<Poly> substitute_atom(const Formula<Poly>& f) {
+		Formula<Poly> res = f;
+		if (f.type() == FormulaType::CONSTRAINT) {
+			evaluateConstraint(res, Constraint<Poly>(substitute(f.constraint().lhs()), f.constraint().relation()), mModel, true);
+		} else {
+			substituteAtom(res, mModel);
+		}
+		// Quantified formulas are not evaluated, hence their results do not depend on the model.
+		if (f.is_atom()) {
+			for (auto v: carl::variables(f)) {
+				mAtomsOf[v].insert(f);
+			}
+		}
+		return res;
+	}
+
+	/// Discards the results for f and all formulas whose results have been computed from it.
+	void invalidate_formula(const Formula<Poly>& f) {
+		std::vector<Formula<Poly>> queue = { f };
+		while (!queue.empty()) {
+			auto it = mFormulas.find(queue.back());
+			queue.pop_back();
+			if (it == mFormulas.end()) continue;
+			queue.insert(queue.end(), it->second.parents.begin(), it->second.parents.end());
+			mFormulas.erase(it);
+		}
+	}
+
+	void invalidate_variable(Variable v) {
+		auto ait = mAtomsOf.find(v);
+		if (ait != mAtomsOf.end()) {
+			for (const auto& f: ait->second) {
+				invalidate_formula(f);
+			}
+			mAtomsOf.erase(ait);
+		}
+		auto pit = mPolynomialsOf.find(v);
+		if (pit != mPolynomialsOf.end()) {
+			for (const auto& p: pit->second) {
+				mPolynomials.erase(p);
+			}
+			mPolynomialsOf.erase(pit);
+		}
+	}
+
+public:
+	explicit EvaluationContext(const Model<Rational,Poly>& model): mModel(model) {}
+
+	const Model<Rational,Poly>& model() const {
+		return mModel;
+	}
+
+	/**
+	 * Substitutes the model into a polynomial, see substitute_inplace(Poly&, const Model&).
+	 * The returned reference is valid until the next call of invalidate() or clear().
+	 */
+	const Poly& substitute(const Poly& p) {
+		auto it = mPolynomials.find(p);
+		if (it != mPolynomials.end()) return it->second;
+		for (auto v: carl::variables(p)) {
+			mPolynomialsOf[v].insert(p);
+		}
+		return mPolynomials.emplace(p, carl::substitute(p, mModel)).first->second;
+	}
+
+	/**
+	 * Substitutes the model into a formula, see substitute_inplace(Formula<Poly>&, const Model&).
+	 */
+	Formula<Poly> substitute(const Formula<Poly>& formula) {
+		auto done = [this](const Formula<Poly>& f) { return mFormulas.find(f) != mFormulas.end(); };
+		std::vector<std::pair<const Formula<Poly>*,bool>> stack = {{&formula, false}};
+		while (!stack.empty()) {
+			auto [current, expanded] = stack.back();
+			if (done(*current)) {
+				stack.pop_back();
+			} else if (!is_connective(*current)) {
+				stack.pop_back();
+				CARL_LOG_DEBUG("carl.model.evaluation", "Evaluating " << *current << " on " << mModel);
+				mFormulas.emplace(*current, Entry{ substitute_atom(*current), {} });
+			} else if (expanded) {
+				stack.pop_back();
+				Formula<Poly> res = formula_visit::replace_subformulas(*current, [this](const Formula<Poly>& sub) { return mFormulas.at(sub).result; });
+				formula_visit::for_each_subformula(*current, [this,current=current](const Formula<Poly>& sub) { mFormulas.at(sub).parents.insert(*current); });
+				CARL_LOG_DEBUG("carl.model.evaluation", "Result for " << *current << ": " << res);
+				mFormulas.emplace(*current, Entry{ std::move(res), {} });
+			} else {
+				stack.back().second = true;
+				formula_visit::push_subformulas(stack, *current, done);
+			}
+		}
+		return mFormulas.at(formula).result;
+	}
+
+	/**
+	 * Evaluates a formula over the model, see evaluate_inplace(ModelValue&, Formula<Poly>&, const Model&).
+	 */
+	ModelValue<Rational,Poly> evaluate(const Formula<Poly>& formula) {
+		Formula<Poly> f = substitute(formula);
+		if (f.is_true()) return true;
+		if (f.is_false()) return false;
+		return createSubstitution<Rational,Poly,ModelFormulaSubstitution<Rational,Poly>>(f);
+	}
+
+	/**
+	 * Discards all results that depend on the value of the given variable.
+	 * As the values of other variables may be substitutions that refer to this variable, the results for these variables are discarded as well.
+	 * The values of uninterpreted functions are not tracked, hence changing them discards all results.
+	 */
+	void invalidate(const ModelVariable& var) {
+		if (var.isFunction()) {
+			clear();
+			return;
+		}
+		for (const auto& [key, value]: mModel) {
+			if (!value.isSubstitution()) continue;
+			if (key.isFunction()) {
+				clear();
+				return;
+			}
+			invalidate_variable(as_variable(key));
+		}
+		invalidate_variable(as_variable(var));
+	}
+
+	/// Discards all results.
+	void clear() {
+		mFormulas.clear();
+		mPolynomials.clear();
+		mAtomsOf.clear();
+		mPolynomialsOf.clear();
+	}
+};
+
+}
+}
@@ -25,6 +25,8 @@ ModelValue<Rational,Poly> evaluate(const T& t, const Model<Rational,Poly>& m);
 #include "ModelEvaluation_Polynomial.h"
 #include "ModelEvaluation_Uninterpreted.h"
 
+#include "EvaluationContext.h"
+
 namespace carl {
 
 /**
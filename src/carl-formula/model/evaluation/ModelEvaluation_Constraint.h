@@ -18,13 +18,10 @@ namespace carl {
 	}
 	
 	/**
-	 * Evaluates a constraint to a ModelValue over a Model.
-	 * If evaluation can not be done for some variables, the result may actually be a Constraint again.
+	 * Evaluates a constraint to a ModelValue over a Model, like evaluate_inplace(), but assumes that the model has already been substituted into c.
 	 */
 	template<typename Rational, typename Poly>
-	void evaluate_inplace(ModelValue<Rational,Poly>& res, Constraint<Poly>& c, const Model<Rational,Poly>& m) {
-		substitute_inplace(c, m);
-		
+	void evaluate_substituted(ModelValue<Rational,Poly>& res, const Constraint<Poly>& c, const Model<Rational,Poly>& m) {
 		auto map = model::collectRANIR(carl::variables(c.lhs()).as_set(), m);
 		if (map.size() == carl::variables(c.lhs()).size()) {
 			auto eval_res = evaluate(c.constr(), map);
@@ -44,4 +41,14 @@ namespace carl {
 		// }
 	}
 
+	/**
+	 * Evaluates a constraint to a ModelValue over a Model.
+	 * If evaluation can not be done for some variables, the result may actually be a Constraint again.
+	 */
+	template<typename Rational, typename Poly>
+	void evaluate_inplace(ModelValue<Rational,Poly>& res, Constraint<Poly>& c, const Model<Rational,Poly>& m) {
+		substitute_inplace(c, m);
+		evaluate_substituted(res, c, m);
+	}
+
 }
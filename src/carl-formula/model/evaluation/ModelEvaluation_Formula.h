@@ -11,16 +11,29 @@ namespace carl {
 namespace model {
 	
 	template<typename Rational, typename Poly>
-	void substituteSubformulas(Formula<Poly>& f, const Model<Rational,Poly>& m) {
-		CARL_LOG_DEBUG("carl.model.evaluation", "Evaluating " << f << " on " << m);
-		Formulas<Poly> res = f.subformulas();
-		for (auto& r: res) {
-			CARL_LOG_DEBUG("carl.model.evaluation", "Evaluating " << r << " on " << m);
-			r = substitute(r, m);
-			CARL_LOG_DEBUG("carl.model.evaluation", "Result: " << r);
+	class EvaluationContext;
+
+	/**
+	 * Evaluates the constraint c over the model and stores the result in f.
+	 * If substituted is set, the model has already been substituted into c, for example by an EvaluationContext, and is not substituted again.
+	 */
+	template<typename Rational, typename Poly>
+	void evaluateConstraint(Formula<Poly>& f, const Constraint<Poly>& c, const Model<Rational,Poly>& m, bool substituted = false) {
+		ModelValue<Rational,Poly> res;
+		if (substituted) {
+			evaluate_substituted(res, c, m);
+		} else {
+			res = evaluate(c, m);
+		}
+		if (res.isBool()) {
+			if (res.asBool()) f = Formula<Poly>(FormulaType::TRUE);
+			else f = Formula<Poly>(FormulaType::FALSE);
+		} else {
+			assert(res.isSubstitution());
+			const auto& subs = res.asSubstitution();
+			auto fsubs = static_cast<ModelFormulaSubstitution<Rational,Poly>*>(subs.get());
+			f = fsubs->getFormula();
 		}
-		f = Formula<Poly>(f.type(), std::move(res));
-		CARL_LOG_DEBUG("carl.model.evaluation", "Result: " << f);
 	}
 
 	template<typename Rational, typename Poly>
@@ -105,25 +118,23 @@ namespace model {
 		}
 		if (va.negated()) f = f.negated();
 	}
-}
 
 	/**
-	 * Substitutes all variables from a model within a formula.
-	 * May fail to substitute some variables, for example if the values are RANs or SqrtEx.
+	 * Substitutes all variables from a model within a formula that is not composed of other formulas, i.e. an atom or a quantified formula.
+	 * Quantified formulas are not evaluated and remain unchanged.
 	 */
 	template<typename Rational, typename Poly>
-	void substitute_inplace(Formula<Poly>& f, const Model<Rational,Poly>& m) {
+	void substituteAtom(Formula<Poly>& f, const Model<Rational,Poly>& m) {
 		switch (f.type()) {
-			case FormulaType::ITE: {
-				f = Formula<Poly>(FormulaType::ITE, substitute(f.condition(), m), substitute(f.first_case(), m), substitute(f.second_case(), m));
-				break;
-			}
 			case FormulaType::EXISTS:
 				CARL_LOG_WARN("carl.model.evaluation", "Evaluation of exists not yet implemented.");
 				break;
 			case FormulaType::FORALL:
 				CARL_LOG_WARN("carl.model.evaluation", "Evaluation of forall not yet implemented.");
 				break;
+			case FormulaType::AUX_EXISTS:
+				CARL_LOG_WARN("carl.model.evaluation", "Evaluation of aux_exists not yet implemented.");
+				break;
 			case FormulaType::TRUE: break;
 			case FormulaType::FALSE: break;
 			case FormulaType::BOOL: {
@@ -136,37 +147,16 @@ namespace model {
 				}
 				break;
 			}
-			case FormulaType::NOT: {
-				f = Formula<Poly>(FormulaType::NOT, substitute(f.subformula(), m));
-				break;
-			}
-			case FormulaType::IMPLIES: {
-				f = Formula<Poly>(FormulaType::IMPLIES, substitute(f.premise(), m), substitute(f.conclusion(), m));
-				break;
-			}
-			case FormulaType::AND: model::substituteSubformulas(f, m); break;
-			case FormulaType::OR: model::substituteSubformulas(f, m); break;
-			case FormulaType::XOR: model::substituteSubformulas(f, m); break;
-			case FormulaType::IFF: model::substituteSubformulas(f, m); break;
 			case FormulaType::CONSTRAINT: {
-				auto res = evaluate(f.constraint(), m);
-				if (res.isBool()) {
-					if (res.asBool()) f = Formula<Poly>(FormulaType::TRUE);
-					else f = Formula<Poly>(FormulaType::FALSE);
-				} else {
-					assert(res.isSubstitution());
-					const auto& subs = res.asSubstitution();
-					auto fsubs = static_cast<ModelFormulaSubstitution<Rational,Poly>*>(subs.get());
-					f = fsubs->getFormula();
-				}
+				evaluateConstraint(f, f.constraint(), m);
 				break;
 			}
 			case FormulaType::VARCOMPARE: {
-				model::evaluateVarCompare(f, m);
+				evaluateVarCompare(f, m);
 				break;
 			}
 			case FormulaType::VARASSIGN: {
-				model::evaluateVarAssign(f, m);
+				evaluateVarAssign(f, m);
 				break;
 			}
 			case FormulaType::BITVECTOR: {
@@ -188,8 +178,22 @@ namespace model {
 				}
 				break;
 			}
+			default:
+				CARL_LOG_ERROR("carl.model.evaluation", "Formula " << f << " is not an atom.");
+				assert(false);
 		}
 	}
+}
+
+	/**
+	 * Substitutes all variables from a model within a formula.
+	 * May fail to substitute some variables, for example if the values are RANs or SqrtEx.
+	 * Every distinct subformula is substituted only once, see model::EvaluationContext.
+	 */
+	template<typename Rational, typename Poly>
+	void substitute_inplace(Formula<Poly>& f, const Model<Rational,Poly>& m) {
+		f = model::EvaluationContext<Rational,Poly>(m).substitute(f);
+	}
 	
 	/**
 	 * Evaluates a formula to a ModelValue over a Model.
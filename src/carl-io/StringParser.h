@@ -259,7 +259,7 @@ namespace carl::io
 			}
 			else
 			{
-                std::shared_ptr<const Monomial> result = createMonomial( std::move(varExpPairs) );
+                Monomial::Arg result = createMonomial( std::move(varExpPairs) );
 				return Term<C>(coeff, result);
 			}
 		
@@ -12,6 +12,8 @@ using namespace carl;
 
 template<typename Coeff>
 using PolynomialWithReasonSet = MultivariatePolynomial<Coeff, GrLexOrdering, StdMultivariatePolynomialPolicies<BVReasons, NoAllocator>>;
+template<typename Coeff>
+using PolynomialWithPackedMonomials = MultivariatePolynomial<Coeff, PackedGrLexOrdering, StdMultivariatePolynomialPolicies<NoReasons, NoAllocator, true>>;
 
 
 TEST(GB_Buchberger, T1)
@@ -44,6 +46,26 @@ TEST(GB_Buchberger, T1)
     EXPECT_EQ(y,gb2object.getIdeal().getGenerator(1));
 }
 
+TEST(GB_Buchberger, T1_PackedMonomials)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+
+    PolynomialWithPackedMonomials<Rational> f1({(Rational)1*x*x*x, (Rational)-2*x*y} );
+    PolynomialWithPackedMonomials<Rational> f2({(Rational)1*x*x*y, (Rational)-2*y*y, (Rational)1*x});
+    PolynomialWithPackedMonomials<Rational> F1({(Rational)1*x*x} );
+    PolynomialWithPackedMonomials<Rational> F2({(Rational)1*y*y, (Rational)-1*(Rational)1/(Rational)2*x} );
+    PolynomialWithPackedMonomials<Rational> F3({(Rational)1*x*y} );
+    GBProcedure<PolynomialWithPackedMonomials<Rational>, Buchberger, StdAdding> gbobject;
+    gbobject.addPolynomial(f1);
+    gbobject.addPolynomial(f2);
+    gbobject.reduceInput();
+    gbobject.calculate();
+    EXPECT_EQ(F1,gbobject.getIdeal().getGenerator(0));
+    EXPECT_EQ(F3,gbobject.getIdeal().getGenerator(1));
+    EXPECT_EQ(F2,gbobject.getIdeal().getGenerator(2));
+}
+
 TEST(GB_Buchberger, T1_ReasonSets)
 {
 	Variable x = fresh_real_variable("x");
@@ -76,3 +98,32 @@ TEST(GB_Buchberger, T1_ReasonSets)
     EXPECT_EQ(x,gb2object.getIdeal().getGenerator(0));
     EXPECT_EQ(y,gb2object.getIdeal().getGenerator(1));
 }
+
+TEST(GB_Buchberger, PairStatistics)
+{
+    Variable x = fresh_real_variable("x");
+    Variable y = fresh_real_variable("y");
+    Variable z = fresh_real_variable("z");
+    Variable w = fresh_real_variable("w");
+    using Poly = MultivariatePolynomial<Rational>;
+
+    // cyclic-4
+    BuchbergerStats* stats = BuchbergerStats::getInstance();
+    stats->reset();
+    GBProcedure<Poly, Buchberger, StdAdding> gbobject;
+    gbobject.addPolynomial(Poly({x, y, z, w}));
+    gbobject.addPolynomial(Poly(x) * y + Poly(y) * z + Poly(z) * w + Poly(w) * x);
+    gbobject.addPolynomial(Poly(x) * y * z + Poly(y) * z * w + Poly(z) * w * x + Poly(w) * x * y);
+    gbobject.addPolynomial(Poly(x) * y * z * w - Rational(1));
+    gbobject.reduceInput();
+    gbobject.calculate();
+    EXPECT_EQ(7, gbobject.getIdeal().nrGenerators());
+
+    // Every pair is either pruned by some criterion or reduced.
+    EXPECT_GT(stats->getNrPairsCreated(), 0);
+    EXPECT_GT(stats->getNrPairsPruned(), 0);
+    EXPECT_EQ(stats->getNrPairsCreated(), stats->getNrPairsPruned() + stats->getNrReductions());
+    EXPECT_EQ(stats->getNrReductions(), stats->getNrZeroReductions() + stats->getNrNonZeroReductions());
+    stats->reset();
+    EXPECT_EQ(0, stats->getNrPairsCreated());
+}
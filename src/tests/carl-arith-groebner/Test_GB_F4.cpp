@@ -0,0 +1,154 @@
+#include "gtest/gtest.h"
+#include <carl-arith/groebner/GBProcedure.h>
+
+#include <carl-arith/groebner/Ideal.h>
+#include <carl-arith/groebner/groebner.h>
+#include <carl-arith/poly/umvpoly/functions/Groebner.h>
+
+#include "../Common.h"
+
+
+using namespace carl;
+
+template<typename Coeff>
+using PolynomialWithReasonSet = MultivariatePolynomial<Coeff, GrLexOrdering, StdMultivariatePolynomialPolicies<BVReasons, NoAllocator>>;
+
+namespace {
+	template<typename Polynomial>
+	std::vector<Polynomial> sorted(std::vector<Polynomial> polys) {
+		std::sort(polys.begin(), polys.end());
+		return polys;
+	}
+}
+
+TEST(GB_F4, T1)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+
+	MultivariatePolynomial<Rational> f1({(Rational)1*x*x*x, (Rational)-2*x*y} );
+	MultivariatePolynomial<Rational> f2({(Rational)1*x*x*y, (Rational)-2*y*y, (Rational)1*x});
+	MultivariatePolynomial<Rational> F1({(Rational)1*x*x} );
+	MultivariatePolynomial<Rational> F2({(Rational)1*y*y, (Rational)-1*(Rational)1/(Rational)2*x} );
+	MultivariatePolynomial<Rational> F3({(Rational)1*x*y} );
+	GBProcedure<MultivariatePolynomial<Rational>, F4, StdAdding> gbobject;
+	gbobject.addPolynomial(f1);
+	gbobject.addPolynomial(f2);
+	gbobject.calculate();
+	ASSERT_EQ(3, gbobject.getIdeal().nrGenerators());
+	EXPECT_EQ(F1,gbobject.getIdeal().getGenerator(0));
+	EXPECT_EQ(F3,gbobject.getIdeal().getGenerator(1));
+	EXPECT_EQ(F2,gbobject.getIdeal().getGenerator(2));
+	GBProcedure<MultivariatePolynomial<Rational>, F4, RealRadicalAwareAdding> gb2object;
+	gb2object.addPolynomial(f1);
+	gb2object.addPolynomial(f2);
+	gb2object.calculate();
+	EXPECT_EQ(x,gb2object.getIdeal().getGenerator(0));
+	EXPECT_EQ(y,gb2object.getIdeal().getGenerator(1));
+}
+
+TEST(GB_F4, T1_ReasonSets)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+
+	PolynomialWithReasonSet<Rational> f1({(Rational)1*x*x*x, (Rational)-2*x*y} );
+	f1.setReasons(BitVector(0));
+	PolynomialWithReasonSet<Rational> f2({(Rational)1*x*x*y, (Rational)-2*y*y, (Rational)1*x});
+	f2.setReasons(BitVector(1));
+	PolynomialWithReasonSet<Rational> f3({(Rational)1*x*x*x*x, Term<Rational>(-1)});
+	f3.setReasons(BitVector(2));
+	GBProcedure<PolynomialWithReasonSet<Rational>, F4, StdAdding> gbobject;
+	gbobject.addPolynomial(f1);
+	gbobject.addPolynomial(f2);
+	gbobject.calculate();
+	for (const auto& p: gbobject.getBasisPolynomials()) {
+		EXPECT_FALSE(p.getReasons().empty());
+		EXPECT_FALSE(p.getReasons().getBit(2));
+	}
+	// The basis is {1}, which follows from all three inputs.
+	gbobject.addPolynomial(f3);
+	gbobject.calculate();
+	ASSERT_EQ(1, gbobject.getIdeal().nrGenerators());
+	EXPECT_TRUE(gbobject.getIdeal().getGenerator(0).is_constant());
+	EXPECT_TRUE(gbobject.getIdeal().getGenerator(0).getReasons().getBit(2));
+}
+
+TEST(GB_F4, CompareWithBuchberger)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	Variable z = fresh_real_variable("z");
+	Variable w = fresh_real_variable("w");
+	using Poly = MultivariatePolynomial<Rational>;
+
+	// cyclic-4
+	std::vector<Poly> cyclic4 = {
+		Poly({x, y, z, w}),
+		Poly(x) * y + Poly(y) * z + Poly(z) * w + Poly(w) * x,
+		Poly(x) * y * z + Poly(y) * z * w + Poly(z) * w * x + Poly(w) * x * y,
+		Poly(x) * y * z * w - Rational(1)
+	};
+	// katsura-3
+	std::vector<Poly> katsura3 = {
+		Poly(x) + Rational(2) * y + Rational(2) * z + Rational(2) * w - Rational(1),
+		Poly(x) * x + Rational(2) * y * y + Rational(2) * z * z + Rational(2) * w * w - Poly(x),
+		Rational(2) * x * y + Rational(2) * y * z + Rational(2) * z * w - Poly(y),
+		Poly(y) * y + Rational(2) * x * z + Rational(2) * y * w - Poly(z)
+	};
+	for (const auto& input: { cyclic4, katsura3 }) {
+		GBProcedure<Poly, Buchberger, StdAdding> buchberger;
+		GBProcedure<Poly, F4, StdAdding> f4;
+		for (const auto& p: input) {
+			buchberger.addPolynomial(p);
+			f4.addPolynomial(p);
+		}
+		buchberger.reduceInput();
+		buchberger.calculate();
+		f4.calculate();
+		EXPECT_EQ(sorted(buchberger.getBasisPolynomials()), sorted(f4.getBasisPolynomials()));
+	}
+}
+
+TEST(GB_F4, Incremental)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	Variable z = fresh_real_variable("z");
+	using Poly = MultivariatePolynomial<Rational>;
+
+	GBProcedure<Poly, F4, StdAdding> f4;
+	f4.addPolynomial(Poly(x) * x + Poly(y) * y + Poly(z) * z - Rational(1));
+	f4.addPolynomial(Poly(x) - Poly(y) * z);
+	f4.calculate();
+	GBProcedure<Poly, F4, StdAdding> copy(f4);
+	f4.addPolynomial(Poly(y) - Poly(z) * z);
+	f4.calculate();
+
+	GBProcedure<Poly, Buchberger, StdAdding> buchberger;
+	buchberger.addPolynomial(Poly(x) * x + Poly(y) * y + Poly(z) * z - Rational(1));
+	buchberger.addPolynomial(Poly(x) - Poly(y) * z);
+	buchberger.reduceInput();
+	buchberger.calculate();
+	EXPECT_EQ(sorted(buchberger.getBasisPolynomials()), sorted(copy.getBasisPolynomials()));
+	buchberger.addPolynomial(Poly(y) - Poly(z) * z);
+	buchberger.reduceInput();
+	buchberger.calculate();
+	EXPECT_EQ(sorted(buchberger.getBasisPolynomials()), sorted(f4.getBasisPolynomials()));
+}
+
+TEST(GB_F4, groebner_basis)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	using Poly = MultivariatePolynomial<Rational>;
+
+	Poly f1({(Rational)1*x*x*x, (Rational)-2*x*y});
+	Poly f2({(Rational)1*x*x*y, (Rational)-2*y*y, (Rational)1*x});
+	std::vector<Poly> expected = {
+		Poly({(Rational)1*x*x}),
+		Poly({(Rational)1*x*y}),
+		Poly({(Rational)1*y*y, (Rational)-1*(Rational)1/(Rational)2*x})
+	};
+	EXPECT_EQ(sorted(expected), sorted(carl::groebner_basis(std::vector<Poly>({f1, f2}))));
+}
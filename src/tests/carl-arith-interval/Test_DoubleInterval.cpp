@@ -13,7 +13,10 @@
 #include <carl-arith/interval/Interval.h>
 #include <carl-arith/interval/SetTheory.h>
 #include <carl-arith/core/VariablePool.h>
+#include <cfenv>
+#include <functional>
 #include <iostream>
+#include <random>
 #include <carl-common/meta/platform.h>
 
 #include "../number_types.h"
@@ -1321,3 +1324,60 @@ TEST(DoubleInterval, BloatShrink)
     i4.shrink_by(2);
     EXPECT_EQ(result4, i4);
 }
+
+namespace {
+	/// Computes op with the given rounding mode of the FPU.
+	template<typename Op>
+	double fpu_rounded(int mode, double lhs, double rhs, Op op) {
+		volatile double a = lhs;
+		volatile double b = rhs;
+		int old = std::fegetround();
+		std::fesetround(mode);
+		volatile double res = op(double(a), double(b));
+		std::fesetround(old);
+		return res;
+	}
+}
+
+TEST(DoubleInterval, Rounding)
+{
+	carl::rounding<double> rnd;
+	// exact results are not widened
+	EXPECT_EQ(3.0, rnd.add_down(1.0, 2.0));
+	EXPECT_EQ(3.0, rnd.add_up(1.0, 2.0));
+	EXPECT_EQ(6.0, rnd.mul_down(2.0, 3.0));
+	EXPECT_EQ(0.5, rnd.div_up(1.0, 2.0));
+	EXPECT_EQ(3.0, rnd.sqrt_down(9.0));
+	// inexact results are rounded in the right direction
+	EXPECT_EQ(1.0, rnd.add_down(1.0, 0x1p-60));
+	EXPECT_EQ(std::nextafter(1.0, 2.0), rnd.add_up(1.0, 0x1p-60));
+	EXPECT_EQ(std::nextafter(rnd.div_down(1.0, 3.0), 1.0), rnd.div_up(1.0, 3.0));
+	EXPECT_LT(rnd.sqrt_down(2.0) * rnd.sqrt_down(2.0), 2.0);
+	EXPECT_GT(rnd.sqrt_up(2.0), rnd.sqrt_down(2.0));
+	// overflow
+	double max = std::numeric_limits<double>::max();
+	double inf = std::numeric_limits<double>::infinity();
+	EXPECT_EQ(max, rnd.add_down(max, max));
+	EXPECT_EQ(inf, rnd.add_up(max, max));
+	EXPECT_EQ(-max, rnd.mul_up(max, -2.0));
+	EXPECT_EQ(-inf, rnd.add_down(-inf, 1.0));
+
+	// compare with directed rounding of the FPU
+	std::mt19937 gen(42);
+	std::uniform_real_distribution<double> dist(-1000.0, 1000.0);
+	for (int i = 0; i < 1000; ++i) {
+		double a = dist(gen);
+		double b = dist(gen);
+		EXPECT_EQ(fpu_rounded(FE_DOWNWARD, a, b, std::plus<double>()), rnd.add_down(a, b));
+		EXPECT_EQ(fpu_rounded(FE_UPWARD, a, b, std::plus<double>()), rnd.add_up(a, b));
+		EXPECT_EQ(fpu_rounded(FE_DOWNWARD, a, b, std::minus<double>()), rnd.sub_down(a, b));
+		EXPECT_EQ(fpu_rounded(FE_UPWARD, a, b, std::minus<double>()), rnd.sub_up(a, b));
+		EXPECT_EQ(fpu_rounded(FE_DOWNWARD, a, b, std::multiplies<double>()), rnd.mul_down(a, b));
+		EXPECT_EQ(fpu_rounded(FE_UPWARD, a, b, std::multiplies<double>()), rnd.mul_up(a, b));
+		EXPECT_EQ(fpu_rounded(FE_DOWNWARD, a, b, std::divides<double>()), rnd.div_down(a, b));
+		EXPECT_EQ(fpu_rounded(FE_UPWARD, a, b, std::divides<double>()), rnd.div_up(a, b));
+		double sq = std::abs(a);
+		EXPECT_EQ(fpu_rounded(FE_DOWNWARD, sq, 0, [](double x, double){ return std::sqrt(x); }), rnd.sqrt_down(sq));
+		EXPECT_EQ(fpu_rounded(FE_UPWARD, sq, 0, [](double x, double){ return std::sqrt(x); }), rnd.sqrt_up(sq));
+	}
+}
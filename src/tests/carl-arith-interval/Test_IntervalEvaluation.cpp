@@ -2,6 +2,8 @@
 #include <carl-arith/interval/Interval.h>
 #include <carl-arith/core/VariablePool.h>
 #include <carl-arith/poly/umvpoly/functions/IntervalEvaluation.h>
+#include <carl-arith/poly/umvpoly/functions/IntervalEvaluator.h>
+#include <carl-arith/poly/umvpoly/functions/horner/MultivariateHorner.h>
 #include <carl-common/meta/platform.h>
 
 #include "../Common.h"
@@ -85,3 +87,123 @@ TEST(IntervalEvaluation, Term)
 TEST(IntervalEvaluation, MultivariatePolynomial)
 {
 }
+
+TEST(IntervalEvaluation, Evaluator)
+{
+	Variable a = fresh_real_variable("a");
+	Variable b = fresh_real_variable("b");
+	Variable c = fresh_real_variable("c");
+	Variable d = fresh_real_variable("d");
+	using Poly = MultivariatePolynomial<Rational>;
+	Poly e7({a,c});
+	e7 = carl::pow(e7, 2)*b*d+a;
+	std::vector<Poly> polys = {
+		Poly(),
+		Poly(Rational(3)),
+		Poly(a),
+		Poly({(Rational)1*a,(Rational)1*b,(Rational)-1*c,(Rational)-1*d}),
+		Poly({(Rational)12*a,(Rational)3*b, (Rational)1*c*c,(Rational)-1*d*d*d}),
+		e7,
+		carl::pow(e7, 3) - Rational(1,3)
+	};
+
+	std::map<Variable, Interval<Rational>> map;
+	map[a] = Interval<Rational>(1, 4);
+	map[b] = Interval<Rational>(Rational(2), BoundType::STRICT, Rational(5), BoundType::WEAK);
+	map[c] = Interval<Rational>(-2, 3);
+	map[d] = Interval<Rational>(Rational(0), BoundType::WEAK, Rational(0), BoundType::INFTY);
+	std::map<Variable, Interval<double>> dmap;
+	dmap[a] = Interval<double>(1, 4);
+	dmap[b] = Interval<double>(0.1, BoundType::STRICT, 5.0, BoundType::WEAK);
+	dmap[c] = Interval<double>(-2.3, 3.0);
+	dmap[d] = Interval<double>(0, 2);
+
+	for (const auto& p: polys) {
+		IntervalEvaluator<Rational> evaluator(p);
+		EXPECT_EQ(carl::evaluate(p, map), evaluator.evaluate(map));
+		IntervalEvaluator<double> devaluator(p);
+		EXPECT_EQ(carl::evaluate(p, dmap), devaluator.evaluate(dmap));
+	}
+}
+
+TEST(IntervalEvaluation, EvaluatorSharing)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	Variable z = fresh_real_variable("z");
+	using Poly = MultivariatePolynomial<Rational>;
+	// x^2 and x^2*y are computed only once
+	Poly p = Poly(x) * x * y + Poly(x) * x * y * z + Poly(x) * x * z + Rational(2) * x * x;
+	IntervalEvaluator<Rational> evaluator(p);
+	EXPECT_EQ(3, evaluator.variables().size());
+	std::size_t powers = 0;
+	std::size_t products = 0;
+	for (const auto& ins: evaluator.program()) {
+		if (ins.op == IntervalEvaluator<Rational>::OpCode::Power) powers++;
+		if (ins.op == IntervalEvaluator<Rational>::OpCode::Mul) products++;
+	}
+	EXPECT_EQ(1, powers);
+	EXPECT_EQ(3, products);
+
+	std::vector<std::vector<Interval<Rational>>> inputs;
+	for (int i = -2; i < 3; ++i) {
+		inputs.push_back({ Interval<Rational>(i, i+1), Interval<Rational>(-1, i+2), Interval<Rational>(i) });
+	}
+	auto results = evaluator.evaluate_batch(inputs);
+	ASSERT_EQ(inputs.size(), results.size());
+	for (std::size_t i = 0; i < inputs.size(); ++i) {
+		std::map<Variable, Interval<Rational>> map;
+		for (std::size_t v = 0; v < evaluator.variables().size(); ++v) {
+			map.emplace(evaluator.variables()[v], inputs[i][v]);
+		}
+		EXPECT_EQ(carl::evaluate(p, map), results[i]);
+		EXPECT_EQ(results[i], evaluator.evaluate(inputs[i]));
+	}
+}
+
+TEST(IntervalEvaluation, EvaluatorHorner)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	using Poly = MultivariatePolynomial<double>;
+	Poly p = Poly(x) * x * y + Poly(x) * y * y + Poly(x) * 3.0 - Poly(y) + 1.0;
+	MultivariateHorner<Poly, strategy> horner(p);
+
+	std::map<Variable, Interval<double>> map;
+	map[x] = Interval<double>(-1, 2);
+	map[y] = Interval<double>(0.5, 3.0);
+	IntervalEvaluator<double> evaluator(horner);
+	EXPECT_EQ(carl::evaluate(horner, map), evaluator.evaluate(map));
+}
+
+TEST(IntervalEvaluation, EvaluatorBatch)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	using Poly = MultivariatePolynomial<Rational>;
+	Poly p = Poly(x) * x * x * y + Rational(3) * x * x * x * x - Poly(y) * y * Rational(1, 3) + Poly(x) * y + Rational(1, 7);
+	IntervalEvaluator<double> evaluator(p);
+
+	std::vector<std::vector<Interval<double>>> inputs;
+	// overflow
+	inputs.push_back({ Interval<double>(1e100, 1e101), Interval<double>(1e200, 1e201) });
+	// all sign cases of the powers
+	for (double l: { -3.5, -1.0, 0.0, 0.25 }) {
+		for (double u: { -0.5, 0.0, 1.5 }) {
+			if (l > u) continue;
+			inputs.push_back({ Interval<double>(l, u), Interval<double>(u, 2.0) });
+		}
+	}
+	// inputs that can not be batched
+	inputs.push_back({ Interval<double>(-1.0, BoundType::STRICT, 1.0, BoundType::WEAK), Interval<double>(0.1, 0.2) });
+	inputs.push_back({ Interval<double>(1.0, BoundType::WEAK, 0.0, BoundType::INFTY), Interval<double>(0.1, 0.2) });
+	inputs.push_back({ Interval<double>(0.1, 0.3), Interval<double>(-2.0, 0.0) });
+
+	auto results = evaluator.evaluate_batch(inputs);
+	ASSERT_EQ(inputs.size(), results.size());
+	for (std::size_t i = 0; i < inputs.size(); ++i) {
+		EXPECT_EQ(evaluator.evaluate(inputs[i]), results[i]);
+		EXPECT_EQ(evaluator.evaluate(inputs[i]).lower_bound_type(), results[i].lower_bound_type());
+		EXPECT_EQ(evaluator.evaluate(inputs[i]).upper_bound_type(), results[i].upper_bound_type());
+	}
+}
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include <carl-arith/interval/Interval.h>
+#include <carl-arith/core/VariablePool.h>
+#include <carl-arith/intervalcontraction/Propagation.h>
+#include <carl-common/meta/platform.h>
+
+#include "../number_types.h"
+
+using namespace carl;
+
+using Poly = MultivariatePolynomial<Rational>;
+using Propagation = contractor::Propagation<std::size_t, Poly>;
+
+TEST(Propagation, Fixpoint)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	Variable z = fresh_real_variable("z");
+
+	Propagation p;
+	p.add(0, BasicConstraint<Poly>(Poly(x) + Poly(y) - Rational(4), Relation::EQ));
+	p.add(1, BasicConstraint<Poly>(Poly(y) - Poly(z), Relation::LEQ));
+	p.add(2, BasicConstraint<Poly>(Poly(x) - Poly(z), Relation::NEQ));
+	p.set_domain(x, Interval<double>(0, 10));
+	p.set_domain(y, Interval<double>(0, 10));
+	p.set_domain(z, Interval<double>(-5, 1));
+
+	EXPECT_TRUE(p.propagate());
+	EXPECT_TRUE(p.is_fixpoint());
+	EXPECT_FALSE(p.is_conflict());
+	EXPECT_EQ(p.domain(x), Interval<double>(3, 4));
+	EXPECT_EQ(p.domain(y), Interval<double>(0, 1));
+	EXPECT_EQ(p.domain(z), Interval<double>(0, 1));
+	EXPECT_EQ(p.domains().size(), 3u);
+}
+
+TEST(Propagation, Conflict)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+
+	Propagation p;
+	p.add(0, BasicConstraint<Poly>(Poly(x) - Poly(y), Relation::EQ));
+	p.add(1, BasicConstraint<Poly>(Poly(x) - Rational(1), Relation::GEQ));
+	p.add(2, BasicConstraint<Poly>(Poly(y), Relation::LESS));
+
+	EXPECT_FALSE(p.propagate());
+	EXPECT_TRUE(p.is_conflict());
+	EXPECT_EQ(p.conflict(), 0);
+}
+
+TEST(Propagation, AgreesWithContractor)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	BasicConstraint<Poly> c(Rational(2)*x*y + Poly(y) - Rational(6), Relation::LEQ);
+	std::map<Variable, Interval<double>> map = {
+		{ x, Interval<double>(-1, 10) },
+		{ y, Interval<double>(1, 10) },
+	};
+
+	Propagation p;
+	p.add(0, c);
+	for (const auto& [v, i]: map) {
+		p.set_domain(v, i);
+	}
+	EXPECT_TRUE(p.propagate(1));
+	EXPECT_FALSE(p.is_fixpoint());
+
+	Interval<double> expected = Interval<double>::empty_interval();
+	for (const auto& i: contractor::Contractor<std::size_t, Poly>(0, c, x).contract(map)) {
+		expected = expected.convex_hull(i);
+	}
+	EXPECT_EQ(p.domain(x), expected);
+	EXPECT_EQ(p.domain(x), Interval<double>(-1.0, 2.5));
+}
+
+TEST(Propagation, Newton)
+{
+	Variable x = fresh_real_variable("x");
+
+	// Projecting onto x yields x = sqrt(6 - x), which converges only linearly.
+	Propagation p;
+	p.add(0, BasicConstraint<Poly>(Poly(x)*x + Poly(x) - Rational(6), Relation::EQ));
+	p.set_domain(x, Interval<double>(1, 10));
+
+	EXPECT_TRUE(p.propagate());
+	EXPECT_TRUE(p.domain(x).contains(2.0));
+	EXPECT_LT(p.domain(x).diameter(), 1e-6);
+	EXPECT_LT(p.contractions(), 10);
+}
+
+TEST(Propagation, WeakProjectionRequeued)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+
+	// The projection of the first constraint onto x depends on x itself and can only contract once x is bounded by the second one.
+	Propagation p;
+	p.add(0, BasicConstraint<Poly>(Poly(x)*x + Poly(x)*y - Rational(4), Relation::LEQ));
+	p.add(1, BasicConstraint<Poly>(Poly(x) - Rational(1), Relation::GEQ));
+	p.set_domain(y, Interval<double>(1, 1));
+
+	EXPECT_TRUE(p.propagate());
+	EXPECT_TRUE(p.is_fixpoint());
+	EXPECT_FALSE(p.domain(x).is_unbounded());
+	EXPECT_TRUE(p.domain(x).contains(1.5));
+	EXPECT_LT(p.domain(x).upper(), 2.0);
+}
+
+TEST(Propagation, PointConflict)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+
+	// Point domains are narrower than the minimal width, but the constraint is still checked.
+	Propagation p;
+	p.add(0, BasicConstraint<Poly>(Poly(x) + Poly(y) - Rational(4), Relation::EQ));
+	p.set_domain(x, Interval<double>(1, 1));
+	p.set_domain(y, Interval<double>(1, 1));
+
+	EXPECT_FALSE(p.propagate());
+	EXPECT_TRUE(p.is_conflict());
+	EXPECT_EQ(p.conflict(), 0);
+	EXPECT_GT(p.contractions(), 0);
+}
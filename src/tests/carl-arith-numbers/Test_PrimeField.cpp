@@ -0,0 +1,33 @@
+#include "gtest/gtest.h"
+#include <carl-arith/numbers/PrimeField.h>
+
+using namespace carl;
+
+TEST(PrimeField, arithmetic)
+{
+	for (bool table: {false, true}) {
+		PrimeField f(101, table);
+		EXPECT_EQ(101u, f.p());
+		EXPECT_EQ(0u, f.add(100, 1));
+		EXPECT_EQ(100u, f.sub(0, 1));
+		EXPECT_EQ(100u, f.neg(1));
+		EXPECT_EQ(1u, f.mul(100, 100));
+		EXPECT_EQ(1u, f.pow(3, 100));
+		for (PrimeField::Element a = 1; a < 101; ++a) {
+			EXPECT_EQ(1u, f.mul(a, f.inv(a)));
+		}
+		EXPECT_EQ(100u, f.from_signed(-1));
+		EXPECT_EQ(-1, f.symmetric(100));
+		EXPECT_EQ(50, f.symmetric(50));
+	}
+}
+
+TEST(PrimeField, reduction)
+{
+	PrimeField f(2147483647);
+	std::uint64_t a = 2147483646;
+	EXPECT_EQ(1u, f.mul(static_cast<PrimeField::Element>(a), static_cast<PrimeField::Element>(a)));
+	EXPECT_EQ(static_cast<PrimeField::Element>(~std::uint64_t(0) % 2147483647), f.reduce(~std::uint64_t(0)));
+	EXPECT_EQ(mpz_class(mpz_class("123456789012345678901234567890") % 2147483647).get_ui(), f.reduce(mpz_class("123456789012345678901234567890")));
+	EXPECT_EQ(1u, f.mul(12345, f.inv(12345)));
+}
@@ -263,3 +263,45 @@ TEST(Monomial, CalcLCM)
 	carl::Monomial::Arg m2 = x*x*y;
 	EXPECT_EQ(y, carl::Monomial::calcLcmAndDivideBy(m1, m2));
 }
+
+TEST(Monomial, Packed)
+{
+	std::vector<carl::Variable> vars;
+	for (std::size_t i = 0; i < 5; ++i) {
+		vars.push_back(carl::fresh_real_variable("x" + std::to_string(i)));
+	}
+	// All monomials over five variables with exponents up to two.
+	std::vector<carl::Monomial::Arg> monomials;
+	for (std::size_t code = 1; code < 243; ++code) {
+		carl::Monomial::Content content;
+		for (std::size_t i = 0, c = code; i < vars.size(); ++i, c /= 3) {
+			if (c % 3 > 0) content.emplace_back(vars[i], c % 3);
+		}
+		monomials.push_back(carl::createMonomial(std::move(content)));
+		EXPECT_TRUE(monomials.back()->packed().valid());
+	}
+	for (const auto& m1: monomials) {
+		for (const auto& m2: monomials) {
+			EXPECT_EQ(m1->divisible(m2), m1->divisible_packed(m2));
+			EXPECT_EQ(carl::Monomial::compareLexical(m1, m2), carl::Monomial::compareLexicalPacked(m1, m2));
+			EXPECT_EQ(carl::Monomial::compareGradedLexical(m1, m2), carl::Monomial::compareGradedLexicalPacked(m1, m2));
+			EXPECT_EQ(carl::Monomial::lcm(m1, m2), carl::Monomial::lcm_packed(m1, m2));
+		}
+	}
+
+	// Monomials that can not be packed fall back to the regular implementation.
+	carl::Monomial::Content content;
+	for (std::size_t i = 0; i < carl::PackedExponents::capacity + 1; ++i) {
+		content.emplace_back(carl::fresh_real_variable(), 1);
+	}
+	carl::Monomial::Arg large = carl::createMonomial(std::move(content));
+	carl::Monomial::Arg highdeg = carl::createMonomial(vars[0], carl::PackedExponents::max_exponent + 1);
+	EXPECT_FALSE(large->packed().valid());
+	EXPECT_FALSE(highdeg->packed().valid());
+	for (const auto& m: monomials) {
+		EXPECT_EQ(large->divisible(m), large->divisible_packed(m));
+		EXPECT_EQ(highdeg->divisible(m), highdeg->divisible_packed(m));
+		EXPECT_EQ(carl::Monomial::compareGradedLexical(large, m), carl::Monomial::compareGradedLexicalPacked(large, m));
+		EXPECT_EQ(carl::Monomial::lcm(highdeg, m), carl::Monomial::lcm_packed(highdeg, m));
+	}
+}
@@ -2,6 +2,9 @@
 
 #include <carl-arith/poly/umvpoly/MonomialPool.h>
 
+#include <set>
+#include <thread>
+
 using namespace carl;
 
 TEST(MonomialPool, singleton)
@@ -13,4 +16,87 @@ TEST(MonomialPool, singleton)
 	
 	auto m = createMonomial(x, 3);
 	EXPECT_EQ(pool2.size(), pool1.size());
-}
\ No newline at end of file
+}
+TEST(MonomialPool, sharding)
+{
+	MonomialPool& pool = MonomialPool::getInstance();
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+
+	std::size_t size = pool.size();
+	std::vector<Monomial::Arg> monomials;
+	for (exponent e = 1; e <= 200; ++e) {
+		monomials.emplace_back(pool.create({std::make_pair(x, e), std::make_pair(y, e)}));
+	}
+	EXPECT_EQ(size + 200, pool.size());
+
+	std::set<std::size_t> ids;
+	for (const auto& m: monomials) {
+		EXPECT_NE(0, m->id());
+		EXPECT_LE(m->id(), pool.largestID());
+		ids.insert(m->id());
+	}
+	EXPECT_EQ(200, ids.size());
+
+	// Monomials are unique
+	for (exponent e = 1; e <= 200; ++e) {
+		EXPECT_EQ(monomials[e - 1].get(), pool.create({std::make_pair(y, e), std::make_pair(x, e)}).get());
+	}
+	monomials.clear();
+	EXPECT_EQ(size, pool.size());
+}
+
+#ifdef THREAD_SAFE
+TEST(MonomialPool, concurrent)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	constexpr std::size_t threads = 4;
+	constexpr exponent count = 100;
+
+	std::vector<std::vector<Monomial::Arg>> results(threads);
+	std::vector<std::thread> workers;
+	for (std::size_t t = 0; t < threads; ++t) {
+		workers.emplace_back([&results, t, x, y](){
+			for (std::size_t round = 0; round < 10; ++round) {
+				results[t].clear();
+				for (exponent e = 1; e <= count; ++e) {
+					results[t].emplace_back(MonomialPool::getInstance().create({std::make_pair(x, e), std::make_pair(y, exponent(round % 2 + 1))}));
+				}
+			}
+		});
+	}
+	for (auto& w: workers) w.join();
+	for (std::size_t t = 1; t < threads; ++t) {
+		EXPECT_EQ(results[0], results[t]);
+		for (std::size_t i = 0; i < count; ++i) {
+			EXPECT_EQ(results[0][i].get(), results[t][i].get());
+		}
+	}
+}
+#endif
+
+TEST(MonomialPool, handles)
+{
+	MonomialPool& pool = MonomialPool::getInstance();
+	Variable x = fresh_real_variable("x");
+	EXPECT_EQ(sizeof(void*), sizeof(Monomial::Arg));
+
+	// Linear monomials are immortal
+	std::size_t size = pool.size();
+	const Monomial* linear = createMonomial(x, 1).get();
+	EXPECT_EQ(size + 1, pool.size());
+	EXPECT_EQ(linear, createMonomial(x, 1).get());
+	EXPECT_EQ(size + 1, pool.size());
+
+	// Other monomials are freed with their last handle
+	size = pool.size();
+	{
+		auto m = createMonomial(x, 5);
+		auto copy = m;
+		EXPECT_EQ(m.get(), copy.get());
+		m = nullptr;
+		EXPECT_EQ(size + 1, pool.size());
+	}
+	EXPECT_EQ(size, pool.size());
+}
@@ -53,3 +53,26 @@ TEST(MultivariateGCD, test1)
     P h2({(Rational)1*y});
     EXPECT_EQ( carl::gcd( h1, h2 ), h2 );
 }
+
+TEST(MultivariateGCD, modular)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	Variable z = fresh_real_variable("z");
+	using P = MultivariatePolynomial<Rational>;
+	using PZ = MultivariatePolynomial<mpz_class>;
+
+	P g = P(x)*x*y - Rational(3)*P(z)*z + Rational(2);
+	P a = g * (P(x)*x*y + Rational(5)*P(z) - Rational(7));
+	P b = g * (P(y)*y*z - Rational(2)*P(x) + Rational(1));
+	EXPECT_EQ(g, carl::gcd_detail::gcd_modular(a, b));
+	EXPECT_EQ(g, carl::gcd_detail::gcd_modular(b, a));
+	EXPECT_EQ(P(1), carl::gcd_detail::gcd_modular(P(x)*y + Rational(1), P(x)*z - Rational(1)));
+	EXPECT_EQ(P(x)*y + Rational(1), carl::gcd_detail::gcd_modular(Rational(1,2)*P(x)*y + Rational(1,2), (P(x)*y + Rational(1)) * (P(x)*y + Rational(1))));
+
+	PZ gz = PZ(x)*x*y*y - mpz_class("12345678901234567")*PZ(y)*z + PZ(z)*z*z;
+	PZ az = gz * (PZ(x)*y*z + mpz_class(3)) * mpz_class(4);
+	PZ bz = gz * (PZ(x) - PZ(y)*y + mpz_class(7)) * mpz_class(6);
+	EXPECT_EQ(gz * mpz_class(2), carl::gcd_detail::gcd_modular(az, bz));
+	EXPECT_EQ(PZ(x), carl::gcd_detail::gcd_modular(PZ(x)*y*z, PZ(x)*x + PZ(x)));
+}
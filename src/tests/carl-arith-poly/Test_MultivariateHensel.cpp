@@ -25,3 +25,25 @@ TEST(Diophantine, Constructor)
 	std::cout << result.back() << std::endl;
 }
 */
+
+TEST(Diophantine, EEAlift)
+{
+	Variable x = fresh_real_variable("x");
+	const GaloisField<mpz_class>* gf5 = GaloisFieldManager<mpz_class>::getInstance().field(5);
+	const GaloisField<mpz_class>* gf125 = GaloisFieldManager<mpz_class>::getInstance().field(5, 3);
+	UnivariatePolynomial<mpz_class> A(x, {mpz_class(1), mpz_class(1), mpz_class(0), mpz_class(1)});
+	UnivariatePolynomial<mpz_class> B(x, {mpz_class(3), mpz_class(2), mpz_class(0), mpz_class(1)});
+	auto st = hensel_detail::eea_lift(A.toFiniteDomain(gf125), B.toFiniteDomain(gf125), gf5, gf125);
+	ASSERT_EQ(2, st.size());
+	std::vector<mpz_class> s;
+	for (const auto& c: st[0].coefficients()) s.push_back(c.representing_integer());
+	std::vector<mpz_class> t;
+	for (const auto& c: st[1].coefficients()) t.push_back(c.representing_integer());
+	EXPECT_LT(s.size(), 4);
+	EXPECT_LT(t.size(), 4);
+	auto res = UnivariatePolynomial<mpz_class>(x, s) * A + UnivariatePolynomial<mpz_class>(x, t) * B;
+	for (std::size_t i = 0; i < res.coefficients().size(); ++i) {
+		mpz_class expected = i == 0 ? mpz_class(1) : mpz_class(0);
+		EXPECT_TRUE(carl::is_zero(carl::mod(mpz_class(res.coefficients()[i] - expected), mpz_class(125))));
+	}
+}
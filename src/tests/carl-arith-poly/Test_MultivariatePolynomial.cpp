@@ -588,6 +588,35 @@ TYPED_TEST(MultivariatePolynomialTest, MultivariatePolynomialMultiplication)
             MultivariatePolynomial<TypeParam>({(TypeParam)1*x*y}) * MultivariatePolynomial<TypeParam>({(TypeParam)8*x, Term<TypeParam>(6), (TypeParam)9*y}));
 }
 
+TYPED_TEST(MultivariatePolynomialTest, HeapMultiplication)
+{
+    Variable x = fresh_real_variable("x");
+    Variable y = fresh_real_variable("y");
+    Variable z = fresh_real_variable("z");
+
+    MultivariatePolynomial<TypeParam> p({(TypeParam)1*x, (TypeParam)2*y, (TypeParam)-3*z, Term<TypeParam>(1)});
+    MultivariatePolynomial<TypeParam> q({(TypeParam)1*x*y, (TypeParam)-1*z*z, (TypeParam)5*y, Term<TypeParam>(-2)});
+    for (int i = 0; i < 3; ++i) {
+        // Compare with the sum of the products of all pairs of terms.
+        MultivariatePolynomial<TypeParam> expected;
+        for (const auto& t1: p) {
+            for (const auto& t2: q) {
+                expected += t1 * t2;
+            }
+        }
+        MultivariatePolynomial<TypeParam> res = p * q;
+        EXPECT_TRUE(res.isOrdered());
+        EXPECT_EQ(expected, res);
+        p = res;
+    }
+
+    // Cancellation and multiplication with itself.
+    MultivariatePolynomial<TypeParam> r = MultivariatePolynomial<TypeParam>({(TypeParam)1*x, (TypeParam)1*y}) * MultivariatePolynomial<TypeParam>({(TypeParam)1*x, (TypeParam)-1*y});
+    EXPECT_EQ(MultivariatePolynomial<TypeParam>({(TypeParam)1*x*x, (TypeParam)-1*y*y}), r);
+    r *= r;
+    EXPECT_EQ(MultivariatePolynomial<TypeParam>({(TypeParam)1*x*x*x*x, (TypeParam)-2*x*x*y*y, (TypeParam)1*y*y*y*y}), r);
+}
+
 TYPED_TEST(MultivariatePolynomialTest, CreationViaOperators)
 {
     Variable x = fresh_real_variable("x");
@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+#include <carl-arith/poly/umvpoly/functions/PrimeFieldPolynomial.h>
+
+#include "../Common.h"
+
+using namespace carl;
+
+TEST(PrimeFieldPolynomial, arithmetic)
+{
+	PrimeField f(7);
+	// (x + 1) * (x + 6) = x^2 + 6
+	PrimeFieldPolynomial a = {1, 1};
+	PrimeFieldPolynomial b = {6, 1};
+	PrimeFieldPolynomial ab = primefield::multiply(a, b, f);
+	EXPECT_EQ(PrimeFieldPolynomial({6, 0, 1}), ab);
+	EXPECT_EQ(0u, primefield::evaluate(ab, 1, f));
+	EXPECT_EQ(3u, primefield::evaluate(ab, 2, f));
+	EXPECT_EQ(PrimeFieldPolynomial({0, 2}), primefield::add(a, b, f));
+	EXPECT_EQ(PrimeFieldPolynomial({2}), primefield::subtract(a, b, f));
+
+	PrimeFieldPolynomial r = {2, 3, 0, 1};
+	PrimeFieldPolynomial q = primefield::divide_inplace(r, ab, f);
+	EXPECT_EQ(PrimeFieldPolynomial({0, 1}), q);
+	EXPECT_EQ(PrimeFieldPolynomial({2, 4}), r);
+}
+
+TEST(PrimeFieldPolynomial, resultant)
+{
+	PrimeField f(2147483647);
+	// res(x - 2, x^3) = 2^3 and res(x^3, x - 2) = (-1)^3 * 2^3
+	PrimeFieldPolynomial a = {f.neg(2), 1};
+	PrimeFieldPolynomial b = {0, 0, 0, 1};
+	EXPECT_EQ(8u, primefield::resultant(a, b, f));
+	EXPECT_EQ(f.neg(8), primefield::resultant(b, a, f));
+	// res(2x^2 + 3, 5) = 5^2
+	EXPECT_EQ(25u, primefield::resultant({3, 0, 2}, {5}, f));
+	EXPECT_EQ(0u, primefield::resultant(primefield::multiply(a, {1, 1}, f), primefield::multiply(a, {4, 0, 1}, f), f));
+}
+
+TEST(PrimeFieldPolynomial, gcd)
+{
+	PrimeField f(2147483647);
+	PrimeFieldPolynomial g = {5, 0, 3};
+	PrimeFieldPolynomial a = primefield::multiply(g, {1, 2, 3, 4}, f);
+	PrimeFieldPolynomial b = primefield::multiply(g, {7, 0, 1}, f);
+	PrimeFieldPolynomial monic = g;
+	primefield::make_monic(monic, f);
+	EXPECT_EQ(monic, primefield::gcd(a, b, f));
+
+	PrimeFieldPolynomial s;
+	PrimeFieldPolynomial t;
+	EXPECT_EQ(monic, primefield::extended_gcd(a, b, s, t, f));
+	EXPECT_EQ(monic, primefield::add(primefield::multiply(s, a, f), primefield::multiply(t, b, f), f));
+}
+
+TEST(PrimeFieldPolynomial, conversion)
+{
+	Variable x = fresh_real_variable("x");
+	PrimeField f(11);
+	UnivariatePolynomial<mpz_class> p(x, {mpz_class(-3), mpz_class(0), mpz_class(25)});
+	PrimeFieldPolynomial pf = primefield::from_univariate(p, f);
+	EXPECT_EQ(PrimeFieldPolynomial({8, 0, 3}), pf);
+	EXPECT_EQ(UnivariatePolynomial<mpz_class>(x, {mpz_class(-3), mpz_class(0), mpz_class(3)}), primefield::to_univariate<mpz_class>(x, pf, f));
+}
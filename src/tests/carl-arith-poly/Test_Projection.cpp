@@ -0,0 +1,27 @@
+#include <gtest/gtest.h>
+
+#include <carl-arith/poly/umvpoly/functions/Projection.h>
+#include <carl-arith/core/VariablePool.h>
+
+#include "../Common.h"
+
+using namespace carl;
+
+TEST(Projection, Basic)
+{
+	using Poly = MultivariatePolynomial<Rational>;
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	Poly p1 = Poly(x) * x + Poly(y) * y + Rational(1);
+	Poly p2 = Poly(x) - Poly(y);
+	Poly p3 = Poly(y) - Rational(2);
+	Poly p4 = Rational(1, 2) * p1;
+
+	// y - 2 is passed on, y^2 + 1 is both a coefficient and the discriminant of p1, y is a coefficient of p2 and 2y^2 + 1 is their resultant.
+	std::vector<Poly> expected = { p3, Poly(y) * y + Rational(1), Poly(y), Rational(2) * Poly(y) * y + Rational(1) };
+	EXPECT_EQ(expected, projection(std::vector<Poly>({p1, p2, p3}), x));
+	EXPECT_EQ(expected, projection(std::vector<Poly>({p1, p2, p3}), x, 4));
+	EXPECT_EQ(expected, projection(std::vector<Poly>({p1, p2, p3}), x, 1, SubresultantStrategy::Modular));
+	// The resultant of p1 and p4 is zero.
+	EXPECT_EQ(expected, projection(std::vector<Poly>({p1, p2, p3, p4}), x, 4));
+}
@@ -1,7 +1,9 @@
 #include <gtest/gtest.h>
 
 
+#include <carl-arith/poly/umvpoly/functions/Memoization.h>
 #include <carl-arith/poly/umvpoly/functions/Resultant.h>
+#include <carl-arith/poly/umvpoly/functions/RootCounting.h>
 #include <carl-arith/poly/umvpoly/UnivariatePolynomial.h>
 #include <carl-arith/core/VariablePool.h>
 #include <carl-common/meta/platform.h>
@@ -42,3 +44,63 @@ TEST(Resultant, det)
     //EXPECT_EQ(r3, r1);
     //EXPECT_EQ(r3, r2);
 }
+
+TEST(Resultant, Memoization)
+{
+	using Poly = MultivariatePolynomial<Rational>;
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	UnivariatePolynomial<Poly> p(x, {Poly(y) * Poly(y) - Rational(2), Poly(0), Poly(1)});
+	UnivariatePolynomial<Poly> q(x, {Poly(1), Poly(3) * Poly(y), Poly(0), Poly(1)});
+
+	memoization::clear<Poly>();
+	auto& cache = memoization::resultant_cache<Poly>();
+	std::size_t hits = cache.hits();
+	EXPECT_EQ(carl::resultant(p, q), carl::cached_resultant(p, q));
+	EXPECT_EQ(carl::resultant(p, q), carl::cached_resultant(p, q));
+	EXPECT_EQ(hits + 1, cache.hits());
+	// Both the key and the result are accounted for.
+	memoization::PolynomialPair<Poly> key{ p, q, SubresultantStrategy::Default };
+	EXPECT_EQ(memoization::size(key) + memoization::size(carl::resultant(p, q)), cache.size());
+	// The strategy is part of the key.
+	EXPECT_EQ(carl::resultant(p, q, SubresultantStrategy::Generic), carl::cached_resultant(p, q, SubresultantStrategy::Generic));
+	EXPECT_EQ(hits + 1, cache.hits());
+
+	EXPECT_EQ(carl::discriminant(q), carl::cached_discriminant(q));
+	std::size_t subresHits = memoization::subresultants_cache<Poly>().hits();
+	EXPECT_EQ(carl::principalSubresultantsCoefficients(p, q), carl::cached_principalSubresultantsCoefficients(p, q));
+	EXPECT_EQ(carl::subresultants(p, q), *carl::cached_subresultants(p, q));
+	EXPECT_EQ(subresHits + 1, memoization::subresultants_cache<Poly>().hits());
+}
+
+TEST(Resultant, MemoizedSturmSequence)
+{
+	Variable x = fresh_real_variable("x");
+	UnivariatePolynomial<Rational> p(x, {Rational(1), Rational(-3), Rational(0), Rational(1)});
+	auto s1 = carl::cached_sturm_sequence(p);
+	auto s2 = carl::cached_sturm_sequence(p);
+	EXPECT_EQ(carl::sturm_sequence(p), *s1);
+	EXPECT_EQ(s1, s2);
+	EXPECT_EQ(3, carl::count_real_roots(p, Interval<Rational>(Rational(-10), Rational(10))));
+}
+
+TEST(Resultant, Modular)
+{
+	using Poly = MultivariatePolynomial<Rational>;
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	Variable z = fresh_real_variable("z");
+	UnivariatePolynomial<Poly> p(x, {Poly(y) * z - Rational(1, 2), Poly(z) * Rational(3), Poly(y) * y + Poly(z)});
+	UnivariatePolynomial<Poly> q(x, {Poly(1), Poly(y) - Poly(z) * z, Poly(0), Rational(2, 3) * Poly(y)});
+	UnivariatePolynomial<Poly> r(x, {Poly(y), Poly(-1)});
+
+	EXPECT_EQ(carl::resultant(p, q), carl::resultant(p, q, SubresultantStrategy::Modular));
+	EXPECT_EQ(carl::resultant(q, p), carl::resultant(q, p, SubresultantStrategy::Modular));
+	EXPECT_EQ(carl::resultant(r, q), carl::resultant(r, q, SubresultantStrategy::Modular));
+	EXPECT_EQ(carl::discriminant(p * q), carl::discriminant(p * q, SubresultantStrategy::Modular));
+	// Polynomials with a common factor.
+	EXPECT_TRUE(carl::is_zero(carl::resultant(p * r, q * r, SubresultantStrategy::Modular)));
+	// Constant polynomials are handled like for the other strategies.
+	UnivariatePolynomial<Poly> c(x, Poly(y) + Rational(1));
+	EXPECT_EQ(carl::resultant(p, c), carl::resultant(p, c, SubresultantStrategy::Modular));
+}
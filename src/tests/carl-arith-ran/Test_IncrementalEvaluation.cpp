@@ -0,0 +1,101 @@
+#include "gtest/gtest.h"
+
+#include <carl-arith/constraint/IncrementalEvaluation.h>
+
+#include "../Common.h"
+
+using namespace carl;
+
+using Pol = MultivariatePolynomial<Rational>;
+using RAN = IntRepRealAlgebraicNumber<Rational>;
+
+namespace {
+bool consistent(const IncrementalConstraintEvaluation<Pol>& eval) {
+	for (std::size_t id = 0; id < eval.size(); ++id) {
+		if (boost::indeterminate(eval.value(id))) continue;
+		if (bool(eval.value(id)) != bool(carl::evaluate(eval.constraint(id), eval.assignment()))) return false;
+	}
+	return true;
+}
+}
+
+TEST(IncrementalEvaluation, PushPop)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	RAN sqrt2 = RAN::create_safe(UnivariatePolynomial<Rational>(x, {Rational(-2), Rational(0), Rational(1)}), Interval<Rational>(Rational(1), BoundType::STRICT, Rational(2), BoundType::STRICT));
+
+	IncrementalConstraintEvaluation<Pol> eval;
+	auto c0 = eval.add(BasicConstraint<Pol>(Pol(x) * y, Relation::GREATER));
+	auto c1 = eval.add(BasicConstraint<Pol>(Pol(y) - x, Relation::EQ));
+	auto c2 = eval.add(BasicConstraint<Pol>(Pol(x) - Rational(2), Relation::LEQ));
+	auto c3 = eval.add(BasicConstraint<Pol>(Pol(Rational(1)), Relation::GREATER));
+	EXPECT_TRUE(bool(eval.value(c3)));
+	EXPECT_TRUE(boost::indeterminate(eval.value(c0)));
+
+	// x*y > 0 becomes evaluable before y is assigned.
+	auto changed = eval.push(x, RAN(0));
+	EXPECT_EQ(std::set<std::size_t>(changed.begin(), changed.end()), std::set<std::size_t>({c0, c2}));
+	EXPECT_FALSE(bool(eval.value(c0)));
+	EXPECT_TRUE(bool(eval.value(c2)));
+	EXPECT_TRUE(boost::indeterminate(eval.value(c1)));
+	EXPECT_EQ(eval.lhs(c1), Pol(y));
+
+	changed = eval.push(y, sqrt2);
+	EXPECT_EQ(changed, std::vector<std::size_t>({c1}));
+	EXPECT_FALSE(bool(eval.value(c1)));
+	EXPECT_TRUE(consistent(eval));
+
+	// Changing the value of x flips x*y > 0.
+	changed = eval.push(x, RAN(1));
+	EXPECT_EQ(changed, std::vector<std::size_t>({c0}));
+	EXPECT_TRUE(bool(eval.value(c0)));
+	EXPECT_TRUE(consistent(eval));
+
+	eval.pop();
+	EXPECT_FALSE(bool(eval.value(c0)));
+	EXPECT_TRUE(consistent(eval));
+	eval.pop();
+	EXPECT_TRUE(boost::indeterminate(eval.value(c1)));
+	eval.pop();
+	EXPECT_EQ(eval.depth(), 0);
+	EXPECT_TRUE(boost::indeterminate(eval.value(c0)));
+	EXPECT_TRUE(boost::indeterminate(eval.value(c2)));
+	EXPECT_EQ(eval.lhs(c1), Pol(y) - x);
+
+	// Assign in the other order.
+	changed = eval.push(y, sqrt2);
+	EXPECT_TRUE(changed.empty());
+	changed = eval.push(x, sqrt2);
+	EXPECT_EQ(std::set<std::size_t>(changed.begin(), changed.end()), std::set<std::size_t>({c0, c1, c2}));
+	EXPECT_TRUE(bool(eval.value(c0)));
+	EXPECT_TRUE(bool(eval.value(c1)));
+	EXPECT_TRUE(bool(eval.value(c2)));
+	EXPECT_TRUE(consistent(eval));
+}
+
+TEST(IncrementalEvaluation, RestoreWatch)
+{
+	Variable x = fresh_real_variable("x");
+	Variable w = fresh_real_variable("w");
+	Variable z = fresh_real_variable("z");
+
+	IncrementalConstraintEvaluation<Pol> eval;
+	auto c = eval.add(BasicConstraint<Pol>((Pol(x) - Rational(1)) * w + z, Relation::GREATER));
+
+	eval.push(x, RAN(1));
+	eval.push(z, RAN(5));
+	EXPECT_TRUE(bool(eval.value(c)));
+	// Reassigning x makes the constraint watch w, which does not occur in the left-hand side after the first pop().
+	eval.push(x, RAN(2));
+	EXPECT_TRUE(boost::indeterminate(eval.value(c)));
+	eval.pop();
+	EXPECT_TRUE(bool(eval.value(c)));
+	eval.pop();
+	EXPECT_TRUE(boost::indeterminate(eval.value(c)));
+
+	auto changed = eval.push(z, RAN(5));
+	EXPECT_EQ(changed, std::vector<std::size_t>({c}));
+	EXPECT_TRUE(bool(eval.value(c)));
+	EXPECT_TRUE(consistent(eval));
+}
@@ -123,4 +123,69 @@ TEST_F(LazardTest, Proper3) {
 	EXPECT_EQ(-Poly(z), le.getLiftingPoly());
 }
 
+TEST_F(LazardTest, SharedTower) {
+	auto ax = getRAN({-2, 0, 1}, 1, 2);
+	auto ay1 = getRAN({-2, 0, 1}, 1, 2);
+	auto ay2 = getRAN({-2, 0, 1}, -2, -1);
+	auto q = (Poly(x)-y)*z;
+
+	carl::ran::interval::LazardEvaluation<Rational,Poly> parent(q);
+	parent.substitute(x, ax);
+	auto le1 = parent;
+	auto le2 = parent;
+	le1.substitute(y, ay1);
+	le2.substitute(y, ay2);
+	EXPECT_EQ(-Poly(z), le1.getLiftingPoly());
+	EXPECT_EQ(le1.tower()->parent(), le2.tower()->parent());
+	EXPECT_NE(le1.tower(), le2.tower());
+
+	// sibling cells reuse the extensions of their prefix
+	carl::ran::interval::LazardEvaluation<Rational,Poly> le3(q, parent.tower());
+	le3.substitute(y, ay1);
+	EXPECT_EQ(le1.tower(), le3.tower());
+	EXPECT_EQ(le1.getLiftingPoly(), le3.getLiftingPoly());
+}
+
 #endif
+
+TEST(ExtensionTower, Ownership)
+{
+	using Poly = carl::MultivariatePolynomial<Rational>;
+	using Tower = carl::ran::interval::ExtensionTower<Rational,Poly>;
+	carl::Variable x = carl::fresh_real_variable("x");
+	carl::Variable y = carl::fresh_real_variable("y");
+	carl::Variable z = carl::fresh_real_variable("z");
+
+	auto root = Tower::root();
+	auto tx = root->extend(x, carl::IntRepRealAlgebraicNumber<Rational>(Rational(1)));
+	EXPECT_EQ(tx, root->extend(x, carl::IntRepRealAlgebraicNumber<Rational>(Rational(1))));
+	auto txy = tx->extend(y, carl::IntRepRealAlgebraicNumber<Rational>(Rational(2)));
+	EXPECT_EQ(txy->parent(), tx);
+	EXPECT_EQ(txy->level(), 2u);
+	EXPECT_EQ(txy->reduce_from_root(Poly(x)*y + z, false), Poly(z) + Rational(2));
+
+	// Levels own their parents, but not their children.
+	std::weak_ptr<const Tower> weakRoot = root;
+	std::weak_ptr<const Tower> weakChild = tx;
+	root.reset();
+	tx.reset();
+	EXPECT_FALSE(weakRoot.expired());
+	txy.reset();
+	EXPECT_TRUE(weakRoot.expired());
+	EXPECT_TRUE(weakChild.expired());
+}
+
+TEST(FieldExtensions, Embed)
+{
+	using Poly = carl::MultivariatePolynomial<Rational>;
+	carl::Variable a = carl::fresh_real_variable("a");
+	carl::Variable b = carl::fresh_real_variable("b");
+
+	// a = sqrt(2), b = sqrt(a^3): the leading term of b^2 - a^3 is a^3, so the reduction has to be done in b.
+	std::vector<std::pair<carl::Variable,Poly>> mp = {
+		{ a, Poly(a)*a - Rational(2) },
+		{ b, Poly(b)*b - Poly(a)*a*a }
+	};
+	EXPECT_TRUE(carl::is_zero(carl::ran::interval::detail_field_extensions::embed(Poly(b)*b - Rational(2)*a, mp)));
+	EXPECT_EQ(carl::ran::interval::detail_field_extensions::embed(Poly(b)*b*b, mp), Rational(2)*Poly(a)*b);
+}
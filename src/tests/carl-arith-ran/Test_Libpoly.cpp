@@ -11,6 +11,8 @@
 #include <carl-arith/ran/ran.h>
 
 #include <carl-arith/ran/Conversion.h>
+#include <carl-arith/ran/libpoly/LPAssignment.h>
+#include <carl-arith/constraint/IncrementalEvaluation.h>
 
 using namespace carl;
 
@@ -94,4 +96,94 @@ TEST(LIBPOLY, convertRan) {
     }
 }
 
+TEST(LIBPOLY, incrementalAssignment) {
+    Variable x = fresh_real_variable("x");
+    Variable y = fresh_real_variable("y");
+    std::vector<Variable> var_order = {x, y};
+    LPContext context(var_order);
+
+    LPPolynomial polyX(context, x);
+    LPPolynomial polyY(context, y);
+    LPPolynomial two(context, 2l);
+    std::vector<BasicConstraint<LPPolynomial>> constraints = {
+        BasicConstraint<LPPolynomial>(polyX * polyY - two, Relation::GREATER),
+        BasicConstraint<LPPolynomial>(polyY - polyX, Relation::EQ),
+        BasicConstraint<LPPolynomial>(polyX - two, Relation::LEQ)
+    };
+
+    LPAssignment& assignment = LPAssignment::getInstance();
+    std::size_t version = assignment.version();
+    assignment.push(x, LPRealAlgebraicNumber(mpq_class(2)));
+    EXPECT_EQ(1, assignment.depth());
+    EXPECT_NE(version, assignment.version());
+    EXPECT_TRUE((bool)evaluate(constraints[2], assignment.assignment()));
+
+    assignment.push(y, LPRealAlgebraicNumber(mpq_class(2)));
+    auto res = evaluate(constraints, assignment.assignment());
+    ASSERT_EQ(3, res.size());
+    EXPECT_TRUE((bool)res[0]);
+    EXPECT_TRUE((bool)res[1]);
+    EXPECT_TRUE((bool)res[2]);
+
+    // Replace the value of y, the previous value is restored by pop().
+    assignment.push(y, LPRealAlgebraicNumber(mpq_class(1, 2)));
+    res = evaluate(constraints, assignment.assignment());
+    EXPECT_FALSE((bool)res[0]);
+    EXPECT_FALSE((bool)res[1]);
+    assignment.pop();
+    EXPECT_TRUE((bool)evaluate(constraints[1], assignment.assignment()));
+    assignment.pop();
+    assignment.pop();
+    EXPECT_EQ(0, assignment.depth());
+    EXPECT_TRUE(assignment.assignment().empty());
+
+    // Setting a whole assignment gives the same results.
+    std::map<Variable, LPRealAlgebraicNumber> eval;
+    eval.emplace(x, LPRealAlgebraicNumber(mpq_class(3)));
+    eval.emplace(y, LPRealAlgebraicNumber(mpq_class(3)));
+    res = evaluate(constraints, eval);
+    EXPECT_TRUE((bool)res[0]);
+    EXPECT_TRUE((bool)res[1]);
+    EXPECT_FALSE((bool)res[2]);
+    version = assignment.version();
+    evaluate(constraints, eval);
+    EXPECT_EQ(version, assignment.version());
+}
+
+
+TEST(LIBPOLY, incrementalConstraintEvaluation) {
+    Variable x = fresh_real_variable("x");
+    Variable y = fresh_real_variable("y");
+    std::vector<Variable> var_order = {x, y};
+    LPContext context(var_order);
+
+    LPPolynomial polyX(context, x);
+    LPPolynomial polyY(context, y);
+    LPPolynomial two(context, 2l);
+
+    IncrementalConstraintEvaluation<LPPolynomial> eval;
+    auto c0 = eval.add(BasicConstraint<LPPolynomial>(polyX * polyY - two, Relation::GREATER));
+    auto c1 = eval.add(BasicConstraint<LPPolynomial>(polyX - two, Relation::LEQ));
+
+    auto changed = eval.push(x, LPRealAlgebraicNumber(mpq_class(2)));
+    EXPECT_EQ(changed, std::vector<std::size_t>({c1}));
+    EXPECT_TRUE((bool)eval.value(c1));
+    EXPECT_TRUE(boost::indeterminate(eval.value(c0)));
+
+    changed = eval.push(y, LPRealAlgebraicNumber(mpq_class(2)));
+    EXPECT_EQ(changed, std::vector<std::size_t>({c0}));
+    EXPECT_TRUE((bool)eval.value(c0));
+
+    changed = eval.push(y, LPRealAlgebraicNumber(mpq_class(1, 2)));
+    EXPECT_EQ(changed, std::vector<std::size_t>({c0}));
+    EXPECT_FALSE((bool)eval.value(c0));
+
+    eval.pop();
+    EXPECT_TRUE((bool)eval.value(c0));
+    eval.pop();
+    eval.pop();
+    EXPECT_TRUE(boost::indeterminate(eval.value(c0)));
+    EXPECT_TRUE(boost::indeterminate(eval.value(c1)));
+}
+
 #endif
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "gtest/gtest.h"
 #include <map>
+#include <thread>
 
 #include <carl-arith/poly/umvpoly/UnivariatePolynomial.h>
 #include <carl-arith/ran/ran.h>
@@ -99,6 +100,95 @@ TEST(RealAlgebraicNumber, EvalBug2)
 	EXPECT_TRUE((bool) res);
 }
 
+TEST(RealAlgebraicNumber, RefineToPrecision)
+{
+	Variable h = fresh_real_variable("h");
+	// sqrt(2) and a root of x^5 - x - 1
+	std::vector<std::pair<UnivariatePolynomial<Rational>, Interval<Rational>>> inputs = {
+		{ UnivariatePolynomial<Rational>(h, std::initializer_list<Rational>{-2, 0, 1}), Interval<Rational>(Rational(1), BoundType::STRICT, Rational(2), BoundType::STRICT) },
+		{ UnivariatePolynomial<Rational>(h, std::initializer_list<Rational>{-1, -1, 0, 0, 0, 1}), Interval<Rational>(Rational(1), BoundType::STRICT, Rational(2), BoundType::STRICT) },
+	};
+	for (const auto& [p, i]: inputs) {
+		auto ran = IntRepRealAlgebraicNumber<Rational>::create_safe(p, i);
+		ran.refine_to_precision(100);
+		ASSERT_FALSE(ran.is_numeric());
+		EXPECT_TRUE(ran.interval().diameter() <= Rational(1) / carl::pow(Rational(2), 100));
+		EXPECT_TRUE(carl::sgn(carl::evaluate(p, ran.interval().lower())) != carl::sgn(carl::evaluate(p, ran.interval().upper())));
+		ran.refine();
+		EXPECT_TRUE(carl::sgn(carl::evaluate(p, ran.interval().lower())) != carl::sgn(carl::evaluate(p, ran.interval().upper())));
+	}
+}
 
+TEST(RealAlgebraicNumber, SharedRefinement)
+{
+	Variable h = fresh_real_variable("h");
+	UnivariatePolynomial<Rational> p(h, std::initializer_list<Rational>{-2, 0, 1});
+	auto a = IntRepRealAlgebraicNumber<Rational>::create_safe(p, Interval<Rational>(Rational(1), BoundType::STRICT, Rational(2), BoundType::STRICT));
+	auto b = a;
+	b.refine_to_precision(50);
+	// a reads the interval published by b
+	EXPECT_EQ(a.interval(), b.interval());
+	EXPECT_TRUE(a.interval().diameter() <= Rational(1) / carl::pow(Rational(2), 50));
+	EXPECT_EQ(a.refine_using(Rational(3, 2)), std::nullopt);
+
+#ifdef THREAD_SAFE
+	auto c = IntRepRealAlgebraicNumber<Rational>::create_safe(p, Interval<Rational>(Rational(1), BoundType::STRICT, Rational(2), BoundType::STRICT));
+	std::vector<std::thread> threads;
+	for (int t = 0; t < 4; ++t) {
+		threads.emplace_back([&c, &p, t]() {
+			auto last = c.interval_int();
+			for (int i = 0; i < 3; ++i) {
+				c.refine();
+				c.refine_using(Rational(141421, 100000) + Rational(t, 10000000));
+				auto cur = c.interval_int();
+				EXPECT_TRUE(last.contains(cur));
+				EXPECT_NE(carl::sgn(carl::evaluate(p, cur.lower())), carl::sgn(carl::evaluate(p, cur.upper())));
+				last = cur;
+			}
+		});
+	}
+	for (auto& t: threads) t.join();
+	EXPECT_TRUE(c.interval().diameter() <= Rational(1) / carl::pow(Rational(2), 50));
+#endif
+}
 
-
+TEST(RealAlgebraicNumber, AlgebraicSubstitutionCache)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	MultivariatePolynomial<Rational> mpx(x);
+	MultivariatePolynomial<Rational> mpy(y);
+	Variable h = fresh_real_variable("h");
+	UnivariatePolynomial<Rational> px(h, std::initializer_list<Rational>{-2, 0, 1});
+	UnivariatePolynomial<Rational> py(h, std::initializer_list<Rational>{-3, 0, 1});
+	UnivariatePolynomial<Rational> py2(h, std::initializer_list<Rational>{-5, 0, 1});
+
+	ran::interval::AlgebraicSubstitutionCache<Rational> cache;
+	cache.set_defining_polynomial(x, px);
+	cache.set_defining_polynomial(y, py);
+	MultivariatePolynomial<Rational> p = mpx * mpy - Rational(2);
+	auto direct = ran::interval::algebraic_substitution(
+		UnivariatePolynomial<MultivariatePolynomial<Rational>>(cache.aux_variable(), {MultivariatePolynomial<Rational>(-p), MultivariatePolynomial<Rational>(1)}),
+		{ replace_main_variable(px, x).convert<MultivariatePolynomial<Rational>>(), replace_main_variable(py, y).convert<MultivariatePolynomial<Rational>>() }
+	);
+	auto res = cache.substitute(p, {x, y});
+	ASSERT_TRUE(res && direct);
+	EXPECT_EQ(*direct, *res);
+	EXPECT_EQ(*res, *cache.substitute(p, {x, y}));
+
+	// (v + 2)^2 = 6 for v = x*y - 2, and (v + 2)^2 = 10 after changing the defining polynomial of y
+	cache.set_defining_polynomial(y, py2);
+	res = cache.substitute(p, {x, y});
+	ASSERT_TRUE(res);
+	UnivariatePolynomial<Rational> expected(cache.aux_variable(), std::initializer_list<Rational>{-6, 4, 1});
+	EXPECT_EQ(expected.normalized(), res->normalized());
+
+	// evaluating constraints at a sample point
+	Assignment<IntRepRealAlgebraicNumber<Rational>> m;
+	m.emplace(x, IntRepRealAlgebraicNumber<Rational>::create_safe(px, Interval<Rational>(Rational(1), BoundType::STRICT, Rational(2), BoundType::STRICT)));
+	m.emplace(y, IntRepRealAlgebraicNumber<Rational>::create_safe(py, Interval<Rational>(Rational(1), BoundType::STRICT, Rational(2), BoundType::STRICT)));
+	MultivariatePolynomial<Rational> q = mpx * mpx * mpy * mpy - Rational(6);
+	EXPECT_TRUE((bool)carl::evaluate(BasicConstraint<MultivariatePolynomial<Rational>>(q, Relation::EQ), m));
+	EXPECT_FALSE((bool)carl::evaluate(BasicConstraint<MultivariatePolynomial<Rational>>(q, Relation::LESS), m));
+	EXPECT_TRUE((bool)carl::evaluate(BasicConstraint<MultivariatePolynomial<Rational>>(q, Relation::GEQ), m));
+}
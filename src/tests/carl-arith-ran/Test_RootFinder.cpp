@@ -106,6 +106,54 @@ TEST(RootFinder, Chebyshev)
 	}
 }
 
+TEST(RootFinder, VCA)
+{
+	carl::Variable x = fresh_real_variable("x");
+	{
+		// Divide and conquer Taylor shift agrees with the classical one
+		carl::Chebyshev<Rational> chebyshev(x);
+		auto p = chebyshev(100).coprime_coefficients();
+		auto expected = carl::detail_sign_variations::shift(p, mpz_class(1));
+		std::vector<mpz_class> coeffs = p.coefficients();
+		carl::detail_sign_variations::shift_by_one(coeffs);
+		EXPECT_EQ(expected.coefficients(), coeffs);
+	}
+	std::vector<UPolynomial> polys = {
+		UPolynomial(x, {Rational(-2), Rational(0), Rational(1)}) * UPolynomial(x, {Rational(-1), Rational(2)}) * UPolynomial(x, {Rational(3), Rational(1)}) * UPolynomial(x, {Rational(-1), Rational(1)}),
+		UPolynomial(x, {Rational(1), Rational(0), Rational(0), Rational(-3), Rational(0), Rational(1)}),
+		UPolynomial(x, {Rational(0), Rational(-1), Rational(0), Rational(0), Rational(1)}),
+		carl::Chebyshev<Rational>(x)(20),
+		carl::Chebyshev<Rational>(x)(80),
+	};
+	for (const auto& p: polys) {
+		auto expected = carl::real_roots(p, carl::Interval<Rational>::unbounded_interval(), carl::RealRootIsolationStrategy::Bisection).roots();
+		auto roots = carl::real_roots(p, carl::Interval<Rational>::unbounded_interval(), carl::RealRootIsolationStrategy::VCA).roots();
+		EXPECT_EQ(expected, roots);
+	}
+	{
+		auto p = polys.front();
+		carl::Interval<Rational> i(Rational(-1), carl::BoundType::STRICT, Rational(1), carl::BoundType::WEAK);
+		auto roots = carl::real_roots(p, i, carl::RealRootIsolationStrategy::VCA).roots();
+		EXPECT_EQ(2, roots.size());
+		EXPECT_TRUE(represents(roots.back(), Rational(1)));
+	}
+}
+
+TEST(RootFinder, Parallel)
+{
+	carl::Variable x = fresh_real_variable("x");
+	std::vector<UPolynomial> polys = {
+		UPolynomial(x, {Rational(-2), Rational(0), Rational(1)}) * UPolynomial(x, {Rational(-1), Rational(2)}) * UPolynomial(x, {Rational(3), Rational(1)}) * UPolynomial(x, {Rational(-1), Rational(1)}),
+		UPolynomial(x, {Rational(1), Rational(0), Rational(0), Rational(-3), Rational(0), Rational(1)}),
+		carl::Chebyshev<Rational>(x)(30),
+	};
+	for (const auto& p: polys) {
+		auto expected = carl::real_roots(p).roots();
+		auto roots = carl::real_roots(p, carl::Interval<Rational>::unbounded_interval(), carl::RealRootIsolationStrategy::Bisection, 4).roots();
+		EXPECT_EQ(expected, roots);
+	}
+}
+
 using Poly = carl::UnivariatePolynomial<mpq_class>;
 TEST(RootFinder, Comparison)
 {
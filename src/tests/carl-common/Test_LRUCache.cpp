@@ -0,0 +1,65 @@
+#include <carl-common/datastructures/LRUCache.h>
+#include <gtest/gtest.h>
+
+#include <string>
+
+TEST(LRUCache, Basics)
+{
+	carl::LRUCache<int, std::string> cache(3);
+	EXPECT_FALSE(cache.get(1));
+	cache.put(1, "one");
+	cache.put(2, "two");
+	ASSERT_TRUE(cache.get(1));
+	EXPECT_EQ("one", *cache.get(1));
+	EXPECT_EQ(2, cache.entries());
+	EXPECT_EQ(2, cache.hits());
+	EXPECT_EQ(1, cache.misses());
+
+	cache.put(2, "zwei");
+	EXPECT_EQ("zwei", *cache.get(2));
+	EXPECT_EQ(2, cache.size());
+}
+
+TEST(LRUCache, Eviction)
+{
+	carl::LRUCache<int, int> cache(4);
+	cache.put(1, 1, 2);
+	cache.put(2, 2, 1);
+	cache.put(3, 3, 1);
+	// 1 is now the most recently used entry.
+	EXPECT_TRUE(cache.get(1));
+	cache.put(4, 4, 1);
+	EXPECT_FALSE(cache.get(2));
+	EXPECT_TRUE(cache.get(1));
+	EXPECT_TRUE(cache.get(3));
+	EXPECT_TRUE(cache.get(4));
+	EXPECT_EQ(1, cache.evictions());
+	EXPECT_EQ(4, cache.size());
+
+	// Entries larger than the capacity are not stored.
+	cache.put(5, 5, 5);
+	EXPECT_FALSE(cache.get(5));
+	EXPECT_EQ(3, cache.entries());
+
+	cache.set_capacity(1);
+	EXPECT_EQ(1, cache.entries());
+	EXPECT_TRUE(cache.get(4));
+	cache.clear();
+	EXPECT_EQ(0, cache.entries());
+	EXPECT_EQ(0, cache.size());
+}
+
+TEST(LRUCache, GetOrCompute)
+{
+	carl::LRUCache<int, int> cache(10);
+	std::size_t computations = 0;
+	auto square = [&computations](int i) {
+		++computations;
+		return i * i;
+	};
+	auto size = [](int) { return 1; };
+	EXPECT_EQ(9, cache.get_or_compute(3, [&](){ return square(3); }, size));
+	EXPECT_EQ(9, cache.get_or_compute(3, [&](){ return square(3); }, size));
+	EXPECT_EQ(16, cache.get_or_compute(4, [&](){ return square(4); }, size));
+	EXPECT_EQ(2, computations);
+}
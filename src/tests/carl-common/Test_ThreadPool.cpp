@@ -0,0 +1,68 @@
+#include <carl-common/util/ThreadPool.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <functional>
+#include <stdexcept>
+
+TEST(ThreadPool, Basics)
+{
+	carl::ThreadPool pool(4);
+	EXPECT_EQ(4, pool.size());
+	std::atomic<std::size_t> sum = 0;
+	for (std::size_t i = 1; i <= 100; ++i) {
+		pool.submit([&sum, i](){ sum += i; });
+	}
+	pool.wait();
+	EXPECT_EQ(5050, sum);
+}
+
+TEST(ThreadPool, Recursive)
+{
+	carl::ThreadPool pool(3);
+	std::atomic<std::size_t> leaves = 0;
+	std::function<void(std::size_t)> split = [&](std::size_t depth) {
+		if (depth == 0) {
+			++leaves;
+			return;
+		}
+		pool.submit([&split, depth](){ split(depth - 1); });
+		pool.submit([&split, depth](){ split(depth - 1); });
+	};
+	pool.submit([&split](){ split(10); });
+	pool.wait();
+	EXPECT_EQ(1024, leaves);
+	// The pool can be reused after waiting.
+	pool.submit([&split](){ split(3); });
+	pool.wait();
+	EXPECT_EQ(1032, leaves);
+}
+
+TEST(ThreadPool, Exception)
+{
+	carl::ThreadPool pool(2);
+	std::atomic<std::size_t> done = 0;
+	for (std::size_t i = 0; i < 10; ++i) {
+		pool.submit([&done, i](){
+			if (i == 5) throw std::runtime_error("task failed");
+			++done;
+		});
+	}
+	EXPECT_THROW(pool.wait(), std::runtime_error);
+	EXPECT_EQ(9, done);
+	// The exception is only rethrown once.
+	pool.submit([&done](){ ++done; });
+	EXPECT_NO_THROW(pool.wait());
+	EXPECT_EQ(10, done);
+}
+
+TEST(ThreadPool, Local)
+{
+	carl::ThreadPool& pool = carl::ThreadPool::local(2);
+	EXPECT_EQ(2, pool.size());
+	EXPECT_EQ(&pool, &carl::ThreadPool::local(2));
+	std::atomic<std::size_t> sum = 0;
+	pool.submit([&sum](){ sum += 1; });
+	pool.wait();
+	EXPECT_EQ(1, sum);
+}
@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
 #include <carl-arith/core/VariablePool.h>
 #include <carl-formula/formula/Formula.h>
+#include <carl-formula/formula/functions/CNF.h>
+#include <carl-formula/formula/functions/NNF.h>
+#include <carl-formula/formula/functions/PNF.h>
+#include <carl-formula/formula/functions/Substitution.h>
 #include <carl-io/StringParser.h>
 
 #include "../Common.h"
@@ -404,3 +408,60 @@ TEST(Formula, Uniqueness)
 	FormulaT f2 = FormulaT(vc);
 	EXPECT_EQ(f1, f2);
 }
+
+TEST(Formula, Usages)
+{
+	Variable x = fresh_real_variable("x");
+	Variable b = fresh_boolean_variable("b");
+	auto& pool = FormulaPool<Pol>::getInstance();
+	std::size_t size = pool.size();
+	{
+		FormulaT c(Pol(x), Relation::LESS);
+		FormulaT f(AND, {c, FormulaT(b)});
+		EXPECT_EQ(size + 3, pool.size());
+		{
+			std::vector<FormulaT> copies(10, f.negated());
+			FormulaT moved = std::move(copies.back());
+			copies.pop_back();
+			EXPECT_EQ(f, moved.negated());
+		}
+		EXPECT_EQ(size + 3, pool.size());
+		FormulaT c2(Pol(x), Relation::GEQ);
+		EXPECT_EQ(c.negated(), c2);
+	}
+	EXPECT_EQ(size, pool.size());
+}
+
+TEST(Formula, SharedSubformulas)
+{
+	// g_{i+1} = (g_i and x_i) or (not g_i and y_i) has exponentially many paths but only linearly many distinct subformulas
+	Variable z = fresh_real_variable("z");
+	FormulaT g(Pol(z), Relation::LESS);
+	std::size_t n = 60;
+	for (std::size_t i = 0; i < n; ++i) {
+		FormulaT x(fresh_boolean_variable());
+		FormulaT y(fresh_boolean_variable());
+		g = FormulaT(OR, {FormulaT(AND, {g, x}), FormulaT(AND, {!g, y})});
+	}
+
+	std::size_t visits = 0;
+	memoized_visit(g, [&visits](const FormulaT&) { ++visits; });
+	EXPECT_EQ(1 + 6 * n, visits);
+	EXPECT_EQ(2 * n + 1, variables(g).size());
+
+	std::size_t results = 0;
+	auto same = memoized_visit_result(g, [&results](const FormulaT& f) { ++results; return f; });
+	EXPECT_EQ(g, same);
+	EXPECT_EQ(1 + 6 * n, results);
+
+	Variable w = fresh_real_variable("w");
+	auto substituted = substitute(g, z, Pol(w));
+	EXPECT_EQ(0, substituted.variables().count(z));
+	EXPECT_EQ(1, substituted.variables().count(w));
+
+	memoized_visit(to_nnf(g), [](const FormulaT& f) {
+		EXPECT_TRUE(f.type() != NOT || f.subformula().is_atom());
+	});
+	EXPECT_TRUE(to_pnf(g).second.property_holds(PROP_IS_IN_PNF));
+	EXPECT_TRUE(to_cnf(g).property_holds(PROP_IS_IN_CNF));
+}
@@ -109,3 +109,41 @@ TEST(ModelEvaluation, EvaluateBV)
 	auto res = carl::evaluate(f, m);
 	std::cout << res << std::endl;
 }
+
+TEST(ModelEvaluation, EvaluationContext)
+{
+	Variable x = fresh_real_variable("x");
+	Variable y = fresh_real_variable("y");
+	Variable z = fresh_real_variable("z");
+	FormulaT xpos(ConstraintT(Pol(x), Relation::GREATER));
+	FormulaT ypos(ConstraintT(Pol(y), Relation::GREATER));
+	FormulaT xsmall(ConstraintT(Pol(x) - Rational(2), Relation::LESS));
+	FormulaT zpos(ConstraintT(Pol(z), Relation::GREATER));
+	FormulaT f(FormulaType::AND, {xpos, FormulaT(FormulaType::OR, {ypos, xsmall}), FormulaT(FormulaType::IMPLIES, {ypos, zpos})});
+
+	ModelT m;
+	m.assign(x, Rational(1));
+	m.assign(y, Rational(-1));
+	model::EvaluationContext<Rational,Pol> context(m);
+	EXPECT_TRUE(context.evaluate(f).asBool());
+	EXPECT_EQ(context.substitute(f), substitute(f, m));
+
+	m.assign(x, Rational(3));
+	context.invalidate(x);
+	EXPECT_FALSE(context.evaluate(f).asBool());
+
+	m.assign(y, Rational(1));
+	context.invalidate(y);
+	EXPECT_EQ(context.substitute(f), zpos);
+	EXPECT_EQ(context.substitute(f), substitute(f, m));
+
+	// z is substituted by 2*y, hence it depends on y.
+	m.emplace(z, carl::createSubstitution<Rational,Pol,carl::ModelPolynomialSubstitution<Rational,Pol>>(Pol(y) * Rational(2)));
+	context.invalidate(z);
+	EXPECT_TRUE(context.evaluate(f).asBool());
+	m.assign(y, Rational(-1));
+	context.invalidate(y);
+	EXPECT_FALSE(context.evaluate(f).asBool());
+	EXPECT_FALSE(context.evaluate(zpos).asBool());
+	EXPECT_EQ(context.substitute(Pol(z) + Pol(x)), Pol(Rational(1)));
+}
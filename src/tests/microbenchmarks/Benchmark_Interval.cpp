@@ -0,0 +1,223 @@
+#include <benchmark/benchmark.h>
+
+#include <carl-arith/interval/Interval.h>
+#include <carl-arith/interval/IntervalBatch.h>
+#include <carl-arith/intervalcontraction/Contractor.h>
+#include <carl-arith/numbers/numbers.h>
+#include <carl-arith/poly/umvpoly/functions/IntervalEvaluator.h>
+
+#include <random>
+#include <vector>
+
+/**
+ * Compares the rounding policies for double intervals on the workloads of the contractors from the tests in carl-arith-intervalcontraction:
+ * every polynomial is solved for each of its variables and the numerator and denominator are evaluated over a box.
+ * The rounding mode of the FPU is switched by the policy of boost, while rounding<double> uses error-free transformations.
+ * Additionally, the evaluation of four or eight boxes at once using IntervalBatch is measured.
+ */
+namespace {
+
+using Poly = carl::MultivariatePolynomial<mpq_class>;
+using Evaluator = carl::IntervalEvaluator<double>;
+
+template<typename Rounding>
+using BoostDouble = boost::numeric::interval<double, boost::numeric::interval_lib::policies<Rounding, carl::Interval<double>::Policy::checkingP>>;
+using FPURounding = boost::numeric::interval_lib::save_state<boost::numeric::interval_lib::rounded_transc_std<double>>;
+using EFTRounding = carl::rounding<double>;
+
+/// A compiled polynomial and the positions of its variables within a box.
+struct Compiled {
+	Evaluator evaluator;
+	std::vector<std::size_t> positions;
+};
+
+/// The polynomials of the contractor tests, compiled for every variable they are solved for.
+struct ContractionWorkload {
+	carl::Variable a = carl::fresh_real_variable("a");
+	carl::Variable b = carl::fresh_real_variable("b");
+	carl::Variable c = carl::fresh_real_variable("c");
+	carl::Variable d = carl::fresh_real_variable("d");
+	std::vector<Poly> polys;
+	std::vector<std::pair<Compiled, Compiled>> evaluations;
+	std::vector<std::vector<carl::Interval<double>>> boxes;
+
+	Compiled compile(const Poly& p) const {
+		Compiled res{ Evaluator(p), {} };
+		for (auto v: res.evaluator.variables()) {
+			res.positions.push_back(v == a ? 0 : (v == b ? 1 : (v == c ? 2 : 3)));
+		}
+		return res;
+	}
+
+	ContractionWorkload() {
+		polys.emplace_back(Poly(a) + b + c + d);
+		polys.emplace_back(Poly(a) * b + Poly(c) * d);
+		polys.emplace_back(Poly(a) * b * c + d);
+		polys.emplace_back(Poly(a) + b - c - d);
+		polys.emplace_back(Poly(a) + b + mpq_class(7));
+		polys.emplace_back(Poly(a) * mpq_class(12) + Poly(b) * mpq_class(3) + Poly(c) * c - Poly(d) * d * d);
+		polys.emplace_back(carl::pow(Poly(a) + c, 2) * b * d + a);
+		for (const auto& p: polys) {
+			for (auto v: carl::variables(p)) {
+				carl::contractor::Evaluation<Poly> e(p, v);
+				evaluations.emplace_back(compile(e.numerator()), compile(e.denominator()));
+			}
+		}
+		std::mt19937 gen(42);
+		std::uniform_real_distribution<double> dist(-5.0, 5.0);
+		for (std::size_t i = 0; i < 64; ++i) {
+			std::vector<carl::Interval<double>> box;
+			for (std::size_t j = 0; j < 4; ++j) {
+				double l = dist(gen);
+				box.emplace_back(l, l + std::abs(dist(gen)));
+			}
+			boxes.emplace_back(std::move(box));
+		}
+	}
+};
+
+const ContractionWorkload& workload() {
+	static ContractionWorkload w;
+	return w;
+}
+
+/// Runs the program of an evaluator on an arbitrary interval type.
+template<typename I, typename Constant>
+I interpret(const Evaluator& e, std::vector<I>& registers, Constant&& constant) {
+	std::size_t offset = e.variables().size();
+	for (std::size_t i = 0; i < e.program().size(); ++i) {
+		const auto& ins = e.program()[i];
+		I& res = registers[offset + i];
+		switch (ins.op) {
+			case Evaluator::OpCode::Power: res = pow(registers[ins.lhs], int(ins.rhs)); break;
+			case Evaluator::OpCode::Constant: res = constant(e.constants()[ins.lhs]); break;
+			case Evaluator::OpCode::Add: res = registers[ins.lhs] + registers[ins.rhs]; break;
+			case Evaluator::OpCode::Mul: res = registers[ins.lhs] * registers[ins.rhs]; break;
+			case Evaluator::OpCode::AddConstant: res = registers[ins.rhs] + constant(e.constants()[ins.lhs]); break;
+			case Evaluator::OpCode::MulConstant: res = constant(e.constants()[ins.lhs]) * registers[ins.rhs]; break;
+		}
+	}
+	return registers[e.result()];
+}
+
+/// Sets the values of the variables of a compiled polynomial from a box.
+template<typename I>
+void load(const Compiled& c, const std::vector<I>& box, std::vector<I>& registers) {
+	registers.resize(c.evaluator.variables().size() + c.evaluator.program().size());
+	for (std::size_t i = 0; i < c.positions.size(); ++i) {
+		registers[i] = box[c.positions[i]];
+	}
+}
+
+/// Evaluates numerator and denominator with the given rounding policy and optionally divides them.
+template<typename Rounding, bool Divide>
+void contraction_scalar(benchmark::State& state) {
+	using I = BoostDouble<Rounding>;
+	const auto& w = workload();
+	std::vector<std::vector<I>> boxes;
+	for (const auto& box: w.boxes) {
+		boxes.emplace_back();
+		for (const auto& i: box) boxes.back().emplace_back(i.lower(), i.upper());
+	}
+	auto constant = [](const carl::Interval<double>& c) { return I(c.lower(), c.upper()); };
+	std::vector<I> registers;
+	for (auto _ : state) {
+		for (const auto& box: boxes) {
+			for (const auto& [num, den]: w.evaluations) {
+				load(num, box, registers);
+				I n = interpret(num.evaluator, registers, constant);
+				load(den, box, registers);
+				I d = interpret(den.evaluator, registers, constant);
+				if constexpr (Divide) {
+					if (!boost::numeric::zero_in(d)) n = n / d;
+				}
+				benchmark::DoNotOptimize(n);
+				benchmark::DoNotOptimize(d);
+			}
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * std::int64_t(boxes.size() * w.evaluations.size()));
+}
+
+void Contraction_FPURounding(benchmark::State& state) {
+	contraction_scalar<FPURounding, true>(state);
+}
+BENCHMARK(Contraction_FPURounding);
+
+void Contraction_EFTRounding(benchmark::State& state) {
+	contraction_scalar<EFTRounding, true>(state);
+}
+BENCHMARK(Contraction_EFTRounding);
+
+void Evaluation_FPURounding(benchmark::State& state) {
+	contraction_scalar<FPURounding, false>(state);
+}
+BENCHMARK(Evaluation_FPURounding);
+
+void Evaluation_EFTRounding(benchmark::State& state) {
+	contraction_scalar<EFTRounding, false>(state);
+}
+BENCHMARK(Evaluation_EFTRounding);
+
+/// Evaluates numerator and denominator on N boxes at once.
+template<std::size_t N>
+void contraction_batch(benchmark::State& state) {
+	using I = carl::IntervalBatch<N>;
+	const auto& w = workload();
+	std::vector<std::vector<I>> boxes;
+	for (std::size_t b = 0; b + N <= w.boxes.size(); b += N) {
+		boxes.emplace_back(4);
+		for (std::size_t lane = 0; lane < N; ++lane) {
+			for (std::size_t v = 0; v < 4; ++v) boxes.back()[v].set(lane, w.boxes[b + lane][v]);
+		}
+	}
+	auto constant = [](const carl::Interval<double>& c) { return I(c); };
+	std::vector<I> registers;
+	for (auto _ : state) {
+		for (const auto& box: boxes) {
+			for (const auto& [num, den]: w.evaluations) {
+				load(num, box, registers);
+				benchmark::DoNotOptimize(interpret(num.evaluator, registers, constant));
+				load(den, box, registers);
+				benchmark::DoNotOptimize(interpret(den.evaluator, registers, constant));
+			}
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * std::int64_t(boxes.size() * N * w.evaluations.size()));
+}
+
+void Evaluation_Batch4(benchmark::State& state) {
+	contraction_batch<4>(state);
+}
+BENCHMARK(Evaluation_Batch4);
+
+void Evaluation_Batch8(benchmark::State& state) {
+	contraction_batch<8>(state);
+}
+BENCHMARK(Evaluation_Batch8);
+
+/// The contractors of the tests on carl::Interval<double> with the configured rounding policy.
+void Contractor_Interval(benchmark::State& state) {
+	const auto& w = workload();
+	std::vector<carl::contractor::Contractor<std::size_t, Poly>> contractors;
+	for (const auto& p: w.polys) {
+		for (auto v: carl::variables(p)) {
+			contractors.emplace_back(contractors.size(), carl::BasicConstraint<Poly>(p, carl::Relation::EQ), v);
+		}
+	}
+	std::vector<std::map<carl::Variable, carl::Interval<double>>> maps;
+	for (const auto& box: w.boxes) {
+		maps.push_back({ { w.a, box[0] }, { w.b, box[1] }, { w.c, box[2] }, { w.d, box[3] } });
+	}
+	for (auto _ : state) {
+		for (const auto& map: maps) {
+			for (auto& c: contractors) {
+				benchmark::DoNotOptimize(c.contract(map));
+			}
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * std::int64_t(maps.size() * contractors.size()));
+}
+BENCHMARK(Contractor_Interval);
+
+}
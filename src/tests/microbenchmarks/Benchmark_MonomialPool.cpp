@@ -0,0 +1,34 @@
+#include <benchmark/benchmark.h>
+
+#include <carl-arith/poly/umvpoly/MonomialPool.h>
+
+#include <vector>
+
+/**
+ * Measures contention on the MonomialPool: every thread repeatedly creates and releases monomials.
+ * Each thread either uses its own variables (disjoint monomials) or all threads share the same variables.
+ */
+static void create_and_release(benchmark::State& state, bool shared) {
+	static carl::Variable x = carl::fresh_real_variable("x");
+	static carl::Variable y = carl::fresh_real_variable("y");
+	carl::Variable tx = shared ? x : carl::fresh_real_variable();
+	carl::Variable ty = shared ? y : carl::fresh_real_variable();
+	std::vector<carl::Monomial::Arg> monomials;
+	for (auto _ : state) {
+		for (carl::exponent e = 1; e <= 64; ++e) {
+			monomials.emplace_back(carl::MonomialPool::getInstance().create({std::make_pair(tx, e), std::make_pair(ty, carl::exponent(65) - e)}));
+		}
+		monomials.clear();
+	}
+	state.SetItemsProcessed(state.iterations() * 64);
+}
+
+static void MonomialPool_Disjoint(benchmark::State& state) {
+	create_and_release(state, false);
+}
+BENCHMARK(MonomialPool_Disjoint)->ThreadRange(1, 8)->UseRealTime();
+
+static void MonomialPool_Shared(benchmark::State& state) {
+	create_and_release(state, true);
+}
+BENCHMARK(MonomialPool_Shared)->ThreadRange(1, 8)->UseRealTime();
@@ -26,3 +26,47 @@ BENCHMARK_F(MVP_Add_Fixture, MVP_Add_alt)(benchmark::State& state) {
         benchmark::DoNotOptimize(MVP(p) += (q));
     }
 }
+
+/**
+ * Multiplies two polynomials with (k+4 choose 4) terms each, where k is the benchmark argument.
+ */
+class MVP_Mul_Fixture: public benchmark::Fixture {
+public:
+    carl::Variable x = carl::fresh_real_variable("x");
+    carl::Variable y = carl::fresh_real_variable("y");
+    carl::Variable z = carl::fresh_real_variable("z");
+    carl::Variable w = carl::fresh_real_variable("w");
+    MVP p;
+    MVP q;
+    static constexpr auto& tam = MVP::mTermAdditionManager;
+
+    void SetUp(const benchmark::State& state) override {
+        MVP base = MVP(x) + y + z + w + mpq_class(1);
+        p = base;
+        for (int i = 1; i < state.range(0); ++i) p *= base;
+        q = p + MVP(x) * y * z * w;
+    }
+};
+
+BENCHMARK_DEFINE_F(MVP_Mul_Fixture, MVP_Mul_Heap)(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(p * q);
+    }
+}
+BENCHMARK_REGISTER_F(MVP_Mul_Fixture, MVP_Mul_Heap)->DenseRange(2, 8, 2);
+
+/// The previous implementation of the multiplication, which collects all products in the TermAdditionManager.
+BENCHMARK_DEFINE_F(MVP_Mul_Fixture, MVP_Mul_TermAdditionManager)(benchmark::State& state) {
+    for (auto _ : state) {
+        auto id = tam.getId(p.nr_terms() * q.nr_terms());
+        for (const auto& t1: p) {
+            for (const auto& t2: q) {
+                tam.addTerm<false>(id, t1 * t2);
+            }
+        }
+        MVP::TermsType terms;
+        tam.readTerms(id, terms);
+        benchmark::DoNotOptimize(terms);
+    }
+}
+BENCHMARK_REGISTER_F(MVP_Mul_Fixture, MVP_Mul_TermAdditionManager)->DenseRange(2, 8, 2);
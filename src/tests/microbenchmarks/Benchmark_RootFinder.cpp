@@ -44,5 +44,19 @@ BENCHMARK_F(RF_Fixture, Real_Roots_2)(benchmark::State& state) {
 	}
 }
 
+BENCHMARK_F(RF_Fixture, Real_Roots_2_VCA)(benchmark::State& state) {
+	carl::Variable x = carl::fresh_real_variable("x");
+	Poly p = Poly(x, {-66864570625487788604261524190527488000000000000000000000000000000000000000000000000_mpq, 29854830731431634049898015056382132224000000000000000000000000000000000000000000000_mpq,
+	-505416087363206530647584374267211415552000000000000000000000000000000000000000000_mpq, 4175633824067780996197090619870479908864000000000000000000000000000000000000000_mpq,
+	-22123075889900509025587890607637359755264000000000000000000000000000000000000_mpq, 84105767440004379479396048598450604867584000000000000000000000000000000000_mpq,
+	-243736416758800137976000425396107778981888000000000000000000000000000000_mpq, 557927276756885723844248187821195727470592000000000000000000000000000_mpq,
+	-1028655240376238080386120074233535281496064000000000000000000000000_mpq,
+	1537205882314544520383371309153190311624704000000000000000000000_mpq, -1850245296283620589500378012241541801705472000000000000000000_mpq,
+	1759094245770532463939207746344508321431552000000000000000_mpq, -1274862311787402732031743433553883636424704000000000000_mpq,
+	662971140168469203991742914981670449102848000000000_mpq, -221093370976852468477758191983112847898368000000_mpq,
+	35982863100180637437263547995778211974592000_mpq, -222040198421806427031529186994264976123_mpq});
 
-
+	for (auto _ : state) {
+		auto rans = carl::real_roots(p, carl::Interval<mpq_class>::unbounded_interval(), carl::RealRootIsolationStrategy::VCA);
+	}
+}